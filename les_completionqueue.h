@@ -0,0 +1,99 @@
+#ifndef LES_COMPLETIONQUEUE_HH
+#define LES_COMPLETIONQUEUE_HH
+
+#include "les_base.h"
+
+#if defined(__GNUC__)
+#define LES_MEMORY_BARRIER() __sync_synchronize()
+#else // #if defined(__GNUC__)
+#error LES_MEMORY_BARRIER not defined for this compiler
+#endif // #if defined(__GNUC__)
+
+/*
+ * Lock-free single producer, single consumer queue : no mutex is needed between the two threads
+ * The producer only writes m_tailIndex and the consumer only writes m_headIndex
+ * The indexes are free running (they wrap at 2^32) : SIZE must be a power of 2
+*/
+template <class T, int SIZE> class LES_CompletionQueue
+{
+public:
+	LES_CompletionQueue(void);
+	~LES_CompletionQueue(void);
+
+	// Not thread safe : only call when neither thread is using the queue
+	void Reset(void);
+
+	// Producer thread : returns LES_RETURN_ERROR if the queue is full
+	int Push(const T* const pItem);
+	// Consumer thread : returns false if the queue is empty
+	bool Pop(T* const pItem);
+
+	int GetNumItems(void) const
+	{
+		return (int)(m_tailIndex - m_headIndex);
+	}
+
+private:
+	LES_CompletionQueue(const LES_CompletionQueue& other);
+	LES_CompletionQueue& operator =(const LES_CompletionQueue& other);
+
+	typedef char LES_CompletionQueueSizeMustBeAPowerOf2[((SIZE > 0) && ((SIZE & (SIZE - 1)) == 0)) ? 1 : -1];
+
+	volatile LES_uint32 m_headIndex;
+	volatile LES_uint32 m_tailIndex;
+	T m_items[SIZE];
+};
+
+// The items are value initialised : a Pop never copies out memory which hasn't been written
+template <class T, int SIZE> LES_CompletionQueue<T, SIZE>::LES_CompletionQueue(void) : m_items()
+{
+	Reset();
+}
+
+template <class T, int SIZE> LES_CompletionQueue<T, SIZE>::~LES_CompletionQueue(void)
+{
+	Reset();
+}
+
+template <class T, int SIZE> void LES_CompletionQueue<T, SIZE>::Reset(void)
+{
+	m_headIndex = 0;
+	m_tailIndex = 0;
+}
+
+template <class T, int SIZE> int LES_CompletionQueue<T, SIZE>::Push(const T* const pItem)
+{
+	const LES_uint32 tailIndex = m_tailIndex;
+	const LES_uint32 headIndex = m_headIndex;
+	if ((tailIndex - headIndex) >= (LES_uint32)SIZE)
+	{
+		// Queue full
+		return LES_RETURN_ERROR;
+	}
+	m_items[tailIndex & (SIZE - 1)] = *pItem;
+
+	// The item must be visible before the consumer can see the new tail
+	LES_MEMORY_BARRIER();
+	m_tailIndex = tailIndex + 1;
+	return LES_RETURN_OK;
+}
+
+template <class T, int SIZE> bool LES_CompletionQueue<T, SIZE>::Pop(T* const pItem)
+{
+	const LES_uint32 headIndex = m_headIndex;
+	const LES_uint32 tailIndex = m_tailIndex;
+	if (headIndex == tailIndex)
+	{
+		return false;
+	}
+	// Read the tail before the item it publishes
+	LES_MEMORY_BARRIER();
+	*pItem = m_items[headIndex & (SIZE - 1)];
+
+	// The item must be copied out before the producer can reuse its slot
+	LES_MEMORY_BARRIER();
+	m_headIndex = headIndex + 1;
+	return true;
+}
+
+#endif // #ifndef LES_COMPLETIONQUEUE_HH
@@ -0,0 +1,223 @@
+#include <string.h>
+
+#include "les_compress.h"
+
+#define LES_COMPRESS_HASH_BITS (12)
+#define LES_COMPRESS_HASH_SIZE (1 << LES_COMPRESS_HASH_BITS)
+#define LES_COMPRESS_MIN_MATCH (4)
+#define LES_COMPRESS_LAST_LITERALS (5)
+#define LES_COMPRESS_MATCH_FIND_LIMIT (12)
+#define LES_COMPRESS_MAX_OFFSET (65535)
+#define LES_COMPRESS_LENGTH_MASK (15)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Internal Static functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static LES_uint32 LES_CompressRead32(const char* const pData)
+{
+	LES_uint32 value;
+	memcpy(&value, pData, sizeof(value));
+	return value;
+}
+
+static int LES_CompressHash(const LES_uint32 value)
+{
+	return (int)((value * 2654435761U) >> (32 - LES_COMPRESS_HASH_BITS));
+}
+
+/* Returns the new output pointer or LES_NULL if the extra length bytes don't fit */
+static char* LES_CompressWriteLength(char* pOutData, const char* const pOutEnd, int length)
+{
+	while (length >= 255)
+	{
+		if (pOutData >= pOutEnd)
+		{
+			return LES_NULL;
+		}
+		*pOutData++ = (char)255;
+		length -= 255;
+	}
+	if (pOutData >= pOutEnd)
+	{
+		return LES_NULL;
+	}
+	*pOutData++ = (char)length;
+	return pOutData;
+}
+
+/* Token, literals and if matchLength > 0 the match : returns the new output pointer or LES_NULL if it doesn't fit */
+static char* LES_CompressWriteSequence(char* pOutData, const char* const pOutEnd, const char* const pLiterals, const int numLiterals,
+																			 const int offset, const int matchLength)
+{
+	if (pOutData >= pOutEnd)
+	{
+		return LES_NULL;
+	}
+	const int matchLengthCode = (matchLength > 0) ? (matchLength - LES_COMPRESS_MIN_MATCH) : 0;
+	const int literalToken = (numLiterals < LES_COMPRESS_LENGTH_MASK) ? numLiterals : LES_COMPRESS_LENGTH_MASK;
+	const int matchToken = (matchLengthCode < LES_COMPRESS_LENGTH_MASK) ? matchLengthCode : LES_COMPRESS_LENGTH_MASK;
+	*pOutData++ = (char)((literalToken << 4) | matchToken);
+	if (literalToken == LES_COMPRESS_LENGTH_MASK)
+	{
+		pOutData = LES_CompressWriteLength(pOutData, pOutEnd, numLiterals - LES_COMPRESS_LENGTH_MASK);
+		if (pOutData == LES_NULL)
+		{
+			return LES_NULL;
+		}
+	}
+	if ((pOutEnd - pOutData) < numLiterals)
+	{
+		return LES_NULL;
+	}
+	memcpy(pOutData, pLiterals, (size_t)numLiterals);
+	pOutData += numLiterals;
+	if (matchLength == 0)
+	{
+		return pOutData;
+	}
+	if ((pOutEnd - pOutData) < 2)
+	{
+		return LES_NULL;
+	}
+	*pOutData++ = (char)(offset & 0xFF);
+	*pOutData++ = (char)((offset >> 8) & 0xFF);
+	if (matchToken == LES_COMPRESS_LENGTH_MASK)
+	{
+		pOutData = LES_CompressWriteLength(pOutData, pOutEnd, matchLengthCode - LES_COMPRESS_LENGTH_MASK);
+	}
+	return pOutData;
+}
+
+/* Returns false if the input ends before the last length byte or the length gets bigger than maxLength */
+static bool LES_DecompressReadLength(const char** const ppInData, const char* const pInEnd, int* const pLength, const int maxLength)
+{
+	const char* pInData = *ppInData;
+	int length = *pLength;
+	LES_uint8 byte = 255;
+	while (byte == 255)
+	{
+		if ((pInData >= pInEnd) || (length > maxLength))
+		{
+			return false;
+		}
+		byte = (LES_uint8)*pInData++;
+		length += byte;
+	}
+	*ppInData = pInData;
+	*pLength = length;
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int LES_CompressBlock(char* const pOutData, const int maxOutSize, const char* const pInData, const int inSize)
+{
+	/* Offsets into the input of the last position with each hash : -1 for none */
+	int hashTable[LES_COMPRESS_HASH_SIZE];
+	memset(hashTable, 0xFF, sizeof(hashTable));
+
+	char* pOut = pOutData;
+	const char* const pOutEnd = pOutData + maxOutSize;
+	const int matchEndLimit = inSize - LES_COMPRESS_LAST_LITERALS;
+	const int matchStartLimit = inSize - LES_COMPRESS_MATCH_FIND_LIMIT;
+	int anchor = 0;
+	int i = 0;
+	while (i < matchStartLimit)
+	{
+		const LES_uint32 sequence = LES_CompressRead32(pInData + i);
+		const int hash = LES_CompressHash(sequence);
+		const int ref = hashTable[hash];
+		hashTable[hash] = i;
+		if ((ref < 0) || ((i - ref) > LES_COMPRESS_MAX_OFFSET) || (LES_CompressRead32(pInData + ref) != sequence))
+		{
+			/* Step faster through data which isn't compressing */
+			i += 1 + ((i - anchor) >> 6);
+			continue;
+		}
+		int matchLength = LES_COMPRESS_MIN_MATCH;
+		while (((i + matchLength) < matchEndLimit) && (pInData[ref + matchLength] == pInData[i + matchLength]))
+		{
+			matchLength++;
+		}
+		pOut = LES_CompressWriteSequence(pOut, pOutEnd, pInData + anchor, i - anchor, i - ref, matchLength);
+		if (pOut == LES_NULL)
+		{
+			return -1;
+		}
+		i += matchLength;
+		anchor = i;
+		if (i < matchStartLimit)
+		{
+			hashTable[LES_CompressHash(LES_CompressRead32(pInData + i - 2))] = i - 2;
+		}
+	}
+	pOut = LES_CompressWriteSequence(pOut, pOutEnd, pInData + anchor, inSize - anchor, 0, 0);
+	if (pOut == LES_NULL)
+	{
+		return -1;
+	}
+	return (int)(pOut - pOutData);
+}
+
+int LES_DecompressBlock(char* const pOutData, const int maxOutSize, const char* const pInData, const int inSize)
+{
+	const char* pIn = pInData;
+	const char* const pInEnd = pInData + inSize;
+	char* pOut = pOutData;
+	const char* const pOutEnd = pOutData + maxOutSize;
+	while (pIn < pInEnd)
+	{
+		const LES_uint8 token = (LES_uint8)*pIn++;
+		int numLiterals = token >> 4;
+		if ((numLiterals == LES_COMPRESS_LENGTH_MASK) && (LES_DecompressReadLength(&pIn, pInEnd, &numLiterals, maxOutSize) == false))
+		{
+			return -1;
+		}
+		if (((pInEnd - pIn) < numLiterals) || ((pOutEnd - pOut) < numLiterals))
+		{
+			return -1;
+		}
+		memcpy(pOut, pIn, (size_t)numLiterals);
+		pIn += numLiterals;
+		pOut += numLiterals;
+		if (pIn == pInEnd)
+		{
+			/* The last sequence is only literals */
+			break;
+		}
+		if ((pInEnd - pIn) < 2)
+		{
+			return -1;
+		}
+		const int offset = (LES_uint8)pIn[0] | ((LES_uint8)pIn[1] << 8);
+		pIn += 2;
+		if ((offset == 0) || (offset > (pOut - pOutData)))
+		{
+			return -1;
+		}
+		int matchLength = token & LES_COMPRESS_LENGTH_MASK;
+		if ((matchLength == LES_COMPRESS_LENGTH_MASK) && (LES_DecompressReadLength(&pIn, pInEnd, &matchLength, maxOutSize) == false))
+		{
+			return -1;
+		}
+		matchLength += LES_COMPRESS_MIN_MATCH;
+		if ((pOutEnd - pOut) < matchLength)
+		{
+			return -1;
+		}
+		/* The match can overlap the output it is copied to : copy a byte at a time */
+		const char* pMatch = pOut - offset;
+		for (int m = 0; m < matchLength; m++)
+		{
+			*pOut++ = *pMatch++;
+		}
+	}
+	return (int)(pOut - pOutData);
+}
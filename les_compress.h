@@ -0,0 +1,20 @@
+#ifndef LES_COMPRESS_HH
+#define LES_COMPRESS_HH
+
+#include "les_base.h"
+
+/*
+ * Fast LZ block compression (LZ4 block format) used for large network message payloads
+ * Each sequence is a token (literal length : match length - 4, 4 bits each) then the extra literal length bytes, the literals,
+ * a 2 byte little endian match offset and the extra match length bytes : a length of 15 is followed by bytes added to it until one isn't 255
+ * The last sequence is only literals : the last 5 bytes are always literals and the last match starts at least 12 bytes from the end
+*/
+#define LES_COMPRESS_MAX_SIZE(NUM_BYTES) ((NUM_BYTES) + ((NUM_BYTES) / 255) + 16)
+
+/* Returns the compressed size or -1 if the compressed data doesn't fit in maxOutSize */
+int LES_CompressBlock(char* const pOutData, const int maxOutSize, const char* const pInData, const int inSize);
+
+/* Returns the decompressed size or -1 if the compressed data is invalid or doesn't fit in maxOutSize */
+int LES_DecompressBlock(char* const pOutData, const int maxOutSize, const char* const pInData, const int inSize);
+
+#endif // #ifndef LES_COMPRESS_HH
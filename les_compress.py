@@ -0,0 +1,119 @@
+#!/usr/bin/python
+
+import les_logger
+
+# Must match les_compress.h & les_compress.cpp : LZ4 block format
+LES_COMPRESS_MIN_MATCH = 4
+LES_COMPRESS_LAST_LITERALS = 5
+LES_COMPRESS_MATCH_FIND_LIMIT = 12
+LES_COMPRESS_MAX_OFFSET = 65535
+LES_COMPRESS_LENGTH_MASK = 15
+
+def __WriteLength__(outData, length):
+	while length >= 255:
+		outData.append(chr(255))
+		length -= 255
+	outData.append(chr(length))
+
+def __WriteSequence__(outData, literals, offset, matchLength):
+	numLiterals = len(literals)
+	matchLengthCode = 0
+	if matchLength > 0:
+		matchLengthCode = matchLength - LES_COMPRESS_MIN_MATCH
+	literalToken = min(numLiterals, LES_COMPRESS_LENGTH_MASK)
+	matchToken = min(matchLengthCode, LES_COMPRESS_LENGTH_MASK)
+	outData.append(chr((literalToken << 4) | matchToken))
+	if literalToken == LES_COMPRESS_LENGTH_MASK:
+		__WriteLength__(outData, numLiterals - LES_COMPRESS_LENGTH_MASK)
+	outData.append(literals)
+	if matchLength == 0:
+		return
+	outData.append(chr(offset & 0xFF))
+	outData.append(chr((offset >> 8) & 0xFF))
+	if matchToken == LES_COMPRESS_LENGTH_MASK:
+		__WriteLength__(outData, matchLengthCode - LES_COMPRESS_LENGTH_MASK)
+
+# Returns the compressed data
+def LES_CompressBlock(inData):
+	inSize = len(inData)
+	matchEndLimit = inSize - LES_COMPRESS_LAST_LITERALS
+	matchStartLimit = inSize - LES_COMPRESS_MATCH_FIND_LIMIT
+	lastPositions = {}
+	outData = []
+	anchor = 0
+	i = 0
+	while i < matchStartLimit:
+		sequence = inData[i:i+LES_COMPRESS_MIN_MATCH]
+		ref = lastPositions.get(sequence, -1)
+		lastPositions[sequence] = i
+		if (ref < 0) or ((i - ref) > LES_COMPRESS_MAX_OFFSET):
+			i += 1
+			continue
+		matchLength = LES_COMPRESS_MIN_MATCH
+		while ((i + matchLength) < matchEndLimit) and (inData[ref + matchLength] == inData[i + matchLength]):
+			matchLength += 1
+		__WriteSequence__(outData, inData[anchor:i], i - ref, matchLength)
+		i += matchLength
+		anchor = i
+	__WriteSequence__(outData, inData[anchor:inSize], 0, 0)
+	return "".join(outData)
+
+# Returns None if the compressed data is invalid or doesn't decompress to maxOutSize bytes or less
+def LES_DecompressBlock(inData, maxOutSize):
+	inSize = len(inData)
+	outData = bytearray()
+	i = 0
+	while i < inSize:
+		token = ord(inData[i])
+		i += 1
+		numLiterals = token >> 4
+		if numLiterals == LES_COMPRESS_LENGTH_MASK:
+			byte = 255
+			while byte == 255:
+				if (i >= inSize) or (numLiterals > maxOutSize):
+					return None
+				byte = ord(inData[i])
+				i += 1
+				numLiterals += byte
+		if ((i + numLiterals) > inSize) or ((len(outData) + numLiterals) > maxOutSize):
+			return None
+		outData.extend(inData[i:i+numLiterals])
+		i += numLiterals
+		if i == inSize:
+			break
+		if (i + 2) > inSize:
+			return None
+		offset = ord(inData[i]) | (ord(inData[i+1]) << 8)
+		i += 2
+		if (offset == 0) or (offset > len(outData)):
+			return None
+		matchLength = token & LES_COMPRESS_LENGTH_MASK
+		if matchLength == LES_COMPRESS_LENGTH_MASK:
+			byte = 255
+			while byte == 255:
+				if (i >= inSize) or (matchLength > maxOutSize):
+					return None
+				byte = ord(inData[i])
+				i += 1
+				matchLength += byte
+		matchLength += LES_COMPRESS_MIN_MATCH
+		if (len(outData) + matchLength) > maxOutSize:
+			return None
+		# The match can overlap the output it is copied to
+		start = len(outData) - offset
+		for m in range(matchLength):
+			outData.append(outData[start + m])
+	return str(outData)
+
+def runTest():
+	les_logger.Init()
+	testData = [ "", "a", "abcdefghijklmnop", "jake" * 100, "".join([chr(i & 0xFF) for i in range(1000)]) + ("rowan" * 300) ]
+	for inData in testData:
+		compressedData = LES_CompressBlock(inData)
+		outData = LES_DecompressBlock(compressedData, len(inData))
+		les_logger.Log("Compress %d -> %d", len(inData), len(compressedData))
+		if outData != inData:
+			les_logger.Error("LES_DecompressBlock doesn't match input size:%d", len(inData))
+
+if __name__ == '__main__':
+	runTest()
@@ -11,8 +11,11 @@
 #include "les_typedata.h"
 #include "les_structdata.h"
 #include "les_funcdata.h"
+#include "les_hashdata.h"
 #include "les_time.h"
 #include "les_network.h"
+#include "les_endianswap.h"
+#include "les_hashindex.h"
 
 static LES_StringEntry* les_stringEntryArray = LES_NULL;
 static int les_numStringEntries = 0;
@@ -22,33 +25,46 @@ static LES_DefinitionFile les_definitionFile;
 static const LES_StringTable* les_pStringTable = LES_NULL;
 static int les_stringTableNumStrings = 0;
 
+/* Perfect hash of the definition file string table : NULL if the definition file doesn't have one */
+static const LES_HashTable* les_pStringTableHashTable = LES_NULL;
+
+/* String entry IDs by hash : the internal list and the definition file string table if it isn't perfect hashed */
+static LES_HashIndex les_stringEntryIndex;
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Internal Static functions
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-static int LES_GetStringEntrySlow(const LES_Hash hash, const char* const str)
+static int LES_GetStringTableIndex(const LES_Hash hash)
 {
-	if (les_pStringTable)
+	if (les_pStringTableHashTable == LES_NULL)
 	{
-		const int index = les_pStringTable->GetStringEntrySlow(hash, str);
-		if (index >= 0)
-		{
-			return index;
-		}
+		return -1;
 	}
-	/* This is horribly slow - need hash lookup table */
-	const int numStrings = les_numStringEntries;
-	for (int i = 0; i < numStrings; i++)
+	const int index = les_pStringTableHashTable->Find(hash);
+	if (les_pStringTable->GetStringEntry(index)->m_hash != hash)
+	{
+		return -1;
+	}
+	return index;
+}
+
+static int LES_FindStringEntry(const LES_Hash hash, const char* const str)
+{
+	const int index = LES_GetStringTableIndex(hash);
+	if ((index >= 0) && (strcmp(LES_GetStringEntryForID(index)->m_str, str) == 0))
+	{
+		return index;
+	}
+	int slot;
+	for (int id = les_stringEntryIndex.Find(hash, &slot); id >= 0; id = les_stringEntryIndex.FindNext(hash, &slot))
 	{
-		const LES_StringEntry* const pStringEntry = &les_stringEntryArray[i];
-		if (pStringEntry->m_hash == hash)
+		const LES_StringEntry* const pStringEntry = LES_GetStringEntryForID(id);
+		if (strcmp(pStringEntry->m_str, str) == 0)
 		{
-			if (strcmp(pStringEntry->m_str, str) == 0)
-			{
-				return (i + les_stringTableNumStrings);
-			}
+			return id;
 		}
 	}
 	return -1;
@@ -57,26 +73,9 @@ static int LES_GetStringEntrySlow(const LES_Hash hash, const char* const str)
 /* str - must not be from the stack, must be global so the ptr can just be copied */
 static int LES_AddStringEntry(const LES_Hash hash, const char* const str)
 {
-	int index = LES_GetStringEntrySlow(hash, str);
+	int index = LES_FindStringEntry(hash, str);
 	if (index >= 0)
 	{
-		if (les_pStringTable)
-		{
-			const int i = les_pStringTable->GetStringEntrySlow(hash, str);
-			const LES_StringEntry* const pStringEntry = les_pStringTable->GetStringEntry(i);
-			if (pStringEntry->m_hash != hash)
-			{
-				LES_FATAL_ERROR("LES_AddStringEntry '%s' 0x%X hash doesn't match entry in string table definition file Existing:'%s' 0x%X", 
-												str, hash, pStringEntry->m_str, pStringEntry->m_hash);
-				return LES_RETURN_ERROR;
-			}
-			if (strcmp(pStringEntry->m_str, str) != 0)
-			{
-				LES_FATAL_ERROR("LES_AddStringEntry '%s' 0x%X string doesn't match entry in string table definition file Existing:'%s' 0x%X", 
-												str, hash, pStringEntry->m_str, pStringEntry->m_hash);
-				return LES_RETURN_ERROR;
-			}
-		}
 		return index;
 	}
 
@@ -93,15 +92,29 @@ static int LES_AddStringEntry(const LES_Hash hash, const char* const str)
 	pStringEntry->m_str = str;
 	les_numStringEntries++;
 	index += les_stringTableNumStrings;
+	les_stringEntryIndex.Add(hash, index);
 
 	return index;
 }
 
-static void LES_SetStringTablePtr(const LES_StringTable* const pStringTable)
+static void LES_SetStringTablePtr(const LES_StringTable* const pStringTable, const LES_HashTable* const pHashTable)
 {
 	les_pStringTable = pStringTable;
 	const int numStrings = pStringTable->GetNumStrings();
 	les_stringTableNumStrings = numStrings;
+	les_pStringTableHashTable = pHashTable;
+
+	/* The internal list is empty when the definition file is set */
+	les_stringEntryIndex.Clear();
+	if (pHashTable)
+	{
+		return;
+	}
+	les_stringEntryIndex.Reserve(numStrings + 1024);
+	for (int i = 0; i < numStrings; i++)
+	{
+		les_stringEntryIndex.Add(pStringTable->GetStringEntry(i)->m_hash, i);
+	}
 }
 
 static void LES_DebugOutputStringEntry(LES_LoggerChannel* const pLogChannel, const LES_StringEntry* const pStringEntry, const int i)
@@ -124,9 +137,12 @@ extern void LES_TypeShutdown();
 extern void LES_StructInit();
 extern void LES_StructShutdown();
 
-extern void LES_Type_SetTypeDataPtr(const LES_TypeData* const pTypeData);
-extern void LES_Struct_SetStructDataPtr(const LES_StructData* const pStructData);
-extern void LES_Function_SetFuncDataPtr(const LES_FuncData* const pFuncData);
+extern void LES_ParameterPoolInit();
+extern void LES_ParameterPoolShutdown();
+
+extern void LES_Type_SetTypeDataPtr(const LES_TypeData* const pTypeData, const LES_HashTable* const pHashTable);
+extern void LES_Struct_SetStructDataPtr(const LES_StructData* const pStructData, const LES_HashTable* const pHashTable);
+extern void LES_Function_SetFuncDataPtr(const LES_FuncData* const pFuncData, const LES_HashTable* const pHashTable);
 
 extern void LES_DebugOutputTypeEntry(LES_LoggerChannel* const pLogChannel, const LES_TypeEntry* const pTypeEntry, const int i);
 extern void LES_DebugOutputStructDefinition(LES_LoggerChannel* const pLogChannel, 
@@ -138,9 +154,13 @@ void LES_Init(void)
 {
 	les_stringEntryArray = new LES_StringEntry[1024];
 	les_numStringEntries = 0;
+	les_stringEntryIndex.Clear();
+	les_stringEntryIndex.Reserve(1024);
 
 	LES_GetElapsedTimeTicks();
+	LES_EndianSwapInit();
 
+	LES_ParameterPoolInit();
 	LES_FunctionInit();
 	LES_TypeInit();
 	LES_StructInit();
@@ -155,9 +175,11 @@ void LES_Shutdown(void)
 	LES_StructShutdown();
 	LES_TypeShutdown();
 	LES_FunctionShutdown();
+	LES_ParameterPoolShutdown();
 
 	les_numStringEntries = 0;
 	delete[] les_stringEntryArray;
+	les_stringEntryIndex.Free();
 }
 
 const LES_StringEntry* LES_GetStringEntryForID(const int id)
@@ -181,32 +203,19 @@ const LES_StringEntry* LES_GetStringEntryForID(const int id)
 const LES_StringEntry* LES_GetStringEntry(const char* const str)
 {
 	const LES_Hash hash = LES_GenerateHashCaseSensitive(str);
-	const int index = LES_GetStringEntrySlow(hash, str);
+	const int index = LES_FindStringEntry(hash, str);
 	return LES_GetStringEntryForID(index);
 }
 
 const LES_StringEntry* LES_GetStringEntryByHash(const unsigned int hash)
 {
-	if (les_pStringTable)
-	{
-		const LES_StringEntry* const pStringTableEntry = les_pStringTable->GetStringEntryByHash(hash);
-		if (pStringTableEntry)
-		{
-			return pStringTableEntry;
-		}
-	}
-
-	/* This is horribly slow - need hash lookup table */
-	const int numStrings = les_numStringEntries;
-	for (int i = 0; i < numStrings; i++)
+	int id = LES_GetStringTableIndex(hash);
+	if (id < 0)
 	{
-		const LES_StringEntry* const pStringEntry = &les_stringEntryArray[i];
-		if (pStringEntry->m_hash == hash)
-		{
-			return pStringEntry;
-		}
+		int slot;
+		id = les_stringEntryIndex.Find(hash, &slot);
 	}
-	return LES_NULL;
+	return LES_GetStringEntryForID(id);
 }
 
 int LES_SetGlobalDefinitionFile(const void* definitionFileData, const int fileDataSize)
@@ -223,17 +232,28 @@ int LES_SetGlobalDefinitionFile(const void* definitionFileData, const int fileDa
 		return LES_RETURN_ERROR;
 	}
 
+	/* Older definition files don't have the hash data : the registries build their own indexes */
+	const LES_HashData* const pHashData = les_definitionFile.GetHashData();
+
 	const LES_StringTable* const pStringTable = les_definitionFile.GetStringTable();
-	LES_SetStringTablePtr(pStringTable);
+	const LES_HashTable* const pStringHashTable = pHashData ? 
+												pHashData->GetHashTable(LES_HASHDATA_STRINGTABLE, pStringTable->GetNumStrings()) : LES_NULL;
+	LES_SetStringTablePtr(pStringTable, pStringHashTable);
 
 	const LES_TypeData* const pTypeData = les_definitionFile.GetTypeData();
-	LES_Type_SetTypeDataPtr(pTypeData);
+	const LES_HashTable* const pTypeHashTable = pHashData ? 
+												pHashData->GetHashTable(LES_HASHDATA_TYPEDATA, pTypeData->GetNumTypes()) : LES_NULL;
+	LES_Type_SetTypeDataPtr(pTypeData, pTypeHashTable);
 
 	const LES_StructData* const pStructData = les_definitionFile.GetStructData();
-	LES_Struct_SetStructDataPtr(pStructData);
+	const LES_HashTable* const pStructHashTable = pHashData ? 
+												pHashData->GetHashTable(LES_HASHDATA_STRUCTDATA, pStructData->GetNumStructDefinitions()) : LES_NULL;
+	LES_Struct_SetStructDataPtr(pStructData, pStructHashTable);
 
 	const LES_FuncData* const pFuncData = les_definitionFile.GetFuncData();
-	LES_Function_SetFuncDataPtr(pFuncData);
+	const LES_HashTable* const pFuncHashTable = pHashData ? 
+												pHashData->GetHashTable(LES_HASHDATA_FUNCTIONDATA, pFuncData->GetNumFunctionDefinitions()) : LES_NULL;
+	LES_Function_SetFuncDataPtr(pFuncData, pFuncHashTable);
 
 	return LES_RETURN_OK;
 }
@@ -319,7 +339,13 @@ int LES_AddStringEntry(const char* const str)
 
 int LES_GetStringEntryID(const LES_Hash hash, const char* const str)
 {
-	const int index = LES_GetStringEntrySlow(hash, str);
+	const int index = LES_FindStringEntry(hash, str);
 	return index;
 }
 
+/* The string table strings and the internal strings : IDs are 0 to LES_GetNumStringEntries()-1 */
+int LES_GetNumStringEntries(void)
+{
+	return les_stringTableNumStrings + les_numStringEntries;
+}
+
@@ -11,20 +11,146 @@
 #include "les_function.h"
 #include "les_networkmessage.h"
 #include "les_stringentry.h"
+#include "les_parameter.h"
+#include "les_completionqueue.h"
+#include "les_time.h"
+#include "les_parameterplan.h"
+#include "les_tcpsocket.h"
+#include "les_parameterpool.h"
+
+/* The LES_COREENGINE_NEGOTIATE_* settings are the defaults for LES_CoreEngineSetConnectOptions */
+
+/* Set to 0 to always send parameter data big endian : the connect message won't offer native endian */
+#ifndef LES_COREENGINE_NEGOTIATE_NATIVE_ENDIAN
+#define LES_COREENGINE_NEGOTIATE_NATIVE_ENDIAN 1
+#endif // #ifndef LES_COREENGINE_NEGOTIATE_NATIVE_ENDIAN
+
+/* Set to 1 to offer varint encoded integer parameter data in the connect message : see les_varint.h */
+#ifndef LES_COREENGINE_NEGOTIATE_VARINT
+#define LES_COREENGINE_NEGOTIATE_VARINT 0
+#endif // #ifndef LES_COREENGINE_NEGOTIATE_VARINT
+
+/* Set to 0 to never compress large message payloads : the connect message won't offer compression */
+#ifndef LES_COREENGINE_NEGOTIATE_COMPRESSION
+#define LES_COREENGINE_NEGOTIATE_COMPRESSION 1
+#endif // #ifndef LES_COREENGINE_NEGOTIATE_COMPRESSION
 
 static int les_state = LES_STATE_UNKNOWN;
+// What the next connect message offers the server
+static bool les_connectNativeEndian = (LES_COREENGINE_NEGOTIATE_NATIVE_ENDIAN != 0);
+static bool les_connectVarint = (LES_COREENGINE_NEGOTIATE_VARINT != 0);
+static bool les_connectCompression = (LES_COREENGINE_NEGOTIATE_COMPRESSION != 0);
+// LES_CoreEngineTick calls the main thread message handlers : they mustn't tick or wait for an RPC
+static bool les_inTick = false;
 static LES_uint32 les_correctResponseHash;
 static LES_uint16 les_functionID;
 
+/* Each record sent from its parameter block is two segments : the message memory before it & the parameter data */
+#define LES_FUNCTIONRPC_BATCH_MAX_NUM_REFERENCES ((LES_TCPSOCKET_MAX_NUM_SEGMENTS - 1) / 2)
+
+// The record headers & delta records : the keyframe records' parameter data is sent from the parameter blocks
+// Owned by the network queue once the batch has been flushed : released by the main thread once it has been sent
+struct LES_FunctionRPCBatchMessage
+{
+	LES_NetworkMessage* m_message;
+	int m_numReferences;
+	LES_NetworkSendReference m_references[LES_FUNCTIONRPC_BATCH_MAX_NUM_REFERENCES];
+	LES_FunctionParameterData* m_parameterData[LES_FUNCTIONRPC_BATCH_MAX_NUM_REFERENCES];
+};
+
+struct LES_FunctionRPCBatch
+{
+	LES_FunctionRPCBatchMessage* m_batchMessage;
+	int m_maxPayloadSize;
+	int m_payloadSize;
+	int m_numReferencedBytes;
+	LES_uint32 m_numRecords;
+	LES_uint16 m_id;
+};
+
+static LES_FunctionRPCBatch les_functionRPCBatch;
+
+// The last parameter data sent for a function with delta encoding enabled : LES_NULL until its first keyframe
+struct LES_FunctionRPCDelta
+{
+	LES_Hash m_functionNameHash;
+	char* m_lastParameterData;
+	int m_lastParameterDataSize;
+	int m_numDeltasSinceKeyframe;
+	int m_numKeyframes;
+	int m_numDeltas;
+};
+
+static LES_FunctionRPCDelta les_functionRPCDeltas[LES_COREENGINE_MAX_NUM_DELTA_FUNCTIONS];
+static int les_numFunctionRPCDeltas;
+
+struct LES_FunctionRPCPending
+{
+	LES_uint32 m_correlationID;
+	int m_state;
+	LES_int32 m_result;
+	int m_definitionGeneration;
+	int m_numOutputs;
+	LES_FunctionRPCOutput m_outputs[LES_MAX_NUM_FUNCTION_PARAMS];
+};
+
+// Filled by the network thread as results arrive, emptied by the main thread which frees m_outputData
+struct LES_FunctionRPCCompletion
+{
+	LES_uint32 m_correlationID;
+	LES_int32 m_result;
+	char* m_outputData;
+	int m_outputDataSize;
+};
+
+#ifndef LES_COREENGINE_COMPLETION_QUEUE_SIZE
+#define LES_COREENGINE_COMPLETION_QUEUE_SIZE (1024)
+#endif // #ifndef LES_COREENGINE_COMPLETION_QUEUE_SIZE
+
+typedef LES_CompletionQueue<LES_FunctionRPCCompletion, LES_COREENGINE_COMPLETION_QUEUE_SIZE> LES_FunctionRPCCompletionQueue;
+
+static LES_uint32 les_functionRPCCorrelationID;
+static LES_FunctionRPCPending les_functionRPCPending[LES_COREENGINE_MAX_NUM_PENDING_RPCS];
+static LES_FunctionRPCCompletionQueue les_functionRPCCompletionQueue;
+
 #define LES_NETMESSAGE_SEND_ID_CONNECT (0x1)
 #define LES_NETMESSAGE_SEND_ID_GETDEFINITIONFILE (0x3)
 #define LES_NETMESSAGE_SEND_ID_FUNCTIONRPC (0x5)
+#define LES_NETMESSAGE_SEND_ID_FUNCTIONRPC_BATCH (0x7)
+#define LES_NETMESSAGE_SEND_ID_FUNCTIONRPC_DELTA (0x9)
 #define LES_NETMESSAGE_SEND_ID_TEST (0xF1)
 
 #define LES_NETMESSAGE_RECV_ID_CONNECT_RESPONSE (0x2)
 #define LES_NETMESSAGE_RECV_ID_GETDEFINITIONFILE_RESPONSE (0x4)
 #define LES_NETMESSAGE_RECV_ID_FUNCTIONRPC_RESPONSE (0x6)
 #define LES_NETMESSAGE_RECV_ID_TEST_RESPONSE (0xF2)
+#define LES_NETMESSAGE_RECV_ID_FUNCTIONRPC_RESULT (0x1000 + LES_NETMESSAGE_SEND_ID_FUNCTIONRPC)
+
+/* numRecords */
+#define LES_FUNCTIONRPC_BATCH_HEADER_SIZE (4)
+/* functionNameID, correlationID, parameterDataSize */
+#define LES_FUNCTIONRPC_BATCH_RECORD_HEADER_SIZE (12)
+/* correlationID, result, outputDataSize then the output parameter data */
+#define LES_FUNCTIONRPC_RESULT_HEADER_SIZE (12)
+/* parameterDataSize then the changed byte bitmap */
+#define LES_FUNCTIONRPC_DELTA_HEADER_SIZE (4)
+
+/* 
+ * Connect : 16 character challenge then the client byte order marker written in the client byte order
+ * then optionally the big endian encoding flags the client supports
+ * Connect response : hash of the challenge then the parameter data byte order then the accepted encoding flags, all big endian
+ * Servers which don't understand the marker only send the hash : the parameter data stays big endian
+ * Servers which don't understand the encoding flags don't send them : the parameter data stays fixed width and uncompressed
+ * A marker of 0 offers no byte order : used to send the encoding flags without offering native endian
+*/
+#define LES_CONNECT_CHALLENGE_SIZE (16)
+#define LES_CONNECT_BYTEORDER_MARKER (0x01020304)
+#define LES_CONNECT_BYTEORDER_NONE (0)
+#define LES_CONNECT_BYTEORDER_BIG_ENDIAN (0)
+#define LES_CONNECT_BYTEORDER_NATIVE_ENDIAN (1)
+#define LES_CONNECT_ENCODING_VARINT (1 << 0)
+#define LES_CONNECT_ENCODING_COMPRESSION (1 << 1)
+#define LES_CONNECT_ENCODING_ALL (LES_CONNECT_ENCODING_VARINT | LES_CONNECT_ENCODING_COMPRESSION)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -32,6 +158,336 @@ static LES_uint16 les_functionID;
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+static void LES_FunctionRPCSentRelease(void* const releaseContext)
+{
+	LES_FunctionParameterData* const pFunctionParameterData = (LES_FunctionParameterData*)releaseContext;
+	LES_ReleaseFunctionParameterData(pFunctionParameterData);
+}
+
+static LES_FunctionRPCDelta* LES_FunctionRPCFindDelta(const LES_Hash functionNameHash)
+{
+	for (int i = 0; i < les_numFunctionRPCDeltas; i++)
+	{
+		LES_FunctionRPCDelta* const pDelta = &les_functionRPCDeltas[i];
+		if (pDelta->m_functionNameHash == functionNameHash)
+		{
+			return pDelta;
+		}
+	}
+	return LES_NULL;
+}
+
+// Keeps the enabled functions : the next call for each function is sent as a keyframe
+static void LES_FunctionRPCDeltaResetHistory(void)
+{
+	for (int i = 0; i < les_numFunctionRPCDeltas; i++)
+	{
+		LES_FunctionRPCDelta* const pDelta = &les_functionRPCDeltas[i];
+		free(pDelta->m_lastParameterData);
+		pDelta->m_lastParameterData = LES_NULL;
+		pDelta->m_lastParameterDataSize = 0;
+		pDelta->m_numDeltasSinceKeyframe = 0;
+	}
+}
+
+/* Returns the size of the delta data or -1 if the parameter data must be sent as a keyframe */
+static int LES_FunctionRPCDeltaGetSize(const LES_FunctionRPCDelta* const pDelta, 
+																			 const char* const parameterData, const int parameterDataSize)
+{
+	if ((pDelta == LES_NULL) || (pDelta->m_lastParameterData == LES_NULL))
+	{
+		return -1;
+	}
+	if ((pDelta->m_lastParameterDataSize != parameterDataSize) || 
+			(pDelta->m_numDeltasSinceKeyframe >= LES_COREENGINE_DELTA_KEYFRAME_INTERVAL))
+	{
+		return -1;
+	}
+	const char* const lastParameterData = pDelta->m_lastParameterData;
+	int numChangedBytes = 0;
+	for (int i = 0; i < parameterDataSize; i++)
+	{
+		numChangedBytes += (parameterData[i] != lastParameterData[i]);
+	}
+	const int deltaDataSize = LES_FUNCTIONRPC_DELTA_HEADER_SIZE + ((parameterDataSize + 7) >> 3) + numChangedBytes;
+	if (deltaDataSize >= parameterDataSize)
+	{
+		return -1;
+	}
+	return deltaDataSize;
+}
+
+static void LES_FunctionRPCDeltaEncode(const LES_FunctionRPCDelta* const pDelta, 
+																			 const char* const parameterData, const int parameterDataSize, char* const pDeltaData)
+{
+	const LES_uint32 bigParameterDataSize = toBigEndian32((LES_uint32)parameterDataSize);
+	memcpy(pDeltaData, &bigParameterDataSize, sizeof(LES_uint32));
+
+	const char* const lastParameterData = pDelta->m_lastParameterData;
+	unsigned char* const bitmap = (unsigned char*)(pDeltaData + LES_FUNCTIONRPC_DELTA_HEADER_SIZE);
+	const int bitmapSize = (parameterDataSize + 7) >> 3;
+	memset(bitmap, 0, (size_t)bitmapSize);
+	char* pChangedBytes = (char*)(bitmap + bitmapSize);
+	for (int i = 0; i < parameterDataSize; i++)
+	{
+		if (parameterData[i] != lastParameterData[i])
+		{
+			bitmap[i >> 3] = (unsigned char)(bitmap[i >> 3] | (1 << (i & 7)));
+			*pChangedBytes++ = parameterData[i];
+		}
+	}
+}
+
+// Must be called for every RPC sent for the function : it tracks what the server has
+static void LES_FunctionRPCDeltaSent(LES_FunctionRPCDelta* const pDelta, const char* const parameterData, 
+																		 const int parameterDataSize, const bool isKeyframe)
+{
+	if (pDelta == LES_NULL)
+	{
+		return;
+	}
+	if (pDelta->m_lastParameterDataSize != parameterDataSize)
+	{
+		free(pDelta->m_lastParameterData);
+		pDelta->m_lastParameterData = LES_NULL;
+	}
+	if (pDelta->m_lastParameterData == LES_NULL)
+	{
+		pDelta->m_lastParameterData = (char*)malloc((size_t)(parameterDataSize > 0 ? parameterDataSize : 1));
+	}
+	memcpy(pDelta->m_lastParameterData, parameterData, (size_t)parameterDataSize);
+	pDelta->m_lastParameterDataSize = parameterDataSize;
+	pDelta->m_numDeltasSinceKeyframe = isKeyframe ? 0 : (pDelta->m_numDeltasSinceKeyframe + 1);
+	pDelta->m_numKeyframes += isKeyframe ? 1 : 0;
+	pDelta->m_numDeltas += isKeyframe ? 0 : 1;
+}
+
+static int LES_FunctionRPCBatchRecordSize(const int parameterDataSize)
+{
+	return LES_FUNCTIONRPC_BATCH_RECORD_HEADER_SIZE + ((parameterDataSize + 3) & ~3);
+}
+
+static void LES_FunctionRPCBatchReset(void)
+{
+	LES_FunctionRPCBatch* const pBatch = &les_functionRPCBatch;
+	pBatch->m_batchMessage = LES_NULL;
+	pBatch->m_payloadSize = LES_FUNCTIONRPC_BATCH_HEADER_SIZE;
+	pBatch->m_numReferencedBytes = 0;
+	pBatch->m_numRecords = 0;
+}
+
+static void LES_FunctionRPCBatchSentRelease(void* const releaseContext)
+{
+	LES_FunctionRPCBatchMessage* const pBatchMessage = (LES_FunctionRPCBatchMessage*)releaseContext;
+	if (pBatchMessage == LES_NULL)
+	{
+		return;
+	}
+	for (int i = 0; i < pBatchMessage->m_numReferences; i++)
+	{
+		LES_ReleaseFunctionParameterData(pBatchMessage->m_parameterData[i]);
+	}
+	free(pBatchMessage->m_message);
+	free(pBatchMessage);
+}
+
+static int LES_FunctionRPCBatchAdd(const LES_uint32 functionNameID, const LES_uint32 correlationID,
+																	 LES_FunctionParameterData* const pFunctionParameterData, 
+																	 LES_FunctionRPCDelta* const pDelta)
+{
+	LES_FunctionRPCBatch* const pBatch = &les_functionRPCBatch;
+	const char* const parameterData = pFunctionParameterData->GetBufferPtr();
+	const int parameterDataSize = pFunctionParameterData->GetNumBytesWritten();
+	const int deltaDataSize = LES_FunctionRPCDeltaGetSize(pDelta, parameterData, parameterDataSize);
+	const bool isDelta = (deltaDataSize >= 0);
+	const int recordDataSize = isDelta ? deltaDataSize : parameterDataSize;
+	const int recordSize = LES_FunctionRPCBatchRecordSize(recordDataSize);
+	const bool isReferenced = (isDelta == false) && (recordDataSize > 0);
+	if (((pBatch->m_payloadSize + recordSize) > pBatch->m_maxPayloadSize) || 
+			(isReferenced && pBatch->m_batchMessage && 
+			 (pBatch->m_batchMessage->m_numReferences >= LES_FUNCTIONRPC_BATCH_MAX_NUM_REFERENCES)))
+	{
+		if (LES_CoreEngineFlushFunctionRPCBatch() != LES_RETURN_OK)
+		{
+			return LES_RETURN_ERROR;
+		}
+	}
+	LES_FunctionRPCBatchMessage* pBatchMessage = pBatch->m_batchMessage;
+	if (pBatchMessage == LES_NULL)
+	{
+		pBatchMessage = (LES_FunctionRPCBatchMessage*)malloc(sizeof(LES_FunctionRPCBatchMessage));
+		pBatchMessage->m_message = (LES_NetworkMessage*)malloc(LES_NetworkMessageSize(pBatch->m_maxPayloadSize));
+		pBatchMessage->m_numReferences = 0;
+		pBatch->m_batchMessage = pBatchMessage;
+	}
+
+	// The message memory doesn't have the referenced parameter data in it
+	const int messageOffset = LES_NETWORK_MESSAGE_HEADER_SIZE + pBatch->m_payloadSize - pBatch->m_numReferencedBytes;
+	char* const pRecord = (char*)(pBatchMessage->m_message) + messageOffset;
+	const LES_uint32 recordSizeField = (LES_uint32)recordDataSize | (isDelta ? LES_FUNCTIONRPC_BATCH_RECORD_DELTA : 0);
+	const LES_uint32 recordHeader[3] = { toBigEndian32(functionNameID), toBigEndian32(correlationID), 
+																			 toBigEndian32(recordSizeField) };
+	memcpy(pRecord, recordHeader, LES_FUNCTIONRPC_BATCH_RECORD_HEADER_SIZE);
+	char* pRecordData = pRecord + LES_FUNCTIONRPC_BATCH_RECORD_HEADER_SIZE;
+	if (isDelta)
+	{
+		LES_FunctionRPCDeltaEncode(pDelta, parameterData, parameterDataSize, pRecordData);
+		pRecordData += recordDataSize;
+	}
+	else if (isReferenced)
+	{
+		// Sent from the parameter block : it is kept until the batch has been sent
+		const int referenceIndex = pBatchMessage->m_numReferences;
+		LES_NetworkSendReference* const reference = &pBatchMessage->m_references[referenceIndex];
+		reference->m_offset = messageOffset + LES_FUNCTIONRPC_BATCH_RECORD_HEADER_SIZE;
+		reference->m_size = recordDataSize;
+		reference->m_data = parameterData;
+		pBatchMessage->m_parameterData[referenceIndex] = pFunctionParameterData;
+		pBatchMessage->m_numReferences++;
+		LES_AddRefFunctionParameterData(pFunctionParameterData);
+		pBatch->m_numReferencedBytes += recordDataSize;
+	}
+	memset(pRecordData, 0, (size_t)(((recordDataSize + 3) & ~3) - recordDataSize));
+	pBatch->m_payloadSize += recordSize;
+	pBatch->m_numRecords++;
+	LES_FunctionRPCDeltaSent(pDelta, parameterData, parameterDataSize, !isDelta);
+	return LES_RETURN_OK;
+}
+
+static LES_uint32 LES_FunctionRPCNewCorrelationID(void)
+{
+	les_functionRPCCorrelationID++;
+	if (les_functionRPCCorrelationID == LES_FUNCTIONRPC_INVALID_HANDLE)
+	{
+		les_functionRPCCorrelationID++;
+	}
+	return les_functionRPCCorrelationID;
+}
+
+static LES_FunctionRPCPending* LES_FunctionRPCGetPending(const LES_uint32 correlationID)
+{
+	return &les_functionRPCPending[correlationID & (LES_COREENGINE_MAX_NUM_PENDING_RPCS - 1)];
+}
+
+static void LES_FunctionRPCAddPending(const LES_uint32 correlationID)
+{
+	LES_FunctionRPCPending* const pPending = LES_FunctionRPCGetPending(correlationID);
+	if (pPending->m_state == LES_FUNCTIONRPC_PENDING)
+	{
+		LES_WARNING("Function RPC handle:%u result lost : more than %d RPCs pending", 
+								pPending->m_correlationID, LES_COREENGINE_MAX_NUM_PENDING_RPCS);
+	}
+	pPending->m_correlationID = correlationID;
+	pPending->m_state = LES_FUNCTIONRPC_PENDING;
+	pPending->m_result = 0;
+	pPending->m_numOutputs = 0;
+}
+
+static void LES_FunctionRPCResetPending(void)
+{
+	for (int i = 0; i < LES_COREENGINE_MAX_NUM_PENDING_RPCS; i++)
+	{
+		LES_FunctionRPCPending* const pPending = &les_functionRPCPending[i];
+		pPending->m_correlationID = LES_FUNCTIONRPC_INVALID_HANDLE;
+		pPending->m_state = LES_FUNCTIONRPC_INVALID;
+		pPending->m_result = 0;
+		pPending->m_numOutputs = 0;
+	}
+}
+
+static void LES_FunctionRPCWriteOutputs(const LES_FunctionRPCPending* const pPending, 
+																				const char* const outputData, const int outputDataSize)
+{
+	const int numOutputs = pPending->m_numOutputs;
+	if (numOutputs == 0)
+	{
+		return;
+	}
+	// The plan ops belong to the function definitions
+	if (pPending->m_definitionGeneration != LES_GetFunctionDefinitionGeneration())
+	{
+		LES_WARNING("Function RPC handle:%u outputs not written : function definitions have changed", pPending->m_correlationID);
+		return;
+	}
+	int offset = 0;
+	for (int i = 0; i < numOutputs; i++)
+	{
+		const LES_FunctionRPCOutput* const pOutput = &pPending->m_outputs[i];
+		const int numBytesRead = LES_ReadPlan(pOutput->m_ops, pOutput->m_numOps, outputData + offset, outputDataSize - offset, 
+																					pOutput->m_destination);
+		if (numBytesRead < 0)
+		{
+			LES_WARNING("Function RPC handle:%u output:%d failed to decode outputDataSize:%d", 
+									pPending->m_correlationID, i, outputDataSize);
+			return;
+		}
+		offset += numBytesRead;
+	}
+	if (offset != outputDataSize)
+	{
+		LES_WARNING("Function RPC handle:%u outputDataSize:%d doesn't match the output parameters size:%d", 
+								pPending->m_correlationID, outputDataSize, offset);
+	}
+}
+
+static void LES_FunctionRPCProcessCompletions(void)
+{
+	LES_FunctionRPCCompletion completion;
+	while (les_functionRPCCompletionQueue.Pop(&completion))
+	{
+		// Results for calls without a handle or whose entry has been reused are ignored
+		LES_FunctionRPCPending* const pPending = LES_FunctionRPCGetPending(completion.m_correlationID);
+		if ((pPending->m_correlationID == completion.m_correlationID) && (pPending->m_state == LES_FUNCTIONRPC_PENDING))
+		{
+			LES_FunctionRPCWriteOutputs(pPending, completion.m_outputData, completion.m_outputDataSize);
+			pPending->m_state = LES_FUNCTIONRPC_COMPLETE;
+			pPending->m_result = completion.m_result;
+		}
+		free(completion.m_outputData);
+	}
+}
+
+// Called on the network thread : it must only touch the completion queue
+static int LES_FunctionRPCResultMessageHandler(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, void* payload)
+{
+	if (type != LES_NETMESSAGE_RECV_ID_FUNCTIONRPC_RESULT)
+	{
+		LES_ERROR("FunctionRPCResult wrong type:%d", type);
+		return LES_RETURN_ERROR;
+	}
+	if (payloadSize < LES_FUNCTIONRPC_RESULT_HEADER_SIZE)
+	{
+		LES_ERROR("FunctionRPCResult id:%d wrong payloadSize:%d", id, payloadSize);
+		return LES_RETURN_ERROR;
+	}
+	LES_uint32 bigResult[3];
+	memcpy(bigResult, payload, sizeof(bigResult));
+	const LES_uint32 outputDataSize = fromBigEndian32(bigResult[2]);
+	if (outputDataSize > (payloadSize - LES_FUNCTIONRPC_RESULT_HEADER_SIZE))
+	{
+		LES_ERROR("FunctionRPCResult id:%d outputDataSize:%d too big payloadSize:%d", id, outputDataSize, payloadSize);
+		return LES_RETURN_ERROR;
+	}
+	LES_FunctionRPCCompletion completion;
+	completion.m_correlationID = fromBigEndian32(bigResult[0]);
+	completion.m_result = (LES_int32)fromBigEndian32(bigResult[1]);
+	completion.m_outputData = LES_NULL;
+	completion.m_outputDataSize = (int)outputDataSize;
+	// The payload is only valid during the call
+	if (outputDataSize > 0)
+	{
+		completion.m_outputData = (char*)malloc(outputDataSize);
+		memcpy(completion.m_outputData, (const char*)payload + LES_FUNCTIONRPC_RESULT_HEADER_SIZE, outputDataSize);
+	}
+	if (les_functionRPCCompletionQueue.Push(&completion) == LES_RETURN_ERROR)
+	{
+		LES_ERROR("FunctionRPCResult correlationID:%u completion queue full", completion.m_correlationID);
+		free(completion.m_outputData);
+		return LES_RETURN_ERROR;
+	}
+	return LES_RETURN_OK;
+}
+
 static int LES_TestResponseMessageHandler(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, void* payload)
 {
 	LES_LOG("Received Message type:0x%X id:0x%X payloadSize:%d payload:'%s'", type, id, payloadSize, (char*)payload);
@@ -50,20 +506,41 @@ static int LES_ConnectResponseMessageHandler(const LES_uint16 type, const LES_ui
 		LES_ERROR("ConnectResponse wrong id:%d", id);
 		return LES_RETURN_ERROR;
 	}
-	if (payloadSize != 4)
+	if ((payloadSize != 4) && (payloadSize != 8) && (payloadSize != 12))
 	{
 		LES_ERROR("ConnectResponse wrong payloadSize:%d", payloadSize);
 		return LES_RETURN_ERROR;
 	}
-	LES_uint32 bigResponseHash;
-	memcpy(&bigResponseHash, payload, sizeof(LES_uint32));
-	const LES_uint32 responseHash = fromBigEndian32(bigResponseHash);
+	LES_uint32 bigResponse[3];
+	bigResponse[1] = toBigEndian32((LES_uint32)LES_CONNECT_BYTEORDER_BIG_ENDIAN);
+	bigResponse[2] = toBigEndian32((LES_uint32)0);
+	memcpy(bigResponse, payload, payloadSize);
+	const LES_uint32 responseHash = fromBigEndian32(bigResponse[0]);
 	LES_LOG("responseHash:0x%X", responseHash);
 	if (responseHash != les_correctResponseHash)
 	{
 		LES_ERROR("ConnectResponse wrong responseHash:0x%X Expected:0x%X", responseHash, les_correctResponseHash);
 		return LES_RETURN_ERROR;
 	}
+	const LES_uint32 byteOrder = fromBigEndian32(bigResponse[1]);
+	if ((byteOrder != LES_CONNECT_BYTEORDER_BIG_ENDIAN) && (byteOrder != LES_CONNECT_BYTEORDER_NATIVE_ENDIAN))
+	{
+		LES_ERROR("ConnectResponse unknown byteOrder:%d", byteOrder);
+		return LES_RETURN_ERROR;
+	}
+	const LES_uint32 encodingFlags = fromBigEndian32(bigResponse[2]);
+	if (encodingFlags & ~(LES_uint32)LES_CONNECT_ENCODING_ALL)
+	{
+		LES_ERROR("ConnectResponse unknown encodingFlags:0x%X", encodingFlags);
+		return LES_RETURN_ERROR;
+	}
+	LES_SetParameterDataNativeEndian(byteOrder == LES_CONNECT_BYTEORDER_NATIVE_ENDIAN);
+	LES_SetParameterDataVarint((encodingFlags & LES_CONNECT_ENCODING_VARINT) != 0);
+	LES_NetworkSetSendCompression((encodingFlags & LES_CONNECT_ENCODING_COMPRESSION) != 0);
+	LES_LOG("ConnectResponse parameter data byteOrder:%s integers:%s compression:%s", 
+					(byteOrder == LES_CONNECT_BYTEORDER_NATIVE_ENDIAN) ? "native" : "big endian",
+					LES_IsParameterDataVarint() ? "varint" : "fixed width",
+					(encodingFlags & LES_CONNECT_ENCODING_COMPRESSION) ? "on" : "off");
 
 	les_state = LES_STATE_CONNECTED;
 	return LES_RETURN_OK;
@@ -107,15 +584,38 @@ void LES_CoreEngineInit(void)
 {
 	les_state = LES_STATE_BOOT;
 	les_functionID = 0;
+	les_functionRPCCorrelationID = LES_FUNCTIONRPC_INVALID_HANDLE;
+	LES_FunctionRPCResetPending();
+	les_functionRPCCompletionQueue.Reset();
+	les_functionRPCBatch.m_maxPayloadSize = 0;
+	les_functionRPCBatch.m_id = 0;
+	LES_FunctionRPCBatchReset();
+	LES_CoreEngineSetFunctionRPCBatchSize(LES_COREENGINE_DEFAULT_RPC_BATCH_SIZE);
+	les_numFunctionRPCDeltas = 0;
 }
 
 void LES_CoreEngineShutdown(void)
 {
+	LES_FunctionRPCCompletion completion;
+	while (les_functionRPCCompletionQueue.Pop(&completion))
+	{
+		free(completion.m_outputData);
+	}
+	LES_FunctionRPCBatchSentRelease(les_functionRPCBatch.m_batchMessage);
+	LES_FunctionRPCBatchReset();
+	LES_FunctionRPCDeltaResetHistory();
+	les_numFunctionRPCDeltas = 0;
 }
 
-int LES_CoreEngineTick(void)
+static int LES_CoreEngineTickState(void)
 {
+	// Send the RPCs batched since the last tick
+	if (LES_CoreEngineFlushFunctionRPCBatch() != LES_RETURN_OK)
+	{
+		LES_ERROR("LES_CoreEngineTick: error sending function RPC batch");
+	}
 	LES_NetworkTick();
+	LES_FunctionRPCProcessCompletions();
 	const int currentState = les_state;
 
 	if (currentState == LES_STATE_BOOT)
@@ -127,6 +627,7 @@ int LES_CoreEngineTick(void)
 			LES_NetworkRegisterReceivedMessageHandler(LES_NETMESSAGE_RECV_ID_TEST_RESPONSE, LES_TestResponseMessageHandler);
 			LES_NetworkRegisterReceivedMessageHandler(LES_NETMESSAGE_RECV_ID_CONNECT_RESPONSE, LES_ConnectResponseMessageHandler);
 			LES_NetworkRegisterReceivedMessageHandler(LES_NETMESSAGE_RECV_ID_GETDEFINITIONFILE_RESPONSE, LES_GetDefinitionFileResponseMessageHandler);
+			LES_NetworkRegisterReceivedMessageThreadHandler(LES_NETMESSAGE_RECV_ID_FUNCTIONRPC_RESULT, LES_FunctionRPCResultMessageHandler);
 			les_state = LES_STATE_NOT_CONNECTED;
 			return LES_COREENGINE_OK;
 		}
@@ -140,9 +641,8 @@ int LES_CoreEngineTick(void)
 	{
 		const LES_uint16 type = LES_NETMESSAGE_SEND_ID_CONNECT;
 		const LES_uint16 id = 234;
-		const LES_uint32 payloadSize = 16;
-		char payload[17];
-		for (LES_uint32 i = 0; i < payloadSize; i++)
+		char payload[LES_CONNECT_CHALLENGE_SIZE + 4 + 4];
+		for (LES_uint32 i = 0; i < LES_CONNECT_CHALLENGE_SIZE; i++)
 		{
 			char c = '0';
 			const int v = rand() % (10+26+26);
@@ -160,7 +660,29 @@ int LES_CoreEngineTick(void)
 			}
 			payload[i] = c;
 		}
-		payload[16] = '\0';
+		LES_uint32 payloadSize = LES_CONNECT_CHALLENGE_SIZE;
+		// Older servers only read the challenge : nothing is appended unless something is offered
+		const bool negotiateEncoding = les_connectVarint || les_connectCompression;
+		if (les_connectNativeEndian || negotiateEncoding)
+		{
+			const LES_uint32 byteOrderMarker = les_connectNativeEndian ? LES_CONNECT_BYTEORDER_MARKER : LES_CONNECT_BYTEORDER_NONE;
+			memcpy(payload + payloadSize, &byteOrderMarker, sizeof(byteOrderMarker));
+			payloadSize += (LES_uint32)sizeof(byteOrderMarker);
+		}
+		if (negotiateEncoding)
+		{
+			const LES_uint32 encodingFlags = (les_connectVarint ? LES_CONNECT_ENCODING_VARINT : 0) | 
+																			 (les_connectCompression ? LES_CONNECT_ENCODING_COMPRESSION : 0);
+			const LES_uint32 bigEncodingFlags = toBigEndian32(encodingFlags);
+			memcpy(payload + payloadSize, &bigEncodingFlags, sizeof(bigEncodingFlags));
+			payloadSize += (LES_uint32)sizeof(bigEncodingFlags);
+		}
+		/* Parameter data is big endian, fixed width & uncompressed until the server agrees otherwise */
+		LES_SetParameterDataNativeEndian(false);
+		LES_SetParameterDataVarint(false);
+		LES_NetworkSetSendCompression(false);
+		/* A new connection has no delta history : each function starts again with a keyframe */
+		LES_FunctionRPCDeltaResetHistory();
 		LES_NetworkSendItem sendItem;
 		sendItem.Create(type, id, payloadSize, payload);
 		if (LES_NetworkAddSendItem(&sendItem) == LES_RETURN_ERROR)
@@ -169,7 +691,10 @@ int LES_CoreEngineTick(void)
 			return LES_COREENGINE_ERROR;
 		}
 		les_state = LES_STATE_WAITING_FOR_CONNECT_RESPONSE;
-		les_correctResponseHash = LES_GenerateHashCaseSensitive(payload);
+		char challenge[LES_CONNECT_CHALLENGE_SIZE + 1];
+		memcpy(challenge, payload, LES_CONNECT_CHALLENGE_SIZE);
+		challenge[LES_CONNECT_CHALLENGE_SIZE] = '\0';
+		les_correctResponseHash = LES_GenerateHashCaseSensitive(challenge);
 		LES_LOG("connectHash:0x%X", les_correctResponseHash);
 		return LES_COREENGINE_OK;
 	}
@@ -179,6 +704,12 @@ int LES_CoreEngineTick(void)
 	}
 	else if (currentState == LES_STATE_CONNECTED)
 	{
+		// A reconnect keeps the definition file it already has
+		if (LES_IsGlobalDefinitionFileValid() == LES_RETURN_OK)
+		{
+			les_state = LES_STATE_READY;
+			return LES_COREENGINE_OK;
+		}
 		const LES_uint16 type = LES_NETMESSAGE_SEND_ID_GETDEFINITIONFILE;
 		const LES_uint16 id = 432;
 		LES_NetworkSendItem sendItem;
@@ -208,21 +739,74 @@ int LES_CoreEngineTick(void)
 	return LES_COREENGINE_ERROR;
 }
 
+int LES_CoreEngineTick(void)
+{
+	if (les_inTick)
+	{
+		LES_ERROR("LES_CoreEngineTick: called from inside LES_CoreEngineTick");
+		return LES_COREENGINE_ERROR;
+	}
+	les_inTick = true;
+	const int ret = LES_CoreEngineTickState();
+	les_inTick = false;
+	return ret;
+}
+
+bool LES_CoreEngineInTick(void)
+{
+	return les_inTick;
+}
+
 int LES_CoreEngineGetState(void)
 {
 	return les_state;
 }
 
+void LES_CoreEngineSetConnectOptions(const bool nativeEndian, const bool varint, const bool compression)
+{
+	les_connectNativeEndian = nativeEndian;
+	les_connectVarint = varint;
+	les_connectCompression = compression;
+}
+
+void LES_CoreEngineGetConnectOptions(bool* const pNativeEndian, bool* const pVarint, bool* const pCompression)
+{
+	*pNativeEndian = les_connectNativeEndian;
+	*pVarint = les_connectVarint;
+	*pCompression = les_connectCompression;
+}
+
+int LES_CoreEngineReconnect(void)
+{
+	if (les_state != LES_STATE_READY)
+	{
+		LES_ERROR("LES_CoreEngineReconnect: not connected state:%d", les_state);
+		return LES_RETURN_ERROR;
+	}
+	// The batched RPCs were made with the current parameter data encoding
+	if (LES_CoreEngineFlushFunctionRPCBatch() != LES_RETURN_OK)
+	{
+		LES_ERROR("LES_CoreEngineReconnect: error sending function RPC batch");
+	}
+	les_state = LES_STATE_NOT_CONNECTED;
+	return LES_RETURN_OK;
+}
+
 int LES_CoreEngineSendFunctionRPC(const LES_FunctionDefinition* const pFunctionDefinition, 
-																	const LES_FunctionParameterData* const pFunctionParameterData)
+																	LES_FunctionParameterData* const pFunctionParameterData,
+																	LES_FunctionRPCHandle* const pHandle)
 {
+	if (pHandle)
+	{
+		*pHandle = LES_FUNCTIONRPC_INVALID_HANDLE;
+	}
 	const LES_uint32 functionNameID = pFunctionDefinition->GetNameID();
 	const int functionParameterDataSize = pFunctionParameterData->GetNumBytesWritten();
-	const char* const pFunctionParameterDataBuffer = pFunctionParameterData->GetBufferPtr();
+	const int numReferences = pFunctionParameterData->GetNumReferences();
 
 	const LES_uint16 type = LES_NETMESSAGE_SEND_ID_FUNCTIONRPC;
 	const LES_uint16 id = les_functionID;
-	const int payloadSize = functionParameterDataSize + sizeof(LES_uint32);
+	const int payloadSize = functionParameterDataSize + LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE;
 	const LES_StringEntry* const pFunctionNameEntry = LES_GetStringEntryForID(functionNameID);
 	const char* const functionName = pFunctionNameEntry? pFunctionNameEntry->m_str : "UNKNOWN";
 
@@ -233,19 +817,250 @@ int LES_CoreEngineSendFunctionRPC(const LES_FunctionDefinition* const pFunctionD
 	{
 		return LES_COREENGINE_NOT_READY;
 	}
+	const LES_uint32 correlationID = LES_FunctionRPCNewCorrelationID();
+	LES_FunctionRPCDelta* const pDelta = pFunctionNameEntry ? LES_FunctionRPCFindDelta(pFunctionNameEntry->m_hash) : LES_NULL;
 
+	// Batching : RPCs too big for a batch are sent on their own
+	const int batchRecordSize = LES_FunctionRPCBatchRecordSize(functionParameterDataSize);
+	const bool isBatched = (les_functionRPCBatch.m_maxPayloadSize > 0) && 
+												 ((LES_FUNCTIONRPC_BATCH_HEADER_SIZE + batchRecordSize) <= les_functionRPCBatch.m_maxPayloadSize);
+	if ((numReferences > 0) && (isBatched || pDelta))
+	{
+		// Batches & deltas are made from the whole parameter data
+		pFunctionParameterData->ResolveReferences();
+	}
+	if (isBatched)
+	{
+		if (LES_FunctionRPCBatchAdd(functionNameID, correlationID, pFunctionParameterData, pDelta) != LES_RETURN_OK)
+		{
+			LES_ERROR("Error adding function RPC to the batch");
+			return LES_COREENGINE_SEND_ERROR;
+		}
+		les_functionID++;
+		if (pHandle)
+		{
+			LES_FunctionRPCAddPending(correlationID);
+			*pHandle = correlationID;
+		}
+		return LES_COREENGINE_OK;
+	}
+
+	if (pDelta)
+	{
+		// The server must apply the function's batched RPCs before this one
+		if (LES_CoreEngineFlushFunctionRPCBatch() != LES_RETURN_OK)
+		{
+			LES_ERROR("Error sending function RPC batch");
+			return LES_COREENGINE_SEND_ERROR;
+		}
+		const char* const parameterData = pFunctionParameterData->GetBufferPtr();
+		const int deltaDataSize = LES_FunctionRPCDeltaGetSize(pDelta, parameterData, functionParameterDataSize);
+		if (deltaDataSize >= 0)
+		{
+			// A parameter block has room for the message header & function nameID before the data
+			const int deltaPayloadSize = LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE + deltaDataSize;
+			LES_FunctionParameterData* const pDeltaParameterData = LES_ParameterPoolAlloc(deltaDataSize);
+			LES_NetworkMessage* const pDeltaMessage = (LES_NetworkMessage*)pDeltaParameterData->GetMessagePtr();
+			const LES_uint32 deltaPayloadHeader[2] = { toBigEndian32(functionNameID), toBigEndian32(correlationID) };
+			memcpy(pDeltaMessage->m_payload, deltaPayloadHeader, LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE);
+			LES_FunctionRPCDeltaEncode(pDelta, parameterData, functionParameterDataSize, 
+																 (char*)(pDeltaMessage->m_payload) + LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE);
+
+			// The parameter block goes back to the pool once the delta has been sent
+			LES_NetworkSendItem deltaSendItem;
+			deltaSendItem.CreateInPlace(LES_NETMESSAGE_SEND_ID_FUNCTIONRPC_DELTA, id, deltaPayloadSize, pDeltaMessage);
+			les_functionID++;
+			if (LES_NetworkAddSendItem(&deltaSendItem, LES_FunctionRPCSentRelease, pDeltaParameterData) == LES_RETURN_ERROR)
+			{
+				LES_ERROR("Error adding function RPC delta send item");
+				LES_ReleaseFunctionParameterData(pDeltaParameterData);
+				return LES_COREENGINE_SEND_ERROR;
+			}
+			LES_FunctionRPCDeltaSent(pDelta, parameterData, functionParameterDataSize, false);
+			if (pHandle)
+			{
+				LES_FunctionRPCAddPending(correlationID);
+				*pHandle = correlationID;
+			}
+			return LES_COREENGINE_OK;
+		}
+	}
+
+	// The parameter data was written in place after the message header & function nameID : no copy needed
+	LES_NetworkMessage* const pMessage = (LES_NetworkMessage*)pFunctionParameterData->GetMessagePtr();
 	les_functionID++;
 	LES_NetworkSendItem sendItem;
-	sendItem.Create(type, id, payloadSize);
-	char* pPayload = (char*)(sendItem.GetMessagePtr()->m_payload);
-	const LES_uint32 bigFunctionNameID = toBigEndian32(functionNameID);
-	memcpy(pPayload, &bigFunctionNameID, sizeof(LES_uint32));
-	pPayload += sizeof(LES_uint32);
-	memcpy(pPayload, pFunctionParameterDataBuffer, functionParameterDataSize);
-	if (LES_NetworkAddSendItem(&sendItem) == LES_RETURN_ERROR)
-	{
-		LES_ERROR("Error adding getdefinitionfile send item");
+	sendItem.CreateInPlace(type, id, payloadSize, pMessage);
+	// The large input arrays are sent from the caller's memory
+	sendItem.SetReferences(pFunctionParameterData->GetReferences(), pFunctionParameterData->GetNumReferences());
+	const LES_uint32 payloadHeader[2] = { toBigEndian32(functionNameID), toBigEndian32(correlationID) };
+	memcpy(pMessage->m_payload, payloadHeader, LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE);
+	if (LES_NetworkAddSendItem(&sendItem, LES_FunctionRPCSentRelease, pFunctionParameterData) == LES_RETURN_ERROR)
+	{
+		LES_ERROR("Error adding function RPC send item");
 		return LES_COREENGINE_SEND_ERROR;
 	}
+	// The message now also belongs to the network queue until it has been sent
+	LES_AddRefFunctionParameterData(pFunctionParameterData);
+	LES_FunctionRPCDeltaSent(pDelta, pFunctionParameterData->GetBufferPtr(), functionParameterDataSize, true);
+	if (pHandle)
+	{
+		LES_FunctionRPCAddPending(correlationID);
+		*pHandle = correlationID;
+	}
 	return LES_COREENGINE_OK;
 }
+
+int LES_CoreEngineSetFunctionRPCOutputs(const LES_FunctionRPCHandle handle, 
+																				const LES_FunctionRPCOutput* const outputs, const int numOutputs)
+{
+	LES_FunctionRPCPending* const pPending = LES_FunctionRPCGetPending(handle);
+	if ((handle == LES_FUNCTIONRPC_INVALID_HANDLE) || (pPending->m_correlationID != handle) || 
+			(pPending->m_state != LES_FUNCTIONRPC_PENDING))
+	{
+		LES_ERROR("LES_CoreEngineSetFunctionRPCOutputs handle:%u isn't pending", handle);
+		return LES_RETURN_ERROR;
+	}
+	if ((numOutputs < 0) || (numOutputs > LES_MAX_NUM_FUNCTION_PARAMS))
+	{
+		LES_ERROR("LES_CoreEngineSetFunctionRPCOutputs handle:%u invalid numOutputs:%d max:%d", 
+							handle, numOutputs, LES_MAX_NUM_FUNCTION_PARAMS);
+		return LES_RETURN_ERROR;
+	}
+	memcpy(pPending->m_outputs, outputs, sizeof(LES_FunctionRPCOutput) * numOutputs);
+	pPending->m_numOutputs = numOutputs;
+	pPending->m_definitionGeneration = LES_GetFunctionDefinitionGeneration();
+	return LES_RETURN_OK;
+}
+
+int LES_CoreEnginePollFunctionRPC(const LES_FunctionRPCHandle handle, LES_int32* const pResult)
+{
+	LES_FunctionRPCProcessCompletions();
+	const LES_FunctionRPCPending* const pPending = LES_FunctionRPCGetPending(handle);
+	if ((handle == LES_FUNCTIONRPC_INVALID_HANDLE) || (pPending->m_correlationID != handle))
+	{
+		return LES_FUNCTIONRPC_INVALID;
+	}
+	if ((pPending->m_state == LES_FUNCTIONRPC_COMPLETE) && pResult)
+	{
+		*pResult = pPending->m_result;
+	}
+	return pPending->m_state;
+}
+
+int LES_CoreEngineWaitFunctionRPC(const LES_FunctionRPCHandle handle, const float timeoutInSeconds, LES_int32* const pResult)
+{
+	// The result can only arrive during a tick : waiting inside one would never return
+	if (les_inTick)
+	{
+		LES_ERROR("LES_CoreEngineWaitFunctionRPC handle:%u : can't wait inside LES_CoreEngineTick", handle);
+		return LES_CoreEnginePollFunctionRPC(handle, pResult);
+	}
+	const float startTime = LES_GetElapsedTimeInSeconds();
+	while (1)
+	{
+		const int state = LES_CoreEnginePollFunctionRPC(handle, pResult);
+		if (state != LES_FUNCTIONRPC_PENDING)
+		{
+			return state;
+		}
+		if ((LES_GetElapsedTimeInSeconds() - startTime) >= timeoutInSeconds)
+		{
+			return state;
+		}
+		// The RPC might still be waiting to be sent
+		LES_CoreEngineTick();
+		LES_Sleep(0.001f);
+	}
+}
+
+void LES_CoreEngineSetFunctionRPCBatchSize(const int maxBatchPayloadSize)
+{
+	// Send what is already batched with the old size
+	if (LES_CoreEngineFlushFunctionRPCBatch() != LES_RETURN_OK)
+	{
+		LES_ERROR("LES_CoreEngineSetFunctionRPCBatchSize: error sending function RPC batch");
+	}
+	LES_FunctionRPCBatchSentRelease(les_functionRPCBatch.m_batchMessage);
+	LES_FunctionRPCBatchReset();
+	les_functionRPCBatch.m_maxPayloadSize = (maxBatchPayloadSize > 0) ? ((maxBatchPayloadSize + 3) & ~3) : 0;
+}
+
+int LES_CoreEngineFlushFunctionRPCBatch(void)
+{
+	LES_FunctionRPCBatch* const pBatch = &les_functionRPCBatch;
+	if (pBatch->m_numRecords == 0)
+	{
+		return LES_RETURN_OK;
+	}
+	const LES_uint16 type = LES_NETMESSAGE_SEND_ID_FUNCTIONRPC_BATCH;
+	const LES_uint16 id = pBatch->m_id;
+	const int payloadSize = pBatch->m_payloadSize;
+	LES_FunctionRPCBatchMessage* const pBatchMessage = pBatch->m_batchMessage;
+	LES_NetworkMessage* const pMessage = pBatchMessage->m_message;
+	const LES_uint32 bigNumRecords = toBigEndian32(pBatch->m_numRecords);
+	memcpy(pMessage->m_payload, &bigNumRecords, sizeof(LES_uint32));
+
+	LES_NetworkSendItem sendItem;
+	sendItem.CreateInPlace(type, id, payloadSize, pMessage);
+	sendItem.SetReferences(pBatchMessage->m_references, pBatchMessage->m_numReferences);
+	pBatch->m_id++;
+	LES_FunctionRPCBatchReset();
+	if (LES_NetworkAddSendItem(&sendItem, LES_FunctionRPCBatchSentRelease, pBatchMessage) == LES_RETURN_ERROR)
+	{
+		LES_ERROR("Error adding function RPC batch send item");
+		LES_FunctionRPCBatchSentRelease(pBatchMessage);
+		return LES_RETURN_ERROR;
+	}
+	return LES_RETURN_OK;
+}
+
+int LES_CoreEngineSetFunctionRPCDelta(const char* const functionName, const bool enable)
+{
+	const LES_Hash functionNameHash = LES_GenerateHashCaseSensitive(functionName);
+	LES_FunctionRPCDelta* const pDelta = LES_FunctionRPCFindDelta(functionNameHash);
+	if (enable)
+	{
+		if (pDelta)
+		{
+			return LES_RETURN_OK;
+		}
+		if (les_numFunctionRPCDeltas >= LES_COREENGINE_MAX_NUM_DELTA_FUNCTIONS)
+		{
+			LES_ERROR("LES_CoreEngineSetFunctionRPCDelta '%s' too many delta functions max:%d", 
+								functionName, LES_COREENGINE_MAX_NUM_DELTA_FUNCTIONS);
+			return LES_RETURN_ERROR;
+		}
+		LES_FunctionRPCDelta* const pNewDelta = &les_functionRPCDeltas[les_numFunctionRPCDeltas];
+		pNewDelta->m_functionNameHash = functionNameHash;
+		pNewDelta->m_lastParameterData = LES_NULL;
+		pNewDelta->m_lastParameterDataSize = 0;
+		pNewDelta->m_numDeltasSinceKeyframe = 0;
+		pNewDelta->m_numKeyframes = 0;
+		pNewDelta->m_numDeltas = 0;
+		les_numFunctionRPCDeltas++;
+		return LES_RETURN_OK;
+	}
+	if (pDelta)
+	{
+		// The server keeps its copy : a keyframe is sent if the function is enabled again
+		free(pDelta->m_lastParameterData);
+		les_numFunctionRPCDeltas--;
+		*pDelta = les_functionRPCDeltas[les_numFunctionRPCDeltas];
+	}
+	return LES_RETURN_OK;
+}
+
+int LES_CoreEngineGetFunctionRPCDeltaStats(const char* const functionName, int* const pNumKeyframes, int* const pNumDeltas)
+{
+	*pNumKeyframes = 0;
+	*pNumDeltas = 0;
+	const LES_FunctionRPCDelta* const pDelta = LES_FunctionRPCFindDelta(LES_GenerateHashCaseSensitive(functionName));
+	if (pDelta == LES_NULL)
+	{
+		return LES_RETURN_ERROR;
+	}
+	*pNumKeyframes = pDelta->m_numKeyframes;
+	*pNumDeltas = pDelta->m_numDeltas;
+	return LES_RETURN_OK;
+}
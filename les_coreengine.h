@@ -5,6 +5,7 @@
 
 class LES_FunctionDefinition;
 struct LES_FunctionParameterData;
+struct LES_ParameterPlanOp;
 
 #define LES_COREENGINE_ERROR (-1)
 #define LES_COREENGINE_FINISHED (0)
@@ -21,12 +22,111 @@ enum { LES_STATE_UNKNOWN,
 			 LES_STATE_READY
 		 };
 
+/*
+ * Function RPC results : every RPC carries a 32-bit correlationID which the server returns in its
+ * FUNCTIONRPC_RESULT message, results are matched to their call by the correlationID not the message id
+ * A handle is the correlationID of the call, results are kept in a table indexed by the correlationID
+ * The handle becomes invalid when its table entry is reused by a later call
+*/
+typedef LES_uint32 LES_FunctionRPCHandle;
+
+#define LES_FUNCTIONRPC_INVALID_HANDLE (0)
+
+#define LES_FUNCTIONRPC_INVALID (-1)
+#define LES_FUNCTIONRPC_PENDING (0)
+#define LES_FUNCTIONRPC_COMPLETE (1)
+
+/*
+ * Output parameters : the server returns the output parameter data in the result, in parameter order
+ * Each output is decoded with the parameter's plan ops (see LES_ReadPlan) into m_destination
+*/
+struct LES_FunctionRPCOutput
+{
+	const LES_ParameterPlanOp* m_ops;
+	int m_numOps;
+	void* m_destination;
+};
+
+/* Must be a power of 2 */
+#ifndef LES_COREENGINE_MAX_NUM_PENDING_RPCS
+#define LES_COREENGINE_MAX_NUM_PENDING_RPCS (256)
+#endif // #ifndef LES_COREENGINE_MAX_NUM_PENDING_RPCS
+
 void LES_CoreEngineInit(void);
 int LES_CoreEngineTick(void);
 void LES_CoreEngineShutdown(void);
 
 int LES_CoreEngineGetState(void);
+/* 
+ * Main thread only : restarts the connect handshake on the current connection once the engine is ready
+ * The parameter data encoding is negotiated again & delta functions start again with a keyframe
+ * The definition file isn't fetched again
+*/
+int LES_CoreEngineReconnect(void);
+/* 
+ * Main thread only : what the connect message offers the server, used by the next connect or LES_CoreEngineReconnect
+ * The defaults are the LES_COREENGINE_NEGOTIATE_* settings : the server can still refuse each option
+*/
+void LES_CoreEngineSetConnectOptions(const bool nativeEndian, const bool varint, const bool compression);
+void LES_CoreEngineGetConnectOptions(bool* const pNativeEndian, bool* const pVarint, bool* const pCompression);
+/* pHandle can be LES_NULL : the result of the call is ignored */
 int LES_CoreEngineSendFunctionRPC(const LES_FunctionDefinition* const pFunctionDefinition, 
-																	const LES_FunctionParameterData* const pFunctionParameterData);
+																	LES_FunctionParameterData* const pFunctionParameterData,
+																	LES_FunctionRPCHandle* const pHandle);
+
+/* 
+ * Main thread only : the outputs are written back during LES_CoreEngineTick when the result arrives
+ * The destinations must stay valid until the call is complete or the handle is invalid
+*/
+int LES_CoreEngineSetFunctionRPCOutputs(const LES_FunctionRPCHandle handle, 
+																				const LES_FunctionRPCOutput* const outputs, const int numOutputs);
+
+/* 
+ * Main thread only : returns LES_FUNCTIONRPC_PENDING, LES_FUNCTIONRPC_COMPLETE or LES_FUNCTIONRPC_INVALID
+ * pResult is set to the result the server returned once the call is complete
+ * Poll never blocks, Wait ticks the core engine until the call completes or timeoutInSeconds has passed
+ * Wait can't be called from inside LES_CoreEngineTick (a received message handler) : it only polls the handle
+*/
+int LES_CoreEnginePollFunctionRPC(const LES_FunctionRPCHandle handle, LES_int32* const pResult);
+int LES_CoreEngineWaitFunctionRPC(const LES_FunctionRPCHandle handle, const float timeoutInSeconds, LES_int32* const pResult);
+
+/*
+ * Function RPC batching : consecutive RPCs are appended as records to one FUNCTIONRPC_BATCH message
+ * which is sent by the next LES_CoreEngineTick or when the next record wouldn't fit in maxBatchPayloadSize
+ * Batch payload : LES_uint32 numRecords then per record (big endian)
+ *	LES_uint32 functionNameID, LES_uint32 correlationID, LES_uint32 parameterDataSize, parameter data padded to 4 bytes
+ * The parameter data isn't copied into the batch : it is sent from the parameter blocks which are kept until it has been sent
+ * maxBatchPayloadSize of 0 disables batching : each RPC is sent as its own FUNCTIONRPC message
+*/
+#ifndef LES_COREENGINE_DEFAULT_RPC_BATCH_SIZE
+#define LES_COREENGINE_DEFAULT_RPC_BATCH_SIZE (0)
+#endif // #ifndef LES_COREENGINE_DEFAULT_RPC_BATCH_SIZE
+
+void LES_CoreEngineSetFunctionRPCBatchSize(const int maxBatchPayloadSize);
+int LES_CoreEngineFlushFunctionRPCBatch(void);
+
+/*
+ * Function RPC delta encoding : enabled per function, the client keeps the last parameter data sent for the function
+ * and only sends the bytes which changed, the server applies them to its copy of the last parameter data
+ * Delta data (big endian) : LES_uint32 parameterDataSize, a bitmap with a bit per parameter data byte
+ *	(bit (i & 7) of byte (i >> 3) is set if byte i changed) then the changed bytes in order
+ * FUNCTIONRPC_DELTA payload : LES_uint32 functionNameID, LES_uint32 correlationID then the delta data
+ * Batch records with LES_FUNCTIONRPC_BATCH_RECORD_DELTA set in parameterDataSize hold delta data
+ * A full keyframe is sent for the first call, after each connect, when the parameter data size changes,
+ * when the delta wouldn't be smaller and after LES_COREENGINE_DELTA_KEYFRAME_INTERVAL deltas
+*/
+#ifndef LES_COREENGINE_DELTA_KEYFRAME_INTERVAL
+#define LES_COREENGINE_DELTA_KEYFRAME_INTERVAL (60)
+#endif // #ifndef LES_COREENGINE_DELTA_KEYFRAME_INTERVAL
+
+#ifndef LES_COREENGINE_MAX_NUM_DELTA_FUNCTIONS
+#define LES_COREENGINE_MAX_NUM_DELTA_FUNCTIONS (64)
+#endif // #ifndef LES_COREENGINE_MAX_NUM_DELTA_FUNCTIONS
+
+#define LES_FUNCTIONRPC_BATCH_RECORD_DELTA (0x80000000)
+
+int LES_CoreEngineSetFunctionRPCDelta(const char* const functionName, const bool enable);
+/* The number of keyframes & deltas sent for a delta function since it was enabled */
+int LES_CoreEngineGetFunctionRPCDeltaStats(const char* const functionName, int* const pNumKeyframes, int* const pNumDeltas);
 
 #endif //#ifndef LES_COREENGINE_HH
@@ -0,0 +1,561 @@
+#include <string.h>
+#include <stdio.h>
+#include <malloc.h>
+
+#include "les_core.h"
+#include "les_logger.h"
+#include "les_loggerchannel.h"
+#include "les_stringentry.h"
+#include "les_type.h"
+#include "les_struct.h"
+#include "les_function.h"
+#include "les_parameter.h"
+#include "les_decode.h"
+
+#define LES_DECODE_MAX_NUM_NODES (1024)
+
+struct LES_DecodeBuildState
+{
+	LES_DecodeNode* m_nodes;
+	int m_numNodes;
+};
+
+struct LES_DecodeState
+{
+	const LES_DecodeNode* m_nodes;
+	const LES_FunctionParameterData* m_functionParameterData;
+	LES_DecodeVisitor* m_visitor;
+	int m_parameterIndex;
+	int m_parentLength;
+	char m_parent[LES_DECODE_MAX_PATH_LENGTH];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Internal Static functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* The type hashes are only compared when the layout is created */
+static int LES_DecodeGetValueType(const LES_Hash typeHash)
+{
+	if (typeHash == LES_TypeEntry::s_longlongHash)
+	{
+		return LES_DECODE_VALUE_INT64;
+	}
+	if (typeHash == LES_TypeEntry::s_intHash)
+	{
+		return LES_DECODE_VALUE_INT32;
+	}
+	if (typeHash == LES_TypeEntry::s_uintHash)
+	{
+		return LES_DECODE_VALUE_UINT32;
+	}
+	if (typeHash == LES_TypeEntry::s_shortHash)
+	{
+		return LES_DECODE_VALUE_INT16;
+	}
+	if (typeHash == LES_TypeEntry::s_ushortHash)
+	{
+		return LES_DECODE_VALUE_UINT16;
+	}
+	if (typeHash == LES_TypeEntry::s_charHash)
+	{
+		return LES_DECODE_VALUE_CHAR;
+	}
+	if (typeHash == LES_TypeEntry::s_ucharHash)
+	{
+		return LES_DECODE_VALUE_UCHAR;
+	}
+	if (typeHash == LES_TypeEntry::s_floatHash)
+	{
+		return LES_DECODE_VALUE_FLOAT32;
+	}
+	return LES_DECODE_VALUE_UNKNOWN;
+}
+
+static int LES_DecodeAllocNodes(LES_DecodeBuildState* const state, const int numNodes)
+{
+	if ((state->m_numNodes + numNodes) > LES_DECODE_MAX_NUM_NODES)
+	{
+		return -1;
+	}
+	const int firstNode = state->m_numNodes;
+	state->m_numNodes += numNodes;
+	return firstNode;
+}
+
+/* Fills in the node then creates its children at the end of the node list */
+static int LES_DecodeBuildNode(LES_DecodeBuildState* const state, const int nodeIndex, const int nameID, const int typeID)
+{
+	const LES_StringEntry* const nameStringEntry = LES_GetStringEntryForID(nameID);
+	const LES_StringEntry* const typeStringEntry = LES_GetStringEntryForID(typeID);
+	if ((nameStringEntry == LES_NULL) || (typeStringEntry == LES_NULL))
+	{
+		return LES_RETURN_ERROR;
+	}
+	LES_DecodeNode* node = &state->m_nodes[nodeIndex];
+	node->m_name = nameStringEntry->m_str;
+	node->m_typeName = typeStringEntry->m_str;
+	node->m_kind = LES_DECODE_NODE_VALUE;
+	node->m_valueType = LES_DECODE_VALUE_UNKNOWN;
+	node->m_typeFlags = 0;
+	node->m_dataSize = 0;
+	node->m_numElements = 0;
+	node->m_isDynamicArray = 0;
+	node->m_firstChild = -1;
+	node->m_numChildren = 0;
+
+	const LES_TypeEntry* typeEntryPtr = LES_GetTypeEntryForStringID(typeID);
+	if (typeEntryPtr == LES_NULL)
+	{
+		/* Reported when it is decoded : the parameters before it are still decoded */
+		node->m_kind = LES_DECODE_NODE_MISSING_TYPE;
+		return LES_RETURN_OK;
+	}
+	node->m_numElements = typeEntryPtr->m_numElements;
+	if (typeEntryPtr->m_flags & LES_TYPE_STRING)
+	{
+		node->m_kind = LES_DECODE_NODE_STRING;
+		return LES_RETURN_OK;
+	}
+	node->m_isDynamicArray = (typeEntryPtr->m_flags & LES_TYPE_DYNAMIC_ARRAY) ? 1 : 0;
+
+	typeEntryPtr = typeEntryPtr->GetRootType();
+	node->m_typeFlags = typeEntryPtr->m_flags;
+	node->m_dataSize = (LES_int32)typeEntryPtr->m_dataSize;
+
+	if (typeEntryPtr->m_flags & LES_TYPE_STRUCT)
+	{
+		node->m_kind = LES_DECODE_NODE_STRUCT;
+		const LES_StructDefinition* const structDefinition = typeEntryPtr->GetStructDefinition();
+		if (structDefinition == LES_NULL)
+		{
+			node->m_kind = LES_DECODE_NODE_MISSING_STRUCT;
+			return LES_RETURN_OK;
+		}
+		const int numMembers = structDefinition->GetNumMembers();
+		const int firstChild = LES_DecodeAllocNodes(state, numMembers);
+		if (firstChild < 0)
+		{
+			return LES_RETURN_ERROR;
+		}
+		node->m_firstChild = firstChild;
+		node->m_numChildren = numMembers;
+		for (int i = 0; i < numMembers; i++)
+		{
+			const LES_StructMember* const structMember = structDefinition->GetMemberByIndex(i);
+			if (LES_DecodeBuildNode(state, firstChild + i, structMember->m_nameID, structMember->m_typeID) != LES_RETURN_OK)
+			{
+				return LES_RETURN_ERROR;
+			}
+		}
+		return LES_RETURN_OK;
+	}
+	if ((node->m_numElements > 0) || node->m_isDynamicArray)
+	{
+		node->m_kind = LES_DECODE_NODE_ARRAY;
+		const int elementNode = LES_DecodeAllocNodes(state, 1);
+		if (elementNode < 0)
+		{
+			return LES_RETURN_ERROR;
+		}
+		node->m_firstChild = elementNode;
+		node->m_numChildren = 1;
+		return LES_DecodeBuildNode(state, elementNode, nameID, typeEntryPtr->m_aliasedTypeID);
+	}
+	node->m_valueType = LES_DecodeGetValueType(typeEntryPtr->m_hash);
+	return LES_RETURN_OK;
+}
+
+/* Appends "[.]name[[index]]" to the parent path : returns the previous length to restore it */
+static int LES_DecodePushParent(LES_DecodeState* const state, const char* const name, const int index)
+{
+	const int parentLength = state->m_parentLength;
+	char* const parent = state->m_parent;
+	int length = parentLength;
+	const int nameLength = (int)strlen(name);
+	/* ".", the name, "[" at most 10 digits "]" and NUL */
+	if ((length + nameLength + 14) > LES_DECODE_MAX_PATH_LENGTH)
+	{
+		return -1;
+	}
+	if (length > 0)
+	{
+		parent[length++] = '.';
+	}
+	memcpy(parent + length, name, (size_t)nameLength);
+	length += nameLength;
+	if (index >= 0)
+	{
+		char digits[16];
+		int numDigits = 0;
+		int value = index;
+		do
+		{
+			digits[numDigits++] = (char)('0' + (value % 10));
+			value /= 10;
+		} while (value > 0);
+		parent[length++] = '[';
+		while (numDigits > 0)
+		{
+			parent[length++] = digits[--numDigits];
+		}
+		parent[length++] = ']';
+	}
+	parent[length] = '\0';
+	state->m_parentLength = length;
+	return parentLength;
+}
+
+static void LES_DecodePopParent(LES_DecodeState* const state, const int parentLength)
+{
+	state->m_parentLength = parentLength;
+	state->m_parent[parentLength] = '\0';
+}
+
+static int LES_DecodeNodeData(LES_DecodeState* const state, const LES_DecodeNode* const node, const int elementIndex)
+{
+	const LES_FunctionParameterData* const functionParameterData = state->m_functionParameterData;
+	LES_DecodePath path;
+	path.m_parameterIndex = state->m_parameterIndex;
+	path.m_elementIndex = elementIndex;
+	path.m_parent = state->m_parent;
+	path.m_name = node->m_name;
+
+	const int kind = node->m_kind;
+	if (kind == LES_DECODE_NODE_MISSING_TYPE)
+	{
+		LES_WARNING("LES_Decode parameter[%d]:'%s' type:'%s' type can't be found", path.m_parameterIndex, node->m_name, node->m_typeName);
+		return LES_RETURN_ERROR;
+	}
+	if (kind == LES_DECODE_NODE_VALUE)
+	{
+		LES_DecodeValue value;
+		value.m_valueType = node->m_valueType;
+		value.m_dataSize = node->m_dataSize;
+		value.m_typeFlags = node->m_typeFlags;
+		value.m_int64 = 0;
+		value.m_data = (const char*)&value.m_int64;
+		if (node->m_dataSize <= (int)sizeof(value.m_int64))
+		{
+			if (functionParameterData->ReadValue(&value.m_int64, node->m_dataSize, node->m_typeFlags) != LES_RETURN_OK)
+			{
+				LES_WARNING("LES_Decode parameter[%d]:'%s' type:'%s' read failed", path.m_parameterIndex, node->m_name, node->m_typeName);
+				return LES_RETURN_ERROR;
+			}
+		}
+		else if (node->m_typeFlags & (LES_TYPE_POD | LES_TYPE_STRUCT))
+		{
+			value.m_data = functionParameterData->ReadBytes(node->m_dataSize);
+			if (value.m_data == LES_NULL)
+			{
+				LES_WARNING("LES_Decode parameter[%d]:'%s' type:'%s' truncated", path.m_parameterIndex, node->m_name, node->m_typeName);
+				return LES_RETURN_ERROR;
+			}
+		}
+		state->m_visitor->Value(&path, node->m_typeName, &value);
+		return LES_RETURN_OK;
+	}
+	if (kind == LES_DECODE_NODE_STRING)
+	{
+		LES_uint32 count = 0;
+		if (functionParameterData->ReadCount(&count) != LES_RETURN_OK)
+		{
+			return LES_RETURN_ERROR;
+		}
+		if (count > (LES_uint32)node->m_numElements)
+		{
+			LES_WARNING("LES_Decode parameter[%d]:'%s' type:'%s' invalid count:%u max:%d",
+									path.m_parameterIndex, node->m_name, node->m_typeName, count, node->m_numElements);
+			return LES_RETURN_ERROR;
+		}
+		const char* const value = functionParameterData->ReadBytes((int)count);
+		if (value == LES_NULL)
+		{
+			LES_WARNING("LES_Decode parameter[%d]:'%s' type:'%s' truncated count:%u",
+									path.m_parameterIndex, node->m_name, node->m_typeName, count);
+			return LES_RETURN_ERROR;
+		}
+		state->m_visitor->String(&path, node->m_typeName, value, (int)count);
+		return LES_RETURN_OK;
+	}
+
+	/* Structs & arrays : decode the elements which were sent, the count is before them */
+	int numElements = node->m_numElements;
+	if (node->m_isDynamicArray)
+	{
+		LES_uint32 count = 0;
+		if (functionParameterData->ReadCount(&count) != LES_RETURN_OK)
+		{
+			return LES_RETURN_ERROR;
+		}
+		if (count > (LES_uint32)numElements)
+		{
+			LES_WARNING("LES_Decode parameter[%d]:'%s' type:'%s' invalid count:%u max:%d",
+									path.m_parameterIndex, node->m_name, node->m_typeName, count, numElements);
+			return LES_RETURN_ERROR;
+		}
+		numElements = (int)count;
+	}
+	path.m_elementIndex = -1;
+	state->m_visitor->Aggregate(&path, node->m_typeName);
+	if (node->m_isDynamicArray && (numElements == 0))
+	{
+		return LES_RETURN_OK;
+	}
+	if (kind == LES_DECODE_NODE_MISSING_STRUCT)
+	{
+		LES_WARNING("LES_Decode parameter[%d]:'%s' type:'%s' is a struct but can't be found",
+								path.m_parameterIndex, node->m_name, node->m_typeName);
+		return LES_RETURN_ERROR;
+	}
+	const LES_DecodeNode* const firstChild = &state->m_nodes[node->m_firstChild];
+	if (kind == LES_DECODE_NODE_ARRAY)
+	{
+		for (int i = 0; i < numElements; i++)
+		{
+			if (LES_DecodeNodeData(state, firstChild, i) != LES_RETURN_OK)
+			{
+				return LES_RETURN_ERROR;
+			}
+		}
+		return LES_RETURN_OK;
+	}
+
+	const int localNumElements = (numElements < 1) ? 1 : numElements;
+	const int numMembers = node->m_numChildren;
+	for (int e = 0; e < localNumElements; e++)
+	{
+		const int parentLength = LES_DecodePushParent(state, node->m_name, (localNumElements > 1) ? e : -1);
+		if (parentLength < 0)
+		{
+			LES_WARNING("LES_Decode parameter[%d]:'%s' type:'%s' path is too long", path.m_parameterIndex, node->m_name, node->m_typeName);
+			return LES_RETURN_ERROR;
+		}
+		for (int i = 0; i < numMembers; i++)
+		{
+			if (LES_DecodeNodeData(state, firstChild + i, -1) != LES_RETURN_OK)
+			{
+				return LES_RETURN_ERROR;
+			}
+		}
+		LES_DecodePopParent(state, parentLength);
+	}
+	return LES_RETURN_OK;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LES_DecodeVisitor::Function(const char* const, const int)
+{
+}
+
+void LES_DecodeVisitor::Aggregate(const LES_DecodePath* const, const char* const)
+{
+}
+
+void LES_DecodeVisitor::String(const LES_DecodePath* const, const char* const, const char* const, const int)
+{
+}
+
+void LES_DecodeVisitor::Value(const LES_DecodePath* const, const char* const, const LES_DecodeValue* const)
+{
+}
+
+LES_DecodeLogVisitor::LES_DecodeLogVisitor(LES_LoggerChannel* const pLogChannel) : m_pLogChannel(pLogChannel)
+{
+}
+
+/* "DecodeSingle parameter[%d]:'parent.name[index]" : returns the length written */
+int LES_DecodeLogVisitor::OutputPath(char* const output, const int outputSize, const LES_DecodePath* const path,
+																		 const bool withElementIndex) const
+{
+	const char* const parent = path->m_parent;
+	int length = snprintf(output, (size_t)outputSize, "DecodeSingle parameter[%d]:'%s%s%s", path->m_parameterIndex,
+												parent, (parent[0] != '\0') ? "." : "", path->m_name);
+	if (withElementIndex && (path->m_elementIndex >= 0) && (length < outputSize))
+	{
+		length += snprintf(output + length, (size_t)(outputSize - length), "[%d]", path->m_elementIndex);
+	}
+	return (length < outputSize) ? length : outputSize - 1;
+}
+
+void LES_DecodeLogVisitor::Output(const char* const output) const
+{
+	LES_LOG("%s", output);
+	if (m_pLogChannel)
+	{
+		m_pLogChannel->Print("%s", output);
+	}
+}
+
+void LES_DecodeLogVisitor::Function(const char* const functionName, const int numParameters)
+{
+	LES_LOG("Decode Function '%s' numParams:%d", functionName, numParameters);
+	if (m_pLogChannel)
+	{
+		m_pLogChannel->Print("Decode Function '%s' numParams:%d", functionName, numParameters);
+	}
+}
+
+void LES_DecodeLogVisitor::Aggregate(const LES_DecodePath* const path, const char* const typeName)
+{
+	char output[1024];
+	const int length = OutputPath(output, sizeof(output), path, false);
+	snprintf(output + length, sizeof(output) - (size_t)length, "' type:'%s'", typeName);
+	Output(output);
+}
+
+void LES_DecodeLogVisitor::String(const LES_DecodePath* const path, const char* const typeName,
+																	const char* const value, const int valueLength)
+{
+	char output[1024];
+	const int length = OutputPath(output, sizeof(output), path, true);
+	snprintf(output + length, sizeof(output) - (size_t)length, "' type:'%s' value:'%.*s'", typeName, valueLength, value);
+	Output(output);
+}
+
+void LES_DecodeLogVisitor::Value(const LES_DecodePath* const path, const char* const typeName, const LES_DecodeValue* const value)
+{
+	char output[1024];
+	int length = OutputPath(output, sizeof(output), path, true);
+	length += snprintf(output + length, sizeof(output) - (size_t)length, "' type:'%s' value:", typeName);
+	if (length >= (int)sizeof(output))
+	{
+		length = (int)sizeof(output) - 1;
+	}
+	char* const valueOutput = output + length;
+	const size_t valueOutputSize = sizeof(output) - (size_t)length;
+	switch (value->m_valueType)
+	{
+		case LES_DECODE_VALUE_INT64:
+			snprintf(valueOutput, valueOutputSize, "%lld", (long long int)value->m_int64);
+			break;
+		case LES_DECODE_VALUE_INT32:
+		case LES_DECODE_VALUE_UINT32:
+			snprintf(valueOutput, valueOutputSize, "%d", value->m_int32);
+			break;
+		case LES_DECODE_VALUE_INT16:
+		case LES_DECODE_VALUE_UINT16:
+			snprintf(valueOutput, valueOutputSize, "%d", value->m_int16);
+			break;
+		case LES_DECODE_VALUE_CHAR:
+		case LES_DECODE_VALUE_UCHAR:
+			snprintf(valueOutput, valueOutputSize, "'%c'", value->m_char);
+			break;
+		case LES_DECODE_VALUE_FLOAT32:
+			snprintf(valueOutput, valueOutputSize, "%.3f", value->m_float32);
+			break;
+		default:
+			snprintf(valueOutput, valueOutputSize, ":UNKNOWN typeDataSize:%d struct:%d", value->m_dataSize,
+							 (int)(value->m_typeFlags & LES_TYPE_STRUCT));
+			break;
+	}
+	Output(output);
+}
+
+const LES_DecodeNode* LES_DecodeLayout::GetParameterNode(const int index) const
+{
+	if ((index < 0) || (index >= m_numParameters))
+	{
+		return LES_NULL;
+	}
+	return &m_nodes[index];
+}
+
+const LES_DecodeNode* LES_DecodeLayout::GetNode(const int index) const
+{
+	if ((index < 0) || (index >= m_numNodes))
+	{
+		return LES_NULL;
+	}
+	return &m_nodes[index];
+}
+
+LES_DecodeLayout* LES_CreateDecodeLayout(const LES_FunctionDefinition* const functionDefinition)
+{
+	if (functionDefinition == LES_NULL)
+	{
+		return LES_NULL;
+	}
+	const int numParameters = functionDefinition->GetNumParameters();
+	if ((numParameters < 0) || (numParameters > LES_MAX_NUM_FUNCTION_PARAMS))
+	{
+		return LES_NULL;
+	}
+	const LES_StringEntry* const functionNameStringEntry = LES_GetStringEntryForID(functionDefinition->GetNameID());
+	if (functionNameStringEntry == LES_NULL)
+	{
+		return LES_NULL;
+	}
+
+	LES_DecodeBuildState state;
+	state.m_nodes = new LES_DecodeNode[LES_DECODE_MAX_NUM_NODES];
+	state.m_numNodes = 0;
+
+	/* The parameter nodes are first : their children are after them */
+	LES_DecodeAllocNodes(&state, numParameters);
+	for (int p = 0; p < numParameters; p++)
+	{
+		const LES_FunctionParameter* const functionParameterPtr = functionDefinition->GetParameterByIndex(p);
+		if (LES_DecodeBuildNode(&state, p, functionParameterPtr->m_nameID, functionParameterPtr->m_typeID) != LES_RETURN_OK)
+		{
+			LES_WARNING("LES_CreateDecodeLayout function:'%s' parameter[%d] failed to build numNodes:%d max:%d",
+									functionNameStringEntry->m_str, p, state.m_numNodes, LES_DECODE_MAX_NUM_NODES);
+			delete[] state.m_nodes;
+			return LES_NULL;
+		}
+	}
+
+	int memorySize = sizeof(LES_DecodeLayout);
+	if (state.m_numNodes > 1)
+	{
+		memorySize += (int)sizeof(LES_DecodeNode) * (state.m_numNodes - 1);
+	}
+	LES_DecodeLayout* const decodeLayout = (LES_DecodeLayout*)malloc((size_t)memorySize);
+	decodeLayout->m_functionName = functionNameStringEntry->m_str;
+	decodeLayout->m_numParameters = numParameters;
+	decodeLayout->m_numNodes = state.m_numNodes;
+	memcpy(decodeLayout->m_nodes, state.m_nodes, sizeof(LES_DecodeNode) * (size_t)state.m_numNodes);
+
+	delete[] state.m_nodes;
+
+	return decodeLayout;
+}
+
+void LES_DestroyDecodeLayout(LES_DecodeLayout* const decodeLayout)
+{
+	free(decodeLayout);
+}
+
+int LES_Decode(const LES_DecodeLayout* const decodeLayout, const LES_FunctionParameterData* const functionParameterData,
+							 LES_DecodeVisitor* const visitor)
+{
+	if ((decodeLayout == LES_NULL) || (functionParameterData == LES_NULL) || (visitor == LES_NULL))
+	{
+		return LES_RETURN_ERROR;
+	}
+	const int numParameters = decodeLayout->GetNumParameters();
+	visitor->Function(decodeLayout->GetFunctionName(), numParameters);
+
+	LES_DecodeState state;
+	state.m_nodes = decodeLayout->GetNode(0);
+	state.m_functionParameterData = functionParameterData;
+	state.m_visitor = visitor;
+	state.m_parentLength = 0;
+	state.m_parent[0] = '\0';
+	for (int p = 0; p < numParameters; p++)
+	{
+		state.m_parameterIndex = p;
+		if (LES_DecodeNodeData(&state, decodeLayout->GetParameterNode(p), -1) != LES_RETURN_OK)
+		{
+			return LES_RETURN_ERROR;
+		}
+	}
+	return LES_RETURN_OK;
+}
@@ -0,0 +1,145 @@
+#ifndef LES_DECODE_HH
+#define LES_DECODE_HH
+
+#include "les_base.h"
+#include "les_function.h"
+
+class LES_FunctionDefinition;
+class LES_FunctionParameterData;
+class LES_LoggerChannel;
+
+/*
+ * A decode layout is the type graph of each function parameter resolved once into a flat list of nodes
+ * The first m_numParameters nodes are the function parameters
+ * STRUCT nodes have their members as m_numChildren contiguous nodes starting at m_firstChild
+ * ARRAY nodes have the element node at m_firstChild : m_numElements is the maximum for dynamic arrays
+ * STRING nodes m_numElements is the maximum length
+*/
+#define LES_DECODE_NODE_VALUE 				(0)
+#define LES_DECODE_NODE_STRING 				(1)
+#define LES_DECODE_NODE_STRUCT 				(2)
+#define LES_DECODE_NODE_ARRAY 				(3)
+#define LES_DECODE_NODE_MISSING_TYPE 	(4)
+#define LES_DECODE_NODE_MISSING_STRUCT (5)
+
+/* The value types which are reported as numbers : other types are UNKNOWN and reported as their raw bytes */
+#define LES_DECODE_VALUE_UNKNOWN 	(0)
+#define LES_DECODE_VALUE_INT64 		(1)
+#define LES_DECODE_VALUE_INT32 		(2)
+#define LES_DECODE_VALUE_UINT32 	(3)
+#define LES_DECODE_VALUE_INT16 		(4)
+#define LES_DECODE_VALUE_UINT16 	(5)
+#define LES_DECODE_VALUE_CHAR 		(6)
+#define LES_DECODE_VALUE_UCHAR 		(7)
+#define LES_DECODE_VALUE_FLOAT32 	(8)
+
+#define LES_DECODE_MAX_PATH_LENGTH (1024)
+
+struct LES_DecodeNode
+{
+	const char* m_name;
+	const char* m_typeName;
+	LES_int32 m_kind;
+	LES_int32 m_valueType;
+	LES_uint32 m_typeFlags;		// root type flags used to read the value
+	LES_int32 m_dataSize;			// root type size
+	LES_int32 m_numElements;
+	LES_int32 m_isDynamicArray;
+	LES_int32 m_firstChild;
+	LES_int32 m_numChildren;
+};
+
+/* Where a decoded item is : m_parent is "" for a function parameter otherwise the path of the struct it is in e.g. "input_0.m_pos[1]" */
+struct LES_DecodePath
+{
+	LES_int32 m_parameterIndex;
+	LES_int32 m_elementIndex;			// -1 if the item isn't an array element
+	const char* m_parent;
+	const char* m_name;
+};
+
+struct LES_DecodeValue
+{
+	LES_int32 m_valueType;
+	LES_int32 m_dataSize;
+	LES_uint32 m_typeFlags;
+	union
+	{
+		LES_int64 m_int64;
+		LES_int32 m_int32;
+		LES_uint32 m_uint32;
+		LES_int16 m_int16;
+		LES_uint16 m_uint16;
+		char m_char;
+		LES_uint8 m_uchar;
+		LES_float32 m_float32;
+	};
+	const char* m_data;				// the value bytes : in the parameter data if they don't fit in the union
+};
+
+/*
+ * Decoding reports each item through a visitor in the order it is in the parameter data
+ * Aggregate is called for structs, arrays & empty dynamic arrays before their members or elements
+ * String values are not NUL terminated : valueLength is the number of chars
+*/
+class LES_DecodeVisitor
+{
+public:
+	virtual ~LES_DecodeVisitor(void) {}
+
+	virtual void Function(const char* const functionName, const int numParameters);
+	virtual void Aggregate(const LES_DecodePath* const path, const char* const typeName);
+	virtual void String(const LES_DecodePath* const path, const char* const typeName, const char* const value, const int valueLength);
+	virtual void Value(const LES_DecodePath* const path, const char* const typeName, const LES_DecodeValue* const value);
+};
+
+/* Text output : each item is a line to the log and the log channel if it isn't NULL */
+class LES_DecodeLogVisitor : public LES_DecodeVisitor
+{
+public:
+	LES_DecodeLogVisitor(LES_LoggerChannel* const pLogChannel);
+
+	virtual void Function(const char* const functionName, const int numParameters);
+	virtual void Aggregate(const LES_DecodePath* const path, const char* const typeName);
+	virtual void String(const LES_DecodePath* const path, const char* const typeName, const char* const value, const int valueLength);
+	virtual void Value(const LES_DecodePath* const path, const char* const typeName, const LES_DecodeValue* const value);
+
+private:
+	LES_DecodeLogVisitor(const LES_DecodeLogVisitor& other);
+	LES_DecodeLogVisitor& operator=(const LES_DecodeLogVisitor& other);
+
+	int OutputPath(char* const output, const int outputSize, const LES_DecodePath* const path, const bool withElementIndex) const;
+	void Output(const char* const output) const;
+
+	LES_LoggerChannel* const m_pLogChannel;
+};
+
+class LES_DecodeLayout
+{
+public:
+	const char* GetFunctionName(void) const { return m_functionName; }
+	int GetNumParameters(void) const { return m_numParameters; }
+	const LES_DecodeNode* GetParameterNode(const int index) const;
+	const LES_DecodeNode* GetNode(const int index) const;
+
+	friend LES_DecodeLayout* LES_CreateDecodeLayout(const LES_FunctionDefinition* const functionDefinition);
+private:
+	LES_DecodeLayout(void);
+	~LES_DecodeLayout(void);
+	LES_DecodeLayout(const LES_DecodeLayout& other);
+	LES_DecodeLayout& operator=(const LES_DecodeLayout& other);
+
+	const char* m_functionName;
+	LES_int32 m_numParameters;
+	LES_int32 m_numNodes;
+	LES_DecodeNode m_nodes[1];	// m_nodes[m_numNodes]
+};
+
+LES_DecodeLayout* LES_CreateDecodeLayout(const LES_FunctionDefinition* const functionDefinition);
+void LES_DestroyDecodeLayout(LES_DecodeLayout* const decodeLayout);
+
+/* Walks the layout once reading the parameter data from its current read position */
+int LES_Decode(const LES_DecodeLayout* const decodeLayout, const LES_FunctionParameterData* const functionParameterData,
+							 LES_DecodeVisitor* const visitor);
+
+#endif // #ifndef LES_DECODE_HH
@@ -7,6 +7,7 @@
 #include "les_typedata.h"
 #include "les_structdata.h"
 #include "les_funcdata.h"
+#include "les_hashdata.h"
 
 LES_DefinitionFile::LES_DefinitionFile(const void* chunkFileData, const int dataSize)
 {
@@ -37,6 +38,7 @@ int LES_DefinitionFile::Load(const void* chunkFileData, const int dataSize)
 
 	const char defID[4] = {'L', 'E', 'S', 'D'};
 	const int defNumChunks = LES_DEFINITION_NUMCHUNKS;
+	const int defNumChunksWithoutHashData = LES_DEFINITION_NUMCHUNKS_WITHOUT_HASHDATA;
 
 	// CHECK ID = defID
 	if ((id[0] != defID[0]) || (id[1] != defID[1]) || (id[2] != defID[2]) || (id[3] != defID[3]))
@@ -45,10 +47,10 @@ int LES_DefinitionFile::Load(const void* chunkFileData, const int dataSize)
 							id[0], id[1], id[2], id[3], defID[0], defID[1], defID[2], defID[3]);
 		return LES_RETURN_ERROR;
 	}
-	// CHECK numChunks = defNumChunks
-	if (numChunks != defNumChunks)
+	// CHECK numChunks = defNumChunks : files without the hash data chunk are also valid
+	if ((numChunks != defNumChunks) && (numChunks != defNumChunksWithoutHashData))
 	{
-		LES_ERROR("LES_DefinitionFile:Invalid numChunks %d should be %d", numChunks, defNumChunks);
+		LES_ERROR("LES_DefinitionFile:Invalid numChunks %d should be %d or %d", numChunks, defNumChunks, defNumChunksWithoutHashData);
 		return LES_RETURN_ERROR;
 	}
 
@@ -80,6 +82,23 @@ int LES_DefinitionFile::Load(const void* chunkFileData, const int dataSize)
 		return LES_RETURN_ERROR;
 	}
 
+	LES_HashData* const pHashData = (LES_HashData*)GetHashData();
+	if (pHashData)
+	{
+		// The hash data is the last chunk : it runs to the end of the file
+		const int hashDataOffset = (int)((const char*)pHashData - (const char*)m_chunkFileData);
+		if ((hashDataOffset <= 0) || (hashDataOffset > dataSize))
+		{
+			LES_ERROR("LES_DefinitionFile:Invalid hash data offset %d dataSize %d", hashDataOffset, dataSize);
+			return LES_RETURN_ERROR;
+		}
+		if (pHashData->Settle(dataSize - hashDataOffset) != LES_RETURN_OK)
+		{
+			LES_ERROR("LES_DefinitionFile::LES_HashData::Settle() failed");
+			return LES_RETURN_ERROR;
+		}
+	}
+
 	m_valid = true;
 	return LES_RETURN_OK;
 }
@@ -13,6 +13,7 @@
 	TYPEDATA_CHUNK
 	STRUCTDATA_CHUNK
 	FUNCTIONDATA_CHUNK
+	HASHDATA_CHUNK : optional, files made before it was added don't have it
 }
 */
 
@@ -20,6 +21,7 @@ class LES_StringTable;
 class LES_TypeData;
 class LES_StructData;
 class LES_FuncData;
+class LES_HashData;
 
 class LES_DefinitionFile
 {
@@ -38,6 +40,7 @@ public:
 	const LES_TypeData* GetTypeData(void) const;
 	const LES_StructData* GetStructData(void) const;
 	const LES_FuncData* GetFuncData(void) const;
+	const LES_HashData* GetHashData(void) const;
 
 	int IsValid(void) const;
 private:
@@ -51,7 +54,9 @@ private:
 				 	LES_DEFINITION_TYPEDATA = 1,
 				 	LES_DEFINITION_STRUCTDATA = 2,
 					LES_DEFINITION_FUNCTIONDATA = 3,
+					LES_DEFINITION_HASHDATA = 4,
 				 	LES_DEFINITION_NUMCHUNKS,
+					LES_DEFINITION_NUMCHUNKS_WITHOUT_HASHDATA = LES_DEFINITION_NUMCHUNKS - 1,
 			 };
 };
 
@@ -88,4 +93,15 @@ inline const LES_FuncData* LES_DefinitionFile::GetFuncData(void) const
 	return pFuncData;
 }
 
+inline const LES_HashData* LES_DefinitionFile::GetHashData(void) const
+{
+	if (m_chunkFileData->GetNumChunks() <= LES_DEFINITION_HASHDATA)
+	{
+		return LES_NULL;
+	}
+	const void* chunkDataPtr = m_chunkFileData->GetChunkData(LES_DEFINITION_HASHDATA);
+	const LES_HashData* pHashData = (const LES_HashData*)chunkDataPtr;
+	return pHashData;
+}
+
 #endif // #ifndef LES_DEFINITIONFILE_HH
@@ -5,6 +5,7 @@ import les_stringtable
 import les_typedata
 import les_structdata
 import les_funcdata
+import les_hashdata
 import les_logger
 
 #{
@@ -15,6 +16,7 @@ import les_logger
 #	TYPE_DATA_CHUNK
 #	STRUCT_DATA_CHUNK
 #	FUNCTION_DATA_CHUNK
+#	HASH_DATA_CHUNK
 #}
 
 def loadTypeData(typeData):
@@ -36,6 +38,15 @@ def loadFunctionData(functionData):
 	if functionData.createTestErrorFunctionDefinitions() == False:
 		les_logger.FatalError("ERROR creating test error functionDefinitions")
 
+# Loaded after everything else : new test definitions don't change the existing string, type and function IDs
+def loadAppendedTestData(typeData, structData, functionData):
+	if typeData.loadXML("data/les_types_test2.xml") == False:
+		les_logger.FatalError("ERROR loading data/les_types_test2.xml")
+	if structData.loadXML("data/les_structs_test2.xml") == False:
+		les_logger.FatalError("ERROR loading data/les_structs_test2.xml")
+	if functionData.loadXML("data/les_functions_test2.xml") == False:
+		les_logger.FatalError("ERROR loading data/les_functions_test2.xml")
+
 class LES_DefinitionFile():
 	def __init__(self):
 		self.__m_chunkDatas__ = []
@@ -77,14 +88,17 @@ class LES_DefinitionFile():
 		typeData = les_typedata.LES_TypeData(stringTable)
 		structData = les_structdata.LES_StructData(stringTable, typeData)
 		functionData = les_funcdata.LES_FunctionData(stringTable, typeData, structData)
+		hashData = les_hashdata.LES_HashData(stringTable, typeData, structData, functionData)
 		loadTypeData(typeData)
 		loadStructData(structData)
 		loadFunctionData(functionData)
+		loadAppendedTestData(typeData, structData, functionData)
 
 		self.addChunk("StringTable", stringTable)
 		self.addChunk("TypeData", typeData)
 		self.addChunk("StructData", structData)
 		self.addChunk("FunctionData", functionData)
+		self.addChunk("HashData", hashData)
 
 	def getStringTable(self):
 		return self.getChunk("StringTable")
@@ -98,6 +112,9 @@ class LES_DefinitionFile():
 	def getFunctionData(self):
 		return self.getChunk("FunctionData")
 
+	def getHashData(self):
+		return self.getChunk("HashData")
+
 def runTest():
 	les_logger.Init()
 	this = LES_DefinitionFile()
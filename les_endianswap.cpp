@@ -0,0 +1,273 @@
+#include <string.h>
+
+#include "les_endianswap.h"
+
+/* Set to 0 to always use the scalar kernel */
+#ifndef LES_ENDIANSWAP_USE_SIMD
+#define LES_ENDIANSWAP_USE_SIMD 1
+#endif // #ifndef LES_ENDIANSWAP_USE_SIMD
+
+#if (BIG_ENDIAN_MACHINE == 0) && LES_ENDIANSWAP_USE_SIMD && defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define LES_ENDIANSWAP_X86 1
+#include <immintrin.h>
+#else
+#define LES_ENDIANSWAP_X86 0
+#endif
+
+typedef void LES_EndianSwapArrayFunction(char* const pOutData, const char* const pInData, const int numElements);
+
+struct LES_EndianSwapKernel
+{
+	const char* m_name;
+	LES_EndianSwapArrayFunction* m_swap16;
+	LES_EndianSwapArrayFunction* m_swap32;
+	LES_EndianSwapArrayFunction* m_swap64;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Internal Static functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Converting to and from big endian is the same byte swap : the scalar kernel is the per element conversion */
+static void LES_SwapArray16Scalar(char* const pOutData, const char* const pInData, const int numElements)
+{
+	for (int i = 0; i < numElements; i++)
+	{
+		toBigEndian16(pOutData + (i * 2), pInData + (i * 2));
+	}
+}
+
+static void LES_SwapArray32Scalar(char* const pOutData, const char* const pInData, const int numElements)
+{
+	for (int i = 0; i < numElements; i++)
+	{
+		toBigEndian32(pOutData + (i * 4), pInData + (i * 4));
+	}
+}
+
+static void LES_SwapArray64Scalar(char* const pOutData, const char* const pInData, const int numElements)
+{
+	for (int i = 0; i < numElements; i++)
+	{
+		toBigEndian64(pOutData + (i * 8), pInData + (i * 8));
+	}
+}
+
+static const LES_EndianSwapKernel les_endianSwapKernelScalar =
+{
+	"scalar", LES_SwapArray16Scalar, LES_SwapArray32Scalar, LES_SwapArray64Scalar
+};
+
+#if LES_ENDIANSWAP_X86
+
+/* Byte shuffles which reverse each element : the same for each 16 byte lane */
+static const char les_swapMask16[32] = { 1,0, 3,2, 5,4, 7,6, 9,8, 11,10, 13,12, 15,14,
+																				 1,0, 3,2, 5,4, 7,6, 9,8, 11,10, 13,12, 15,14 };
+static const char les_swapMask32[32] = { 3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12,
+																				 3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12 };
+static const char les_swapMask64[32] = { 7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+																				 7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8 };
+
+/* Returns the number of bytes swapped : whole 16 byte blocks only */
+__attribute__((target("ssse3")))
+static int LES_SwapBytesSSSE3(char* const pOutData, const char* const pInData, const int numBytes, const char* const swapMask)
+{
+	const __m128i mask = _mm_loadu_si128((const __m128i*)swapMask);
+	int i = 0;
+	for (; (i + 16) <= numBytes; i += 16)
+	{
+		const __m128i value = _mm_loadu_si128((const __m128i*)(pInData + i));
+		_mm_storeu_si128((__m128i*)(pOutData + i), _mm_shuffle_epi8(value, mask));
+	}
+	return i;
+}
+
+/* Returns the number of bytes swapped : whole 32 byte blocks then a 16 byte block */
+__attribute__((target("avx2")))
+static int LES_SwapBytesAVX2(char* const pOutData, const char* const pInData, const int numBytes, const char* const swapMask)
+{
+	const __m256i mask = _mm256_loadu_si256((const __m256i*)swapMask);
+	int i = 0;
+	for (; (i + 32) <= numBytes; i += 32)
+	{
+		const __m256i value = _mm256_loadu_si256((const __m256i*)(pInData + i));
+		_mm256_storeu_si256((__m256i*)(pOutData + i), _mm256_shuffle_epi8(value, mask));
+	}
+	if ((i + 16) <= numBytes)
+	{
+		const __m128i value = _mm_loadu_si128((const __m128i*)(pInData + i));
+		_mm_storeu_si128((__m128i*)(pOutData + i), _mm_shuffle_epi8(value, _mm256_castsi256_si128(mask)));
+		i += 16;
+	}
+	return i;
+}
+
+static void LES_SwapArray16SSSE3(char* const pOutData, const char* const pInData, const int numElements)
+{
+	const int numBytesSwapped = LES_SwapBytesSSSE3(pOutData, pInData, numElements * 2, les_swapMask16);
+	LES_SwapArray16Scalar(pOutData + numBytesSwapped, pInData + numBytesSwapped, numElements - (numBytesSwapped / 2));
+}
+
+static void LES_SwapArray32SSSE3(char* const pOutData, const char* const pInData, const int numElements)
+{
+	const int numBytesSwapped = LES_SwapBytesSSSE3(pOutData, pInData, numElements * 4, les_swapMask32);
+	LES_SwapArray32Scalar(pOutData + numBytesSwapped, pInData + numBytesSwapped, numElements - (numBytesSwapped / 4));
+}
+
+static void LES_SwapArray64SSSE3(char* const pOutData, const char* const pInData, const int numElements)
+{
+	const int numBytesSwapped = LES_SwapBytesSSSE3(pOutData, pInData, numElements * 8, les_swapMask64);
+	LES_SwapArray64Scalar(pOutData + numBytesSwapped, pInData + numBytesSwapped, numElements - (numBytesSwapped / 8));
+}
+
+static void LES_SwapArray16AVX2(char* const pOutData, const char* const pInData, const int numElements)
+{
+	const int numBytesSwapped = LES_SwapBytesAVX2(pOutData, pInData, numElements * 2, les_swapMask16);
+	LES_SwapArray16Scalar(pOutData + numBytesSwapped, pInData + numBytesSwapped, numElements - (numBytesSwapped / 2));
+}
+
+static void LES_SwapArray32AVX2(char* const pOutData, const char* const pInData, const int numElements)
+{
+	const int numBytesSwapped = LES_SwapBytesAVX2(pOutData, pInData, numElements * 4, les_swapMask32);
+	LES_SwapArray32Scalar(pOutData + numBytesSwapped, pInData + numBytesSwapped, numElements - (numBytesSwapped / 4));
+}
+
+static void LES_SwapArray64AVX2(char* const pOutData, const char* const pInData, const int numElements)
+{
+	const int numBytesSwapped = LES_SwapBytesAVX2(pOutData, pInData, numElements * 8, les_swapMask64);
+	LES_SwapArray64Scalar(pOutData + numBytesSwapped, pInData + numBytesSwapped, numElements - (numBytesSwapped / 8));
+}
+
+static const LES_EndianSwapKernel les_endianSwapKernelSSSE3 =
+{
+	"SSSE3", LES_SwapArray16SSSE3, LES_SwapArray32SSSE3, LES_SwapArray64SSSE3
+};
+
+static const LES_EndianSwapKernel les_endianSwapKernelAVX2 =
+{
+	"AVX2", LES_SwapArray16AVX2, LES_SwapArray32AVX2, LES_SwapArray64AVX2
+};
+
+#endif // #if LES_ENDIANSWAP_X86
+
+/* Always valid : the scalar kernel is used until LES_EndianSwapInit has been called */
+static const LES_EndianSwapKernel* les_endianSwapKernel = &les_endianSwapKernelScalar;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LES_EndianSwapInit(void)
+{
+	les_endianSwapKernel = &les_endianSwapKernelScalar;
+#if LES_ENDIANSWAP_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+	{
+		les_endianSwapKernel = &les_endianSwapKernelAVX2;
+	}
+	else if (__builtin_cpu_supports("ssse3"))
+	{
+		les_endianSwapKernel = &les_endianSwapKernelSSSE3;
+	}
+#endif // #if LES_ENDIANSWAP_X86
+}
+
+const char* LES_EndianSwapGetKernelName(void)
+{
+	return les_endianSwapKernel->m_name;
+}
+
+int LES_EndianSwapSetKernel(const char* const kernelName)
+{
+	if (strcmp(kernelName, les_endianSwapKernelScalar.m_name) == 0)
+	{
+		les_endianSwapKernel = &les_endianSwapKernelScalar;
+		return LES_RETURN_OK;
+	}
+#if LES_ENDIANSWAP_X86
+	__builtin_cpu_init();
+	if ((strcmp(kernelName, les_endianSwapKernelSSSE3.m_name) == 0) && __builtin_cpu_supports("ssse3"))
+	{
+		les_endianSwapKernel = &les_endianSwapKernelSSSE3;
+		return LES_RETURN_OK;
+	}
+	if ((strcmp(kernelName, les_endianSwapKernelAVX2.m_name) == 0) && __builtin_cpu_supports("avx2"))
+	{
+		les_endianSwapKernel = &les_endianSwapKernelAVX2;
+		return LES_RETURN_OK;
+	}
+#endif // #if LES_ENDIANSWAP_X86
+	return LES_RETURN_ERROR;
+}
+
+#if BIG_ENDIAN_MACHINE == 1
+
+void toBigEndianArray16(char* const pBigData, const char* const pInData, const int numElements)
+{
+	memcpy(pBigData, pInData, (size_t)numElements * 2);
+}
+
+void toBigEndianArray32(char* const pBigData, const char* const pInData, const int numElements)
+{
+	memcpy(pBigData, pInData, (size_t)numElements * 4);
+}
+
+void toBigEndianArray64(char* const pBigData, const char* const pInData, const int numElements)
+{
+	memcpy(pBigData, pInData, (size_t)numElements * 8);
+}
+
+void fromBigEndianArray16(char* const pOutData, const char* const pBigData, const int numElements)
+{
+	memcpy(pOutData, pBigData, (size_t)numElements * 2);
+}
+
+void fromBigEndianArray32(char* const pOutData, const char* const pBigData, const int numElements)
+{
+	memcpy(pOutData, pBigData, (size_t)numElements * 4);
+}
+
+void fromBigEndianArray64(char* const pOutData, const char* const pBigData, const int numElements)
+{
+	memcpy(pOutData, pBigData, (size_t)numElements * 8);
+}
+
+#else // #if BIG_ENDIAN_MACHINE == 1
+// Little Endian Machine
+
+void toBigEndianArray16(char* const pBigData, const char* const pInData, const int numElements)
+{
+	les_endianSwapKernel->m_swap16(pBigData, pInData, numElements);
+}
+
+void toBigEndianArray32(char* const pBigData, const char* const pInData, const int numElements)
+{
+	les_endianSwapKernel->m_swap32(pBigData, pInData, numElements);
+}
+
+void toBigEndianArray64(char* const pBigData, const char* const pInData, const int numElements)
+{
+	les_endianSwapKernel->m_swap64(pBigData, pInData, numElements);
+}
+
+void fromBigEndianArray16(char* const pOutData, const char* const pBigData, const int numElements)
+{
+	les_endianSwapKernel->m_swap16(pOutData, pBigData, numElements);
+}
+
+void fromBigEndianArray32(char* const pOutData, const char* const pBigData, const int numElements)
+{
+	les_endianSwapKernel->m_swap32(pOutData, pBigData, numElements);
+}
+
+void fromBigEndianArray64(char* const pOutData, const char* const pBigData, const int numElements)
+{
+	les_endianSwapKernel->m_swap64(pOutData, pBigData, numElements);
+}
+
+#endif // #if BIG_ENDIAN_MACHINE == 1
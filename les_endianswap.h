@@ -0,0 +1,24 @@
+#ifndef LES_ENDIANSWAP_HH
+#define LES_ENDIANSWAP_HH
+
+#include "les_base.h"
+
+/*
+ * Bulk versions of toBigEndian16/32/64 & fromBigEndian16/32/64 for arrays of 2, 4 & 8 byte PODs
+ * The kernel is selected at runtime from the CPU features by LES_EndianSwapInit : AVX2, SSSE3 or scalar
+ * The input and output arrays must not overlap : they don't need to be aligned
+*/
+void LES_EndianSwapInit(void);
+const char* LES_EndianSwapGetKernelName(void);
+/* Test only : uses the kernel "scalar", "SSSE3" or "AVX2" if the build & CPU support it, LES_EndianSwapInit picks the best again */
+int LES_EndianSwapSetKernel(const char* const kernelName);
+
+void toBigEndianArray16(char* const pBigData, const char* const pInData, const int numElements);
+void toBigEndianArray32(char* const pBigData, const char* const pInData, const int numElements);
+void toBigEndianArray64(char* const pBigData, const char* const pInData, const int numElements);
+
+void fromBigEndianArray16(char* const pOutData, const char* const pBigData, const int numElements);
+void fromBigEndianArray32(char* const pOutData, const char* const pBigData, const int numElements);
+void fromBigEndianArray64(char* const pOutData, const char* const pBigData, const int numElements);
+
+#endif // #ifndef LES_ENDIANSWAP_HH
@@ -55,10 +55,57 @@ def __DecodeArrayTokenIntoNameIndex__(token):
 #		LES_FunctionDefinition m_functionDefinitions[m_numFunctionDefinitions];	- variable 
 # };
 
+# byteOrder is the struct format byte order of the parameter data : ">" big endian or "=" native endian
+# varint is True if INTEGER types are written as zig-zag LEB128 varints (see les_varint.h)
 class LES_FunctionParameterData():
-	def __init__(self, memoryBuffer):
+	def __init__(self, memoryBuffer, byteOrder=">", varint=False):
 		self.__m_memoryBuffer__ = memoryBuffer
+		self.__m_byteOrder__ = byteOrder
+		self.__m_varint__ = varint
 		self.__m_readIndex__ = 0
+		self.__m_parameterRanges__ = {}
+
+	def GetReadIndex(self):
+		return self.__m_readIndex__
+
+	# Byte range of each decoded parameter : used to return output parameters in the same layout the client wrote them
+	def SetParameterRange(self, index, startIndex, endIndex):
+		self.__m_parameterRanges__[index] = (startIndex, endIndex)
+
+	def GetParameterBytes(self, index):
+		if index not in self.__m_parameterRanges__:
+			return None
+		(startIndex, endIndex) = self.__m_parameterRanges__[index]
+		return self.__m_memoryBuffer__[startIndex:endIndex]
+
+	# The count at the start of a variable sized type : an error if the data is truncated
+	def ReadCount(self):
+		if (self.__m_readIndex__ + les_typedata.LES_TYPE_COUNT_SIZE) > len(self.__m_memoryBuffer__):
+			les_logger.Warning("LES_FunctionParameterData::ReadCount truncated numBytesToRead:%d", len(self.__m_memoryBuffer__) - self.__m_readIndex__)
+			return (LES_RETURN_ERROR, 0)
+		countData = self.__m_memoryBuffer__[self.__m_readIndex__:self.__m_readIndex__ + les_typedata.LES_TYPE_COUNT_SIZE]
+		count = struct.unpack(self.__m_byteOrder__ + "I", countData)[0]
+		self.__m_readIndex__ += les_typedata.LES_TYPE_COUNT_SIZE
+		return (LES_RETURN_OK, count)
+
+	# Same as LES_ReadVarint : returns None if the varint is truncated, too long or doesn't fit in numBytes
+	def ReadVarint(self, numBytes):
+		maxVarintSize = ((numBytes * 8) + 1 + 6) / 7
+		zigZag = 0
+		for i in range(maxVarintSize):
+			if self.__m_readIndex__ + i >= len(self.__m_memoryBuffer__):
+				return None
+			byte = ord(self.__m_memoryBuffer__[self.__m_readIndex__ + i])
+			zigZag |= (byte & 0x7F) << (7 * i)
+			if (byte & 0x80) == 0:
+				value = (zigZag >> 1) ^ -(zigZag & 1)
+				numBits = numBytes * 8
+				if (value < -(1 << (numBits - 1))) or (value >= (1 << (numBits - 1))):
+					return None
+				self.__m_readIndex__ += i + 1
+				packFormats = { 2:"=h", 4:"=i", 8:"=q" }
+				return struct.pack(packFormats[numBytes], value)
+		return None
 
 	def Read(self, stringTable, typeData, typeName):
 		value = None
@@ -67,6 +114,21 @@ class LES_FunctionParameterData():
 			les_logger.Warning("LES_FunctionParameterData::Read type:'%s' not found", typeName)
 			return (LES_RETURN_ERROR, value)
 
+		# Strings are the count then the chars without the terminator
+		if typeEntry.m_flags & les_typedata.LES_TYPE_STRING:
+			(errorCode, count) = self.ReadCount()
+			if errorCode == LES_RETURN_ERROR:
+				return (LES_RETURN_ERROR, value)
+			if count > typeEntry.m_numElements:
+				les_logger.Warning("LES_FunctionParameterData::Read type:'%s' invalid count:%d max:%d", typeName, count, typeEntry.m_numElements)
+				return (LES_RETURN_ERROR, value)
+			if (self.__m_readIndex__ + count) > len(self.__m_memoryBuffer__):
+				les_logger.Warning("LES_FunctionParameterData::Read type:'%s' truncated count:%d", typeName, count)
+				return (LES_RETURN_ERROR, value)
+			value = self.__m_memoryBuffer__[self.__m_readIndex__:self.__m_readIndex__ + count]
+			self.__m_readIndex__ += count
+			return (LES_RETURN_OK, value)
+
 		aliasedTypeName = stringTable.getString(typeEntry.m_aliasedTypeID)
 		if aliasedTypeName == None:
 			les_logger.Warning("LES_FunctionParameterData::Read type:'%s' aliasedStringEntry:%d not found", typeName, typeEntry.m_aliasedTypeID)
@@ -85,18 +147,24 @@ class LES_FunctionParameterData():
 
 		if ((flags & les_typedata.LES_TYPE_POD) or (flags & les_typedata.LES_TYPE_STRUCT)):
 #			les_logger.Log("Read type:'%s' size:%d %d", typeName, typeEntry.m_dataSize, self.__m_readIndex__)
+			if self.__m_varint__ and (flags & les_typedata.LES_TYPE_INTEGER):
+				value = self.ReadVarint(parameterDataSize)
+				if value == None:
+					les_logger.Error("LES_FunctionParameterData::Read type:'%s' invalid varint for size:%d", typeName, parameterDataSize)
+					return (LES_RETURN_ERROR, value)
+				return (LES_RETURN_OK, value)
 			if flags & les_typedata.LES_TYPE_ENDIANSWAP:
 				if parameterDataSize == 2:
 					bigData = self.__m_memoryBuffer__[self.__m_readIndex__:self.__m_readIndex__ + 2]
-					unpackData = struct.unpack(">H", bigData)[0]
+					unpackData = struct.unpack(self.__m_byteOrder__ + "H", bigData)[0]
 					value = struct.pack("=H", unpackData)
 				elif parameterDataSize == 4:
 					bigData = self.__m_memoryBuffer__[self.__m_readIndex__:self.__m_readIndex__ + 4]
-					unpackData = struct.unpack(">I", bigData)[0]
+					unpackData = struct.unpack(self.__m_byteOrder__ + "I", bigData)[0]
 					value = struct.pack("=I", unpackData)
 				elif parameterDataSize == 8:
 					bigData = self.__m_memoryBuffer__[self.__m_readIndex__:self.__m_readIndex__ + 8]
-					unpackData = struct.unpack(">Q", bigData)[0]
+					unpackData = struct.unpack(self.__m_byteOrder__ + "Q", bigData)[0]
 					value = struct.pack("=Q", unpackData)
 				else:
 					les_logger.Error("LES_FunctionParameterData::Read type:'%s' marked for ENDIANSWAP but unknown size to swap:%d", 
@@ -127,6 +195,38 @@ def __DecodeSingle__(logChannel, stringTable, typeData, structData, functionPara
 
 	typeFlags = typeEntry.m_flags
 
+	if typeFlags & les_typedata.LES_TYPE_STRING:
+		(errorCode, value) = functionParameterData.Read(stringTable, typeData, typeStr)
+		if errorCode != LES_RETURN_OK:
+			les_logger.Warning("DecodeSingle Read failed for parameter[%d]:%s", parameterIndex, nameStr)
+			return (LES_RETURN_ERROR, returnParamList)
+
+		fullNameStr = nameStr
+		if len(rootParamString) > 0:
+			fullNameStr = ("%s.%s" % (rootParamString, nameStr))
+		if elementIndex >= 0:
+			fullNameStr += ("[%d]" % (elementIndex))
+
+		output = ("DecodeSingle parameter[%d]:'%s' type:'%s' value:'%s'" % (parameterIndex, fullNameStr, typeStr, value))
+		les_logger.Log(output)
+		if logChannel != None:
+			logChannel.Print(output)
+
+		returnParamList.append(fullNameStr)
+		returnParamList.append(value)
+		return (LES_RETURN_OK, returnParamList)
+
+	# Decode the elements which were sent : the count is before them
+	isDynamicArray = (typeFlags & les_typedata.LES_TYPE_DYNAMIC_ARRAY) != 0
+	if isDynamicArray:
+		(errorCode, count) = functionParameterData.ReadCount()
+		if errorCode == LES_RETURN_ERROR:
+			return (LES_RETURN_ERROR, returnParamList)
+		if count > numElements:
+			les_logger.Warning("DecodeSingle parameter[%d]:'%s' type:'%s' invalid count:%d max:%d", parameterIndex, nameStr, typeStr, count, numElements)
+			return (LES_RETURN_ERROR, returnParamList)
+		numElements = count
+
 	typeEntry = typeEntry.GetRootType(stringTable, typeData)
 	aliasedTypeID = typeEntry.m_aliasedTypeID
 	typeFlags = typeEntry.m_flags
@@ -142,6 +242,12 @@ def __DecodeSingle__(logChannel, stringTable, typeData, structData, functionPara
 		headerOutput += (":'%s'" % (nameStr))
 	headerOutput += (" type:'%s'" % (typeStr))
 
+	if isDynamicArray and numElements == 0:
+		les_logger.Log(headerOutput)
+		if logChannel != None:
+			logChannel.Print(headerOutput)
+		return (LES_RETURN_OK, returnParamList)
+
 	if typeFlags & les_typedata.LES_TYPE_STRUCT:
 		les_logger.Log(headerOutput)
 		if logChannel != None:
@@ -268,9 +374,9 @@ def __DecodeSingle__(logChannel, stringTable, typeData, structData, functionPara
 	if unpackFormat == None:
 		output += (" typeDataSize:%d struct:%d" % (typeDataSize, (typeEntry.m_flags & les_typedata.LES_TYPE_STRUCT)))
 
-	les_logger.Log(output)
+	les_logger.Log("%s", output)
 	if logChannel != None:
-		logChannel.Print(output)
+		logChannel.Print("%s", output)
 
 	returnParamList = []
 	returnParamList.append(fullNameStr)
@@ -478,10 +584,12 @@ class LES_FunctionDefinintion():
 			functionParameter = self.GetParameterByIndex(i)
 			nameID = functionParameter.m_nameID
 			typeID = functionParameter.m_typeID
+			startIndex = functionParameterData.GetReadIndex()
 			(returnCode, paramList) = __DecodeSingle__(logChannel, stringTable, typeData, structData, functionParameterData, 
 																										i, nameID, typeID, "", -1)
 			if returnCode != LES_RETURN_OK:
 				return (LES_RETURN_ERROR, functionParamList)
+			functionParameterData.SetParameterRange(i, startIndex, functionParameterData.GetReadIndex())
 			functionParamList.append(paramList)
 
 		# Build paramDict
@@ -598,6 +706,15 @@ class LES_FunctionData():
 			return None
 		return self.__m_functionDefinitions__[index]
 
+	def getNumFunctionDefinitions(self):
+		return len(self.__m_functionDefinitions__)
+
+	def getFunctionDefinitionByIndex(self, index):
+		return self.__m_functionDefinitions__[index]
+
+	def getFunctionDefinitionNameByIndex(self, index):
+		return self.__m_functionDefinitionNames__[index]
+
 	def write(self, binFile):
 		basePosition = binFile.getIndex()
 		# LES_FunctionData
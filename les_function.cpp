@@ -9,6 +9,11 @@
 #include "les_parameter.h"
 #include "les_struct.h"
 #include "les_funcdata.h"
+#include "les_parameterplan.h"
+#include "les_parameterpool.h"
+#include "les_decode.h"
+#include "les_hashindex.h"
+#include "les_hashdata.h"
 
 static const LES_FunctionDefinition** les_functionDefinitionArray = LES_NULL;
 static int les_numFunctionDefinitions = 0;
@@ -16,6 +21,26 @@ static int les_numFunctionDefinitions = 0;
 static const LES_FuncData* les_pFuncData = LES_NULL;
 static int les_funcDataNumFunctionDefinitions = 0;
 
+/* Perfect hash of the definition file func data : NULL if the definition file doesn't have one */
+static const LES_HashTable* les_pFuncDataHashTable = LES_NULL;
+
+/* Function definition IDs by name hash : the internal list and the definition file func data if it isn't perfect hashed */
+static LES_HashIndex les_functionDefinitionIndex;
+
+/* Bumped whenever the function, struct or type definitions change - used to invalidate call-site caches */
+static int les_functionDefinitionGeneration = 0;
+
+/* The definition generation the cached plans & decode layouts were built for */
+static int les_functionPlanGeneration = -1;
+
+/* Serialisation plans : same indexing as the definitions */
+static LES_FunctionPlan** les_functionPlanArray = LES_NULL;
+static LES_FunctionPlan** les_funcDataPlanArray = LES_NULL;
+
+/* Decode layouts : same indexing as the definitions, created on first use */
+static LES_DecodeLayout** les_functionDecodeLayoutArray = LES_NULL;
+static LES_DecodeLayout** les_funcDataDecodeLayoutArray = LES_NULL;
+
 void LES_DebugOutputFunctionDefinition(LES_LoggerChannel* const pLogChannel, 
 																			 const LES_FunctionDefinition* const pFunctionDefinition, const int i);
 
@@ -44,290 +69,145 @@ static const LES_FunctionDefinition* LES_GetFunctionDefinitionForID(const int id
 	return pFunctionDefinition;
 }
 
+/* The only func data function definition which can have the name hash : -1 if there isn't a perfect hash */
+static int LES_GetFuncDataCandidateIndex(const LES_Hash functionNameHash)
+{
+	if (les_pFuncDataHashTable == LES_NULL)
+	{
+		return -1;
+	}
+	return les_pFuncDataHashTable->Find(functionNameHash);
+}
+
 static int LES_GetFunctionDefinitionIndexByNameID(const int nameID)
 {
-	if (les_pFuncData)
+	const LES_StringEntry* const functionNameStringEntryPtr = LES_GetStringEntryForID(nameID);
+	if (functionNameStringEntryPtr == LES_NULL)
 	{
-		const int index = les_pFuncData->GetFunctionDefinitionIndexByNameID(nameID);
-		if (index >= 0)
-		{
-			return index;
-		}
+		return -1;
 	}
-	/* This is horribly slow - need hash lookup table */
-	for (int i = 0; i < les_numFunctionDefinitions; i++)
+	const LES_Hash functionNameHash = functionNameStringEntryPtr->m_hash;
+	const int index = LES_GetFuncDataCandidateIndex(functionNameHash);
+	if ((index >= 0) && (les_pFuncData->GetFunctionDefinition(index)->GetNameID() == nameID))
+	{
+		return index;
+	}
+	int slot;
+	for (int id = les_functionDefinitionIndex.Find(functionNameHash, &slot); id >= 0; 
+			 id = les_functionDefinitionIndex.FindNext(functionNameHash, &slot))
 	{
-		const LES_FunctionDefinition* const functionDefinitionPtr = les_functionDefinitionArray[i];
+		const LES_FunctionDefinition* const functionDefinitionPtr = LES_GetFunctionDefinitionForID(id);
 		if (functionDefinitionPtr->GetNameID() == nameID)
 		{
-			return i + les_funcDataNumFunctionDefinitions;
+			return id;
 		}
 	}
 	return -1;
 }
 
-static int LES_GetFunctionDefinitionIndex(const char* const name)
+static int LES_GetFunctionDefinitionIndex(const char* const name, const LES_Hash functionNameHash)
 {
-	const LES_Hash functionNameHash = LES_GenerateHashCaseSensitive(name);
-	if (les_pFuncData)
+	const int index = LES_GetFuncDataCandidateIndex(functionNameHash);
+	if (index >= 0)
 	{
-		const int index = les_pFuncData->GetFunctionDefinitionIndex(functionNameHash);
-		if (index >= 0)
+		const int nameID = les_pFuncData->GetFunctionDefinition(index)->GetNameID();
+		if (strcmp(LES_GetStringEntryForID(nameID)->m_str, name) == 0)
 		{
 			return index;
 		}
 	}
-
-	/* This is horribly slow - need hash lookup table */
-	for (int i = 0; i < les_numFunctionDefinitions; i++)
+	int slot;
+	for (int id = les_functionDefinitionIndex.Find(functionNameHash, &slot); id >= 0; 
+			 id = les_functionDefinitionIndex.FindNext(functionNameHash, &slot))
 	{
-		const LES_FunctionDefinition* const functionDefinitionPtr = les_functionDefinitionArray[i];
+		const LES_FunctionDefinition* const functionDefinitionPtr = LES_GetFunctionDefinitionForID(id);
 		const LES_StringEntry* const functionNameStringEntryPtr = LES_GetStringEntryForID(functionDefinitionPtr->GetNameID());
-		if (functionNameStringEntryPtr->m_hash == functionNameHash)
+		if (strcmp(functionNameStringEntryPtr->m_str, name) == 0)
 		{
-			if (strcmp(functionNameStringEntryPtr->m_str, name) == 0)
-			{
-				return i + les_funcDataNumFunctionDefinitions;
-			}
+			return id;
 		}
 	}
 	return -1;
 }
 
-static int DecodeSingle(LES_LoggerChannel* const pLogChannel, const LES_FunctionParameterData* const functionParameterData, 
-												const int parameterIndex, const int nameID, const int typeID, 
-												const char* const rootParamString, const int elementIndex)
+static void LES_FreeFuncDataPlans(void)
 {
-	const LES_StringEntry* const nameEntry = LES_GetStringEntryForID(nameID);
-	const LES_StringEntry* typeStringEntry = LES_GetStringEntryForID(typeID);
-	const LES_TypeEntry* typeEntryPtr = LES_GetTypeEntry(typeStringEntry);
-
-	const char* const nameStr = nameEntry->m_str;
-	const char* const typeStr = typeStringEntry->m_str;
-
-#if LES_FUNCTION_DEBUG
-	LES_LOG("DecodeSingle: '%s' '%s' %d", nameStr, typeStr, typeID);
-#endif // #if LES_FUNCTION_DEBUG
-
-	if (typeEntryPtr == LES_NULL)
-	{
-		LES_WARNING("DecodeSingle parameter[%d]:'%s' type:'%s' type can't be found", parameterIndex, nameStr, typeStr);
-		return LES_RETURN_ERROR;
-	}
-	const int numElements = typeEntryPtr->m_numElements;
-	int aliasedTypeID = typeEntryPtr->m_aliasedTypeID;
-
-	unsigned int typeFlags = typeEntryPtr->m_flags;
-
-	typeEntryPtr = typeEntryPtr->GetRootType();
-	aliasedTypeID = typeEntryPtr->m_aliasedTypeID;
-	typeFlags = typeEntryPtr->m_flags;
-	typeStringEntry = LES_GetStringEntryForID(aliasedTypeID);
-
-	const int typeDataSize = typeEntryPtr->m_dataSize;
-
-	char headerOutput[1024];
-	headerOutput[0] = '\0';
-	sprintf(headerOutput, "DecodeSingle parameter[%d]", parameterIndex);
-	if (rootParamString[0] != '\0')
+	if (les_funcDataPlanArray == LES_NULL)
 	{
-		sprintf(headerOutput, "%s:'%s.%s'", headerOutput, rootParamString, nameStr);
+		return;
 	}
-	else
+	for (int i = 0; i < les_funcDataNumFunctionDefinitions; i++)
 	{
-		sprintf(headerOutput, "%s:'%s'", headerOutput, nameStr);
+		LES_DestroyFunctionPlan(les_funcDataPlanArray[i]);
 	}
-	sprintf(headerOutput, "%s type:'%s'", headerOutput, typeStr);
+	delete[] les_funcDataPlanArray;
+	les_funcDataPlanArray = LES_NULL;
+}
 
-	if (typeFlags & LES_TYPE_STRUCT)
+static void LES_FreeFuncDataDecodeLayouts(void)
+{
+	if (les_funcDataDecodeLayoutArray == LES_NULL)
 	{
-		LES_LOG(headerOutput);
-		if (pLogChannel)
-		{
-			pLogChannel->Print(headerOutput);
-		}
-
-		int localNumElements = numElements;
-		if (localNumElements < 1)
-		{
-			localNumElements = 1;
-		}
-
-#if LES_FUNCTION_DEBUG
-		LES_LOG("DecodeSingle parameter[%d]:'%s' type:'%s' size:%d ARRAY numELements:%d", 
-						parameterIndex, nameStr, typeStr, typeDataSize, numElements);
-		LES_LOG("DecodeSingle parameter[%d]:'%s' type:'%s' size:%d STRUCT", parameterIndex, nameStr, typeStr, typeDataSize);
-#endif // #if LES_FUNCTION_DEBUG
-		int returnCode = LES_RETURN_OK;
-		const LES_StructDefinition* const structDefinition = LES_GetStructDefinition(typeEntryPtr->m_hash);
-		if (structDefinition == LES_NULL)
-		{
-			LES_WARNING("DecodeSingle parameter[%d]:'%s' type:'%s' is a struct but can't be found", parameterIndex, nameStr, typeStr);
-			return LES_RETURN_ERROR;
-		}
-		const int numMembers = structDefinition->GetNumMembers();
-		for (int e = 0; e < localNumElements; e++)
-		{
-			char parentParamString[1024];
-			parentParamString[0] = '\0';
-			if (rootParamString[0] != '\0')
-			{
-				sprintf(parentParamString, "%s.", rootParamString);
-			}
-			sprintf(parentParamString, "%s%s", parentParamString, nameStr);
-			if (localNumElements > 1)
-			{
-				sprintf(parentParamString, "%s[%d]", parentParamString, e);
-			}
-			for (int i = 0; i < numMembers; i++)
-			{
-				const LES_StructMember* const structMember = structDefinition->GetMemberByIndex(i);
-				const int memberNameID = structMember->m_nameID;
-				const int memberTypeID = structMember->m_typeID;
-				returnCode = DecodeSingle(pLogChannel, functionParameterData, parameterIndex, memberNameID, memberTypeID, parentParamString, -1);
-				if (returnCode != LES_RETURN_OK)
-				{
-					return LES_RETURN_ERROR;
-				}
-			}
-		}
-		return returnCode;
+		return;
 	}
-	if (numElements > 0)
+	for (int i = 0; i < les_funcDataNumFunctionDefinitions; i++)
 	{
-		LES_LOG(headerOutput);
-		if (pLogChannel)
-		{
-			pLogChannel->Print(headerOutput);
-		}
-		int returnCode = LES_RETURN_OK;
-#if LES_FUNCTION_DEBUG
-		LES_LOG("DecodeSingle parameter[%d]:'%s' type:'%s' size:%d ARRAY numELements:%d", 
-						parameterIndex, nameStr, typeStr, typeDataSize, numElements);
-#endif // #if LES_FUNCTION_DEBUG
-		const int elementNameID = nameID;
-		const int elementTypeID = aliasedTypeID;
-		char parentParamString[1024];
-		parentParamString[0] = '\0';
-		if (rootParamString[0] != '\0')
-		{
-			sprintf(parentParamString, "%s", rootParamString);
-		}
-		for (int i = 0; i < numElements; i++)
-		{
-			returnCode = DecodeSingle(pLogChannel, functionParameterData, parameterIndex, elementNameID, elementTypeID, parentParamString, i);
-			if (returnCode != LES_RETURN_OK)
-			{
-				return LES_RETURN_ERROR;
-			}
-		}
-		return returnCode;
+		LES_DestroyDecodeLayout(les_funcDataDecodeLayoutArray[i]);
 	}
+	delete[] les_funcDataDecodeLayoutArray;
+	les_funcDataDecodeLayoutArray = LES_NULL;
+}
 
-	const LES_Hash typeHash = typeEntryPtr->m_hash;
-
-	long long int longlongValue;
-	int intValue;
-	short shortValue;
-	char charValue;
-	float floatValue;
-
-	void* valuePtr = LES_NULL;
-	const char* fmtStr = LES_NULL;
-
-	if (typeHash == LES_TypeEntry::s_longlongHash)
-	{
-		valuePtr = &longlongValue;
-		fmtStr = "%ld";
-	}
-	else if ((typeHash == LES_TypeEntry::s_intHash) || (typeHash == LES_TypeEntry::s_uintHash))
-	{
-		valuePtr = &intValue;
-		fmtStr = "%d";
-	}
-	else if ((typeHash == LES_TypeEntry::s_shortHash) || (typeHash == LES_TypeEntry::s_ushortHash))
-	{
-		valuePtr = &shortValue;
-		fmtStr = "%d";
-	}
-	else if ((typeHash == LES_TypeEntry::s_charHash) || (typeHash == LES_TypeEntry::s_ucharHash))
-	{
-		valuePtr = &charValue;
-		fmtStr = "'%c'";
-	}
-	else if (typeHash == LES_TypeEntry::s_floatHash)
+/* Plans & decode layouts bake in type sizes and struct layouts : drop them when any definition changes */
+static void LES_FunctionFlushPlans(void)
+{
+	if (les_functionPlanGeneration == les_functionDefinitionGeneration)
 	{
-		valuePtr = &floatValue;
-		fmtStr = "%.3f";
+		return;
 	}
-	// An unknown type just grab it
-	if (valuePtr == LES_NULL)
+	les_functionPlanGeneration = les_functionDefinitionGeneration;
+	for (int i = 0; i < les_numFunctionDefinitions; i++)
 	{
-		valuePtr = new char[typeDataSize];
+		LES_DestroyFunctionPlan(les_functionPlanArray[i]);
+		les_functionPlanArray[i] = LES_NULL;
+		LES_DestroyDecodeLayout(les_functionDecodeLayoutArray[i]);
+		les_functionDecodeLayoutArray[i] = LES_NULL;
 	}
-	if (valuePtr == LES_NULL)
+	for (int i = 0; (les_funcDataPlanArray != LES_NULL) && (i < les_funcDataNumFunctionDefinitions); i++)
 	{
-		LES_WARNING("DecodeSingle valuePtr = LES_NULL parameter[%d]:'%s'", parameterIndex, nameStr);
-		return LES_RETURN_ERROR;
+		LES_DestroyFunctionPlan(les_funcDataPlanArray[i]);
+		les_funcDataPlanArray[i] = LES_NULL;
 	}
-	int errorCode = functionParameterData->Read(typeStringEntry, valuePtr);
-	if (errorCode != LES_RETURN_OK)
+	for (int i = 0; (les_funcDataDecodeLayoutArray != LES_NULL) && (i < les_funcDataNumFunctionDefinitions); i++)
 	{
-		LES_WARNING("DecodeSingle Read failed for parameter[%d]:%s", parameterIndex, nameStr);
-		return LES_RETURN_ERROR;
+		LES_DestroyDecodeLayout(les_funcDataDecodeLayoutArray[i]);
+		les_funcDataDecodeLayoutArray[i] = LES_NULL;
 	}
-	char output[1024];
-	output[0] = '\0';
-	sprintf(output, "DecodeSingle parameter[%d]", parameterIndex);
+}
 
-	if (rootParamString[0] != '\0')
+/* Returns the id of the function definition or -1 if it isn't the definition registered for its name */
+static int LES_GetFunctionDefinitionID(const LES_FunctionDefinition* const functionDefinitionPtr)
+{
+	if (functionDefinitionPtr == LES_NULL)
 	{
-		sprintf(output, "%s:'%s.%s", output, rootParamString, nameStr);
+		return -1;
 	}
-	else
+	const int id = LES_GetFunctionDefinitionIndexByNameID(functionDefinitionPtr->GetNameID());
+	if (id < 0)
 	{
-		sprintf(output, "%s:'%s", output, nameStr);
+		return -1;
 	}
-
-	if (elementIndex >= 0)
+	if (LES_GetFunctionDefinitionForID(id) != functionDefinitionPtr)
 	{
-		sprintf(output, "%s[%d]", output, elementIndex);
+		return -1;
 	}
+	return id;
+}
 
-	sprintf(output, "%s' type:'%s' value:", output, typeStr);
-
-	char tempString[1024];
-	if (typeHash == LES_TypeEntry::s_longlongHash)
-	{
-		sprintf(tempString, fmtStr, longlongValue);
-	}
-	else if ((typeHash == LES_TypeEntry::s_intHash) || (typeHash == LES_TypeEntry::s_uintHash))
-	{
-		sprintf(tempString, fmtStr, intValue);
-	}
-	else if ((typeHash == LES_TypeEntry::s_shortHash) || (typeHash == LES_TypeEntry::s_ushortHash))
-	{
-		sprintf(tempString, fmtStr, shortValue);
-	}
-	else if ((typeHash == LES_TypeEntry::s_charHash) || (typeHash == LES_TypeEntry::s_ucharHash))
-	{
-		sprintf(tempString, fmtStr, charValue);
-	}
-	else if (typeHash == LES_TypeEntry::s_floatHash)
-	{
-		sprintf(tempString, fmtStr, floatValue);
-	}
-	else
-	{
-		sprintf(tempString, ":UNKNOWN typeDataSize:%d struct:%d", typeDataSize, (typeEntryPtr->m_flags&LES_TYPE_STRUCT));
-	}
-	sprintf(output, "%s%s", output, tempString);
-	LES_LOG(output);
-	if (pLogChannel)
-	{
-		pLogChannel->Print(output);
-	}
-	return LES_RETURN_OK;
+static int LES_GetFunctionDefinitionIndex(const char* const name)
+{
+	const LES_Hash functionNameHash = LES_GenerateHashCaseSensitive(name);
+	return LES_GetFunctionDefinitionIndex(name, functionNameHash);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -338,7 +218,13 @@ static int DecodeSingle(LES_LoggerChannel* const pLogChannel, const LES_Function
 
 const LES_FunctionDefinition* LES_GetFunctionDefinition(const char* const name)
 {
-	const int index = LES_GetFunctionDefinitionIndex(name);
+	const LES_Hash nameHash = LES_GenerateHashCaseSensitive(name);
+	return LES_GetFunctionDefinition(name, nameHash);
+}
+
+const LES_FunctionDefinition* LES_GetFunctionDefinition(const char* const name, const LES_Hash nameHash)
+{
+	const int index = LES_GetFunctionDefinitionIndex(name, nameHash);
 	if (index < 0)
 	{
 		return LES_NULL;
@@ -355,16 +241,86 @@ LES_FunctionParameterData* LES_GetFunctionParameterData(const int functionNameID
 		return LES_NULL;
 	}
 	const LES_FunctionDefinition* const functionDefinitionPtr = LES_GetFunctionDefinitionForID(index);
-	const int parameterDataSize = functionDefinitionPtr->GetParameterDataSize();
-	char* parameterBuffer = LES_NULL;
-	if (parameterDataSize > 0)
+	return LES_GetFunctionParameterData(functionDefinitionPtr);
+}
+
+LES_FunctionParameterData* LES_GetFunctionParameterData(const LES_FunctionDefinition* const functionDefinitionPtr)
+{
+	if (functionDefinitionPtr == LES_NULL)
 	{
-		parameterBuffer = new char[parameterDataSize];
+		return LES_NULL;
 	}
-	LES_FunctionParameterData* const parameterData = new LES_FunctionParameterData(parameterBuffer);
+	/* Varint parameter data can be bigger than the definition's parameter data size */
+	const int parameterDataSize = LES_GetMaxParameterDataSize(functionDefinitionPtr->GetParameterDataSize());
+	LES_FunctionParameterData* const parameterData = LES_ParameterPoolAlloc(parameterDataSize);
 	return parameterData;
 }
 
+void LES_AddRefFunctionParameterData(LES_FunctionParameterData* const parameterData)
+{
+	LES_ParameterPoolAddRef(parameterData);
+}
+
+void LES_ReleaseFunctionParameterData(LES_FunctionParameterData* const parameterData)
+{
+	LES_ParameterPoolFree(parameterData);
+}
+
+int LES_GetFunctionDefinitionGeneration(void)
+{
+	return les_functionDefinitionGeneration;
+}
+
+void LES_Function_BumpDefinitionGeneration(void)
+{
+	les_functionDefinitionGeneration++;
+}
+
+const LES_FunctionPlan* LES_GetFunctionPlan(const LES_FunctionDefinition* const functionDefinitionPtr)
+{
+	LES_FunctionFlushPlans();
+	const int id = LES_GetFunctionDefinitionID(functionDefinitionPtr);
+	if (id < 0)
+	{
+		return LES_NULL;
+	}
+	const int index = (id - les_funcDataNumFunctionDefinitions);
+	LES_FunctionPlan** const planArray = (index < 0) ? les_funcDataPlanArray : les_functionPlanArray;
+	const int planIndex = (index < 0) ? id : index;
+	if (planArray == LES_NULL)
+	{
+		return LES_NULL;
+	}
+	/* Compiled on first use after the definitions change : runtime function types may be added after the function */
+	if (planArray[planIndex] == LES_NULL)
+	{
+		planArray[planIndex] = LES_CreateFunctionPlan(functionDefinitionPtr);
+	}
+	return planArray[planIndex];
+}
+
+const LES_DecodeLayout* LES_GetFunctionDecodeLayout(const LES_FunctionDefinition* const functionDefinitionPtr)
+{
+	LES_FunctionFlushPlans();
+	const int id = LES_GetFunctionDefinitionID(functionDefinitionPtr);
+	if (id < 0)
+	{
+		return LES_NULL;
+	}
+	const int index = (id - les_funcDataNumFunctionDefinitions);
+	LES_DecodeLayout** const decodeLayoutArray = (index < 0) ? les_funcDataDecodeLayoutArray : les_functionDecodeLayoutArray;
+	const int decodeLayoutIndex = (index < 0) ? id : index;
+	if (decodeLayoutArray == LES_NULL)
+	{
+		return LES_NULL;
+	}
+	if (decodeLayoutArray[decodeLayoutIndex] == LES_NULL)
+	{
+		decodeLayoutArray[decodeLayoutIndex] = LES_CreateDecodeLayout(functionDefinitionPtr);
+	}
+	return decodeLayoutArray[decodeLayoutIndex];
+}
+
 int LES_FunctionDefinition::ComputeParameterDataSize(void) const
 {
 	int parameterDataSize = 0;
@@ -373,13 +329,7 @@ int LES_FunctionDefinition::ComputeParameterDataSize(void) const
 	for (int i = 0; i < numParams; i++)
 	{
 		const LES_FunctionParameter* const memberPtr = GetParameterByIndex(i);
-		const int typeID = memberPtr->m_typeID;
-		const LES_StringEntry* const typeStringEntryPtr = LES_GetStringEntryForID(typeID);
-		if (typeStringEntryPtr == LES_NULL)
-		{
-			return -1;
-		}
-		const LES_TypeEntry* const typeEntryPtr = LES_GetTypeEntry(typeStringEntryPtr);
+		const LES_TypeEntry* const typeEntryPtr = LES_GetTypeEntryForStringID(memberPtr->m_typeID);
 		if (typeEntryPtr == LES_NULL)
 		{
 			return -1;
@@ -391,6 +341,24 @@ int LES_FunctionDefinition::ComputeParameterDataSize(void) const
 	return parameterDataSize;
 }
 
+/* The size when every variable sized parameter is empty : the same as ComputeParameterDataSize if there are none */
+int LES_FunctionDefinition::ComputeMinParameterDataSize(void) const
+{
+	int parameterDataSize = 0;
+	const int numParams = GetNumParameters();
+	for (int i = 0; i < numParams; i++)
+	{
+		const LES_FunctionParameter* const memberPtr = GetParameterByIndex(i);
+		const LES_TypeEntry* const typeEntryPtr = LES_GetTypeEntryForStringID(memberPtr->m_typeID);
+		if (typeEntryPtr == LES_NULL)
+		{
+			return -1;
+		}
+		parameterDataSize += typeEntryPtr->ComputeMinDataStorageSize();
+	}
+	return parameterDataSize;
+}
+
 int LES_FunctionDefinition::GetNumParameters(void) const 
 {
 	return (m_numInputs + m_numOutputs);
@@ -449,26 +417,27 @@ const LES_FunctionParameter* LES_FunctionDefinition::GetParameterByIndex(const i
 int LES_FunctionDefinition::Decode(LES_LoggerChannel* const pLogChannel, 
 																		const LES_FunctionParameterData* const functionParameterData) const
 {
-	int returnCode = LES_RETURN_OK;
-	const int functionNameID = GetNameID();
-	const char* const functionName = LES_GetStringEntryForID(functionNameID)->m_str;
-	const int numParameters = GetNumParameters();
-	LES_LOG("Decode Function '%s' numParams:%d", functionName, numParameters);
-	if (pLogChannel)
+	LES_DecodeLogVisitor logVisitor(pLogChannel);
+	return Decode(&logVisitor, functionParameterData);
+}
+
+int LES_FunctionDefinition::Decode(LES_DecodeVisitor* const visitor, 
+																		const LES_FunctionParameterData* const functionParameterData) const
+{
+	const LES_DecodeLayout* const decodeLayout = LES_GetFunctionDecodeLayout(this);
+	if (decodeLayout)
 	{
-		pLogChannel->Print("Decode Function '%s' numParams:%d", functionName, numParameters);
+		return LES_Decode(decodeLayout, functionParameterData, visitor);
 	}
-	for (int i = 0; i < numParameters; i++)
+	/* Definitions which aren't registered don't have a cached layout */
+	LES_DecodeLayout* const tempDecodeLayout = LES_CreateDecodeLayout(this);
+	if (tempDecodeLayout == LES_NULL)
 	{
-		const LES_FunctionParameter* const functionParameterPtr = GetParameterByIndex(i);
-		const int nameID = functionParameterPtr->m_nameID;
-		const int typeID = functionParameterPtr->m_typeID;
-		returnCode = DecodeSingle(pLogChannel, functionParameterData, i, nameID, typeID, "", -1);
-		if (returnCode != LES_RETURN_OK)
-		{
-			return LES_RETURN_ERROR;
-		}
+		LES_WARNING("Decode nameID:%d failed to create the decode layout", GetNameID());
+		return LES_RETURN_ERROR;
 	}
+	const int returnCode = LES_Decode(tempDecodeLayout, functionParameterData, visitor);
+	LES_DestroyDecodeLayout(tempDecodeLayout);
 	return returnCode;
 }
 
@@ -494,12 +463,36 @@ void LES_FunctionInit()
 {
 	les_functionDefinitionArray = new const LES_FunctionDefinition*[1024];
 	les_numFunctionDefinitions = 0;
+	les_functionPlanArray = new LES_FunctionPlan*[1024];
+	memset(les_functionPlanArray, 0, sizeof(LES_FunctionPlan*)*1024);
+	les_functionDecodeLayoutArray = new LES_DecodeLayout*[1024];
+	memset(les_functionDecodeLayoutArray, 0, sizeof(LES_DecodeLayout*)*1024);
+	les_functionDefinitionIndex.Clear();
+	les_functionDefinitionIndex.Reserve(1024);
+	les_functionDefinitionGeneration++;
 }
 
 void LES_FunctionShutdown()
 {
+	for (int i = 0; i < les_numFunctionDefinitions; i++)
+	{
+		LES_DestroyFunctionPlan(les_functionPlanArray[i]);
+	}
+	delete[] les_functionPlanArray;
+	les_functionPlanArray = LES_NULL;
+	LES_FreeFuncDataPlans();
+	for (int i = 0; i < les_numFunctionDefinitions; i++)
+	{
+		LES_DestroyDecodeLayout(les_functionDecodeLayoutArray[i]);
+	}
+	delete[] les_functionDecodeLayoutArray;
+	les_functionDecodeLayoutArray = LES_NULL;
+	LES_FreeFuncDataDecodeLayouts();
+
 	les_numFunctionDefinitions = 0;
 	delete[] les_functionDefinitionArray;
+	les_functionDefinitionIndex.Free();
+	les_functionDefinitionGeneration++;
 }
 
 int LES_AddFunctionDefinition(const char* const name, const LES_FunctionDefinition* const pFunctionDefinition, 
@@ -520,17 +513,13 @@ int LES_AddFunctionDefinition(const char* const name, const LES_FunctionDefiniti
 		LES_FunctionDefinition* const pFunctionDefinition2 = (LES_FunctionDefinition* const)les_functionDefinitionArray[index];
 		pFunctionDefinition2->m_parameterDataSize = parameterDataSize;
 		les_numFunctionDefinitions++;
+		index += les_funcDataNumFunctionDefinitions;
+		les_functionDefinitionIndex.Add(LES_GenerateHashCaseSensitive(name), index);
+		les_functionDefinitionGeneration++;
 	}
 	else
 	{
-		int i = index;
-		if (les_pFuncData)
-		{
-			const LES_Hash nameHash = LES_GenerateHashCaseSensitive(name);
-			i = les_pFuncData->GetFunctionDefinitionIndex(nameHash);
-		}
-		const LES_FunctionDefinition* const pExistingFunction = les_pFuncData ? 
-																	les_pFuncData->GetFunctionDefinition(i) : LES_GetFunctionDefinitionForID(index);
+		const LES_FunctionDefinition* const pExistingFunction = LES_GetFunctionDefinitionForID(index);
 		if (pExistingFunction->GetNameID() != pFunctionDefinition->GetNameID())
 		{
 			LES_ERROR("AddFunctionDefinition '%s' nameID doesn't match Existing:%d New:%d", name, 
@@ -683,9 +672,41 @@ void LES_DebugOutputFunctionDefinition(LES_LoggerChannel* const pLogChannel,
 	}
 }
 
-void LES_Function_SetFuncDataPtr(const LES_FuncData* const pFuncData)
+void LES_Function_SetFuncDataPtr(const LES_FuncData* const pFuncData, const LES_HashTable* const pHashTable)
 {
+	LES_FreeFuncDataPlans();
+	LES_FreeFuncDataDecodeLayouts();
+
 	les_pFuncData = pFuncData;
 	les_funcDataNumFunctionDefinitions = les_pFuncData->GetNumFunctionDefinitions();
+	les_pFuncDataHashTable = pHashTable;
+	les_functionDefinitionGeneration++;
+	LES_FunctionFlushPlans();
+
+	/* The internal function definition IDs are after the func data */
+	les_functionDefinitionIndex.Clear();
+	if (pHashTable == LES_NULL)
+	{
+		les_functionDefinitionIndex.Reserve(les_funcDataNumFunctionDefinitions + les_numFunctionDefinitions);
+		for (int i = 0; i < les_funcDataNumFunctionDefinitions; i++)
+		{
+			const int nameID = pFuncData->GetFunctionDefinition(i)->GetNameID();
+			les_functionDefinitionIndex.Add(LES_GetStringEntryForID(nameID)->m_hash, i);
+		}
+	}
+	for (int i = 0; i < les_numFunctionDefinitions; i++)
+	{
+		const int nameID = les_functionDefinitionArray[i]->GetNameID();
+		les_functionDefinitionIndex.Add(LES_GetStringEntryForID(nameID)->m_hash, i + les_funcDataNumFunctionDefinitions);
+	}
+
+	/* Compile the serialisation plans for the definition file : types & structs are already set */
+	les_funcDataPlanArray = new LES_FunctionPlan*[les_funcDataNumFunctionDefinitions];
+	for (int i = 0; i < les_funcDataNumFunctionDefinitions; i++)
+	{
+		les_funcDataPlanArray[i] = LES_CreateFunctionPlan(LES_GetFunctionDefinitionForID(i));
+	}
+	les_funcDataDecodeLayoutArray = new LES_DecodeLayout*[les_funcDataNumFunctionDefinitions];
+	memset(les_funcDataDecodeLayoutArray, 0, sizeof(LES_DecodeLayout*)*les_funcDataNumFunctionDefinitions);
 }
 
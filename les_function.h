@@ -14,11 +14,15 @@
 struct LES_FunctionTempData;
 struct LES_FunctionParameter;
 class LES_FunctionParameterData;
+class LES_FunctionPlan;
+class LES_DecodeLayout;
+class LES_DecodeVisitor;
 
 class LES_FunctionDefinition
 {
 public:
 	int ComputeParameterDataSize(void) const;
+	int ComputeMinParameterDataSize(void) const;
 
 	const LES_FunctionParameter* GetParameter(const LES_Hash nameHash) const;
 	const LES_FunctionParameter* GetParameterByIndex(const int index) const;
@@ -30,6 +34,7 @@ public:
 	int GetParameterDataSize(void) const;
 
 	int Decode(LES_LoggerChannel* const pLogChannel, const LES_FunctionParameterData* const functionParameterData) const;
+	int Decode(LES_DecodeVisitor* const visitor, const LES_FunctionParameterData* const functionParameterData) const;
 
 	friend LES_FunctionDefinition* LES_CreateFunctionDefinition(const int nameID, const int returnTypeID, 
 																															const int numInputs, const int numOutputs);
@@ -53,7 +58,14 @@ private:
 };
 
 const LES_FunctionDefinition* LES_GetFunctionDefinition(const char* const name);
+const LES_FunctionDefinition* LES_GetFunctionDefinition(const char* const name, const LES_Hash nameHash);
 LES_FunctionParameterData* LES_GetFunctionParameterData(const int functionNameID);
+LES_FunctionParameterData* LES_GetFunctionParameterData(const LES_FunctionDefinition* const functionDefinitionPtr);
+void LES_AddRefFunctionParameterData(LES_FunctionParameterData* const parameterData);
+void LES_ReleaseFunctionParameterData(LES_FunctionParameterData* const parameterData);
+int LES_GetFunctionDefinitionGeneration(void);
+const LES_FunctionPlan* LES_GetFunctionPlan(const LES_FunctionDefinition* const functionDefinitionPtr);
+const LES_DecodeLayout* LES_GetFunctionDecodeLayout(const LES_FunctionDefinition* const functionDefinitionPtr);
 void LES_DebugOutputFunctionDefinitions(LES_LoggerChannel* const pLogChannel);
 
 #endif //#ifndef LES_FUNCTION_HH
@@ -0,0 +1,349 @@
+#ifndef LES_FUNCTION_CALL_HH
+#define LES_FUNCTION_CALL_HH
+
+#include "les_base.h"
+#include "les_logger.h"
+#include "les_hash.h"
+#include "les_function.h"
+#include "les_function_macros.h"
+#include "les_parameterstub.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Typed alternative to the LES_FUNCTION_* macros : LES_CALL(FUNC_NAME, RETURN_TYPE, args...)
+//
+// C++ argument types are mapped to LES type names by LES_TypeTraits at compile time
+// Arguments are inputs unless wrapped by LES_Out(), values passed by reference use LES_Ref()
+// e.g. LES_CALL(LES_Test_ReferenceOutputPODParam, void, LES_Out(LES_Ref(output_0)));
+//
+// Needs variadic templates & constexpr : not available when LES_COMPILETIME_HASH is 0
+//
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#if LES_COMPILETIME_HASH
+
+/* Hash of a decimal number appended to an existing hash e.g. the "3" in "char[3]" */
+constexpr LES_Hash LES_CompileTimeHashAppendNumber(const LES_Hash hash, const unsigned int number)
+{
+	return (number < 10) ? ((hash * 387U) + (LES_Hash)('0' + number)) :
+				 LES_CompileTimeHashAppendNumber(LES_CompileTimeHashAppendNumber(hash, number / 10), number % 10);
+}
+
+/*
+ * HASH : hash of the LES type name
+ * ROOT_DATA_SIZE : LES data size of the root POD type, 0 for structs (their layout comes from the definition)
+ * RootType : C++ type of the root type
+ * IS_POD : the type is a POD value, not a pointer, array or struct
+*/
+template <typename T> struct LES_TypeTraits;
+
+/* The data size is the C++ size : the first run of a call-site checks it against the definition e.g. long on 64-bit */
+#define LES_TYPE_TRAITS_POD(TYPE) \
+	template <> struct LES_TypeTraits<TYPE> \
+	{ \
+		static constexpr LES_Hash HASH = LES_CompileTimeHashCaseSensitive(#TYPE); \
+		static constexpr int ROOT_DATA_SIZE = sizeof(TYPE); \
+		static constexpr bool IS_POD = true; \
+		typedef TYPE RootType; \
+	}; \
+
+
+#define LES_TYPE_TRAITS_STRUCT(TYPE) \
+	template <> struct LES_TypeTraits<TYPE> \
+	{ \
+		static constexpr LES_Hash HASH = LES_CompileTimeHashCaseSensitive(#TYPE); \
+		static constexpr int ROOT_DATA_SIZE = 0; \
+		static constexpr bool IS_POD = false; \
+		typedef TYPE RootType; \
+	}; \
+
+
+/* The POD types of data/les_types_basic.xml */
+LES_TYPE_TRAITS_POD(unsigned char)
+LES_TYPE_TRAITS_POD(unsigned short)
+LES_TYPE_TRAITS_POD(unsigned int)
+LES_TYPE_TRAITS_POD(unsigned long)
+LES_TYPE_TRAITS_POD(char)
+LES_TYPE_TRAITS_POD(short)
+LES_TYPE_TRAITS_POD(int)
+LES_TYPE_TRAITS_POD(long)
+LES_TYPE_TRAITS_POD(long long int)
+LES_TYPE_TRAITS_POD(float)
+LES_TYPE_TRAITS_POD(double)
+
+template <typename T> struct LES_TypeTraits<const T> : public LES_TypeTraits<T>
+{
+};
+
+template <typename T> struct LES_TypeTraits<T*>
+{
+	static constexpr LES_Hash HASH = LES_CompileTimeHashCaseSensitive("*", LES_TypeTraits<T>::HASH);
+	static constexpr int ROOT_DATA_SIZE = LES_TypeTraits<T>::ROOT_DATA_SIZE;
+	static constexpr bool IS_POD = false;
+	typedef typename LES_TypeTraits<T>::RootType RootType;
+};
+
+template <typename T, unsigned int N> struct LES_TypeTraits<T[N]>
+{
+	static constexpr LES_Hash HASH = LES_CompileTimeHashCaseSensitive("]",
+																		LES_CompileTimeHashAppendNumber(
+																		LES_CompileTimeHashCaseSensitive("[", LES_TypeTraits<T>::HASH), N));
+	static constexpr int ROOT_DATA_SIZE = LES_TypeTraits<T>::ROOT_DATA_SIZE;
+	static constexpr bool IS_POD = false;
+	typedef typename LES_TypeTraits<T>::RootType RootType;
+};
+
+/* Argument wrappers : LES_Ref(value) passes "TYPE&", LES_Out(arg) makes arg an output parameter */
+template <typename T> struct LES_ReferenceArg
+{
+	T* m_address;
+};
+
+template <typename T> struct LES_OutputArg
+{
+	const T* m_arg;
+};
+
+template <typename T> inline LES_ReferenceArg<T> LES_Ref(T& value)
+{
+	const LES_ReferenceArg<T> arg = { &value };
+	return arg;
+}
+
+template <typename T> inline LES_OutputArg<T> LES_Out(const T& arg)
+{
+	const LES_OutputArg<T> outputArg = { &arg };
+	return outputArg;
+}
+
+/*
+ * Straight-line big endian fixed width store of a POD value : the same bytes as the parameter plan or a generated stub
+ * DEREFERENCE : the data is a pointer to the value
+*/
+template <int DATA_SIZE> struct LES_CallStoreBigEndian;
+
+template <> struct LES_CallStoreBigEndian<1>
+{
+	static void Store(char* const pBigData, const char* const pInData) { pBigData[0] = pInData[0]; }
+};
+
+template <> struct LES_CallStoreBigEndian<2>
+{
+	static void Store(char* const pBigData, const char* const pInData) { toBigEndian16(pBigData, pInData); }
+};
+
+template <> struct LES_CallStoreBigEndian<4>
+{
+	static void Store(char* const pBigData, const char* const pInData) { toBigEndian32(pBigData, pInData); }
+};
+
+template <> struct LES_CallStoreBigEndian<8>
+{
+	static void Store(char* const pBigData, const char* const pInData) { toBigEndian64(pBigData, pInData); }
+};
+
+template <typename T, bool DEREFERENCE> int LES_CallStorePOD(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const valuePtr = DEREFERENCE ? *(const char* const*)parameterDataPtr : (const char*)parameterDataPtr;
+	if (valuePtr == LES_NULL)
+	{
+		return -1;
+	}
+	LES_CallStoreBigEndian<sizeof(T)>::Store(writeBufferPtr, valuePtr);
+	return (int)sizeof(T);
+}
+
+/* LES_NULL for pointers, arrays & structs : they are written by the plan */
+template <typename T, bool DEREFERENCE, bool IS_POD = LES_TypeTraits<T>::IS_POD> struct LES_CallStore
+{
+	static constexpr LES_ParameterStubFunction* STORE = LES_NULL;
+};
+
+template <typename T, bool DEREFERENCE> struct LES_CallStore<T, DEREFERENCE, true>
+{
+	static constexpr LES_ParameterStubFunction* STORE = &LES_CallStorePOD<T, DEREFERENCE>;
+};
+
+/*
+ * Per argument : the LES type, the parameter mode and the address LES_FunctionParameterData::Write expects
+ * IS_INDIRECT : the argument refers to caller memory (pointer, reference or array) so it can be an output
+ * STORE : straight-line store of POD values, pointers to POD values and references to POD values
+*/
+template <typename T> struct LES_CallArgTraits
+{
+	typedef LES_TypeTraits<T> TypeTraits;
+	static constexpr LES_Hash TYPE_HASH = TypeTraits::HASH;
+	static constexpr bool IS_INPUT = true;
+	static constexpr bool IS_INDIRECT = false;
+	static constexpr LES_ParameterStubFunction* STORE = LES_CallStore<T, false>::STORE;
+	static const void* GetDataPtr(const T& arg, const void** const storage)
+	{
+		(void)storage;
+		return &arg;
+	}
+};
+
+template <typename T> struct LES_CallArgTraits<T*>
+{
+	typedef LES_TypeTraits<T*> TypeTraits;
+	static constexpr LES_Hash TYPE_HASH = TypeTraits::HASH;
+	static constexpr bool IS_INPUT = true;
+	static constexpr bool IS_INDIRECT = true;
+	static constexpr LES_ParameterStubFunction* STORE = LES_CallStore<T, true>::STORE;
+	static const void* GetDataPtr(T* const& arg, const void** const storage)
+	{
+		(void)storage;
+		return &arg;
+	}
+};
+
+/* Array parameters are written from a pointer to the first element */
+template <typename T, unsigned int N> struct LES_CallArgTraits<T[N]>
+{
+	typedef LES_TypeTraits<T[N]> TypeTraits;
+	static constexpr LES_Hash TYPE_HASH = TypeTraits::HASH;
+	static constexpr bool IS_INPUT = true;
+	static constexpr bool IS_INDIRECT = true;
+	static constexpr LES_ParameterStubFunction* STORE = LES_NULL;
+	static const void* GetDataPtr(const T (&arg)[N], const void** const storage)
+	{
+		*storage = arg;
+		return storage;
+	}
+};
+
+template <typename T> struct LES_CallArgTraits< LES_ReferenceArg<T> >
+{
+	typedef LES_TypeTraits<T> TypeTraits;
+	static constexpr LES_Hash TYPE_HASH = LES_CompileTimeHashCaseSensitive("&", TypeTraits::HASH);
+	static constexpr bool IS_INPUT = true;
+	static constexpr bool IS_INDIRECT = true;
+	static constexpr LES_ParameterStubFunction* STORE = LES_CallStore<T, false>::STORE;
+	static const void* GetDataPtr(const LES_ReferenceArg<T>& arg, const void** const storage)
+	{
+		(void)storage;
+		return arg.m_address;
+	}
+};
+
+/* References to arrays are named "TYPE&[N]" */
+template <typename T, unsigned int N> struct LES_CallArgTraits< LES_ReferenceArg<T[N]> >
+{
+	typedef LES_TypeTraits<T[N]> TypeTraits;
+	static constexpr LES_Hash TYPE_HASH = LES_CompileTimeHashCaseSensitive("]",
+																				LES_CompileTimeHashAppendNumber(
+																				LES_CompileTimeHashCaseSensitive("&[", LES_TypeTraits<T>::HASH), N));
+	static constexpr bool IS_INPUT = true;
+	static constexpr bool IS_INDIRECT = true;
+	static constexpr LES_ParameterStubFunction* STORE = LES_NULL;
+	static const void* GetDataPtr(const LES_ReferenceArg<T[N]>& arg, const void** const storage)
+	{
+		(void)storage;
+		return arg.m_address;
+	}
+};
+
+template <typename T> struct LES_CallArgTraits< LES_OutputArg<T> >
+{
+	static_assert(LES_CallArgTraits<T>::IS_INDIRECT, "LES_Out() argument must be a pointer, a reference or an array");
+	typedef typename LES_CallArgTraits<T>::TypeTraits TypeTraits;
+	static constexpr LES_Hash TYPE_HASH = LES_CallArgTraits<T>::TYPE_HASH;
+	static constexpr bool IS_INPUT = false;
+	static constexpr bool IS_INDIRECT = true;
+	static constexpr LES_ParameterStubFunction* STORE = LES_CallArgTraits<T>::STORE;
+	static const void* GetDataPtr(const LES_OutputArg<T>& arg, const void** const storage)
+	{
+		return LES_CallArgTraits<T>::GetDataPtr(*arg.m_arg, storage);
+	}
+};
+
+template <typename... ARGS> struct LES_CallNumInputs;
+
+template <> struct LES_CallNumInputs<>
+{
+	static constexpr int value = 0;
+};
+
+template <typename ARG, typename... ARGS> struct LES_CallNumInputs<ARG, ARGS...>
+{
+	static constexpr int value = (LES_CallArgTraits<ARG>::IS_INPUT ? 1 : 0) + LES_CallNumInputs<ARGS...>::value;
+};
+
+struct LES_CallParam
+{
+	LES_Hash m_typeHash;
+	int m_rootDataSize;
+	bool m_isInput;
+	const void* m_data;
+	LES_ParameterStubFunction* m_store;		// LES_NULL if the parameter is written by the plan
+};
+
+extern int LES_FunctionCall(const char* const name, const LES_Hash nameHash,
+														const char* const returnType, const LES_Hash returnTypeHash,
+														const LES_CallParam* const params, const int numParams, const int numInputs,
+														LES_FunctionCallSiteCache* const callSiteCache, LES_FunctionRPCHandle* const rpcHandle);
+
+inline void LES_CallMakeParams(LES_CallParam* const params, const void** const storage)
+{
+	(void)params;
+	(void)storage;
+}
+
+template <typename ARG, typename... ARGS> inline void LES_CallMakeParams(LES_CallParam* const params, const void** const storage, 
+																																					 const ARG& arg, const ARGS&... args)
+{
+	typedef LES_CallArgTraits<ARG> ArgTraits;
+	typedef typename ArgTraits::TypeTraits TypeTraits;
+
+	params->m_typeHash = ArgTraits::TYPE_HASH;
+	params->m_rootDataSize = TypeTraits::ROOT_DATA_SIZE;
+	params->m_isInput = ArgTraits::IS_INPUT;
+	params->m_data = ArgTraits::GetDataPtr(arg, storage);
+	params->m_store = ArgTraits::STORE;
+	LES_CallMakeParams(params + 1, storage + 1, args...);
+}
+
+template <typename... ARGS> int LES_Call(const char* const name, const LES_Hash nameHash,
+																				 const char* const returnType, const LES_Hash returnTypeHash,
+																				 LES_FunctionCallSiteCache* const callSiteCache, LES_FunctionRPCHandle* const rpcHandle,
+																									 const ARGS&... args)
+{
+	static constexpr int NUM_PARAMS = sizeof...(ARGS);
+	static_assert(NUM_PARAMS <= LES_MAX_NUM_FUNCTION_PARAMS, "LES_Call too many parameters : LES_MAX_NUM_FUNCTION_PARAMS");
+	static constexpr int NUM_INPUTS = LES_CallNumInputs<ARGS...>::value;
+
+	/* +1 : zero length arrays aren't allowed */
+	LES_CallParam params[NUM_PARAMS + 1];
+	const void* storage[NUM_PARAMS + 1];
+	LES_CallMakeParams(params, storage, args...);
+
+	return LES_FunctionCall(name, nameHash, returnType, returnTypeHash, (NUM_PARAMS > 0) ? params : LES_NULL, NUM_PARAMS, NUM_INPUTS, 
+													callSiteCache, rpcHandle);
+}
+
+#define LES_CALL(FUNC_NAME, RETURN_TYPE, ...) \
+	{ \
+		static LES_FunctionCallSiteCache __LESfunctionCallSiteCache = { LES_NULL, LES_NULL, -1, LES_NULL, -1, -1 }; \
+		if (LES_Call(#FUNC_NAME, LES_HASH_LITERAL(#FUNC_NAME), #RETURN_TYPE, LES_HASH_LITERAL(#RETURN_TYPE), \
+								 &__LESfunctionCallSiteCache, LES_NULL, ##__VA_ARGS__) != LES_RETURN_OK) \
+		{ \
+			LES_FATAL_ERROR("'%s' : Error during LES_Call", #FUNC_NAME); \
+		} \
+	} \
+
+
+/* As LES_CALL() : RPC_HANDLE is set to the handle to poll for the result of the call */
+#define LES_CALL_ASYNC(RPC_HANDLE, FUNC_NAME, RETURN_TYPE, ...) \
+	{ \
+		static LES_FunctionCallSiteCache __LESfunctionCallSiteCache = { LES_NULL, LES_NULL, -1, LES_NULL, -1, -1 }; \
+		if (LES_Call(#FUNC_NAME, LES_HASH_LITERAL(#FUNC_NAME), #RETURN_TYPE, LES_HASH_LITERAL(#RETURN_TYPE), \
+								 &__LESfunctionCallSiteCache, &(RPC_HANDLE), ##__VA_ARGS__) != LES_RETURN_OK) \
+		{ \
+			LES_FATAL_ERROR("'%s' : Error during LES_Call", #FUNC_NAME); \
+		} \
+	} \
+
+
+#endif // #if LES_COMPILETIME_HASH
+
+#endif // #ifndef LES_FUNCTION_CALL_HH
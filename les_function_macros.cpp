@@ -1,15 +1,188 @@
 #include <string.h>
 
 #include "les_function_macros.h"
+#include "les_function_call.h"
 #include "les_core.h"
 #include "les_logger.h"
 #include "les_parameter.h"
 #include "les_stringentry.h"
 #include "les_coreengine.h"
+#include "les_parameterplan.h"
+#include "les_parameterpool.h"
+#include "les_type.h"
 
-int LES_FunctionStart(const char* const name, const char* const returnType, 
+extern bool LES_CoreEngineInTick(void);
+
+/* Set to 1 to validate every parameter of every call instead of trusting call-sites after their first run */
+#ifndef LES_FUNCTION_VALIDATE_ALWAYS
+#define LES_FUNCTION_VALIDATE_ALWAYS 0
+#endif // #ifndef LES_FUNCTION_VALIDATE_ALWAYS
+
+static int LES_FunctionStartParameterData(const char* const name, const LES_FunctionDefinition* const functionDefinition,
+																					LES_FunctionTempData* const functionTempData,
+																					LES_FunctionCallSiteCache* const callSiteCache)
+{
+	LES_FunctionParameterData* const functionParameterData = LES_GetFunctionParameterData(functionDefinition);
+	if (callSiteCache)
+	{
+		callSiteCache->parameterData = functionParameterData;
+		callSiteCache->parameterDataPoolEpoch = LES_ParameterPoolGetEpoch();
+	}
+	if (functionParameterData == LES_NULL)
+	{
+		/* ERROR: functionParameterData should only be LES_NULL if no inputs or outputs */
+		if (functionDefinition->GetNumParameters() > 0)
+		{
+			LES_WARNING("'%s' : functionParameterData is NULL numInputs:%d numOutputs:%d nameID:%d",
+									name, functionDefinition->GetNumInputs(), functionDefinition->GetNumOutputs(), functionDefinition->GetNameID());
+			return LES_RETURN_ERROR;
+		}
+	}
+	functionTempData->functionParameterData = functionParameterData;
+
+	/* Initialise parameter indexes */
+	functionTempData->functionCurrentParamIndex = 0;
+	functionTempData->functionCurrentInputIndex = 0;
+	functionTempData->functionCurrentOutputIndex = 0;
+
+	return LES_RETURN_OK;
+}
+
+static int LES_FunctionAddParamWrite(const char* const type, const char* const name, const bool isInput, void* const data,
+																		 const LES_FunctionParameter* const functionParameterPtr,
+																		 LES_FunctionTempData* const functionTempData, 
+																		 LES_ParameterStubFunction* const callStore)
+{
+	/* Store the parameter value */
+	LES_FunctionParameterData* const functionParameterData = functionTempData->functionParameterData;
+	if (functionParameterData == LES_NULL)
+	{
+		/* ERROR: functionParameterData is NULL */
+		LES_WARNING("'%s' : functionParameterData is NULL", functionTempData->functionName);
+		return LES_RETURN_ERROR;
+	}
+	/* Use the LES_Call store, the generated stub or the compiled plan if there is one : the non-plan path reports any errors */
+	/* The stores & generated stubs always write big endian fixed width : native endian or varint parameter data uses the plan */
+	const int functionParameterIndex = functionParameterPtr->m_index;
+	const LES_FunctionPlan* const functionPlan = functionTempData->functionPlan;
+	const LES_ParameterPlanEntry* const parameterPlan = functionPlan ? functionPlan->GetParameterPlan(functionParameterIndex) : LES_NULL;
+	const bool bigEndianFixedWidth = (LES_IsParameterDataNativeEndian() == false) && (LES_IsParameterDataVarint() == false);
+	LES_ParameterStubFunction* const stub = callStore ? callStore : (parameterPlan ? parameterPlan->m_stub : LES_NULL);
+	if (parameterPlan && stub && (parameterPlan->m_typeFlags & functionParameterPtr->m_mode) && bigEndianFixedWidth)
+	{
+		if (functionParameterData->WriteStub(stub, data) != LES_RETURN_OK)
+		{
+			/* ERROR: during AddParam */
+			LES_WARNING("'%s' : WriteStub parameter:'%s' type:'%s' failed", functionTempData->functionName, name, type);
+			return LES_RETURN_ERROR;
+		}
+	}
+	else if (parameterPlan && (parameterPlan->m_typeFlags & functionParameterPtr->m_mode))
+	{
+		if (functionParameterData->WritePlan(functionPlan->GetOps(parameterPlan), parameterPlan->m_numOps, data) != LES_RETURN_OK)
+		{
+			/* ERROR: during AddParam */
+			LES_WARNING("'%s' : WritePlan parameter:'%s' type:'%s' failed", functionTempData->functionName, name, type);
+			return LES_RETURN_ERROR;
+		}
+	}
+	else
+	{
+		const LES_StringEntry* const parameterTypeStringEntry = LES_GetStringEntryForID(functionParameterPtr->m_typeID);
+		if (parameterTypeStringEntry == LES_NULL)
+		{
+			/* ERROR: can't find the parameter type */
+			LES_WARNING("'%s' : Can't find parameter type for ID:%d parameter:'%s' type:'%s'", 
+									functionTempData->functionName, functionParameterPtr->m_typeID, name, type);
+			return LES_RETURN_ERROR;
+		}
+		if (functionParameterData->Write(parameterTypeStringEntry, data, functionParameterPtr->m_mode) != LES_RETURN_OK)
+		{
+			/* ERROR: during AddParam */
+			LES_WARNING("'%s' : Write parameter:'%s' type:'%s' failed", functionTempData->functionName, name, type);
+			return LES_RETURN_ERROR;
+		}
+	}
+
+	/* Update parameter indexes */
+	functionTempData->functionCurrentParamIndex++;
+	if (isInput)
+	{
+		functionTempData->functionCurrentInputIndex++;
+	}
+	else
+	{
+		functionTempData->functionCurrentOutputIndex++;
+	}
+	functionTempData->paramUsed[functionParameterIndex] = 1;
+	functionTempData->functionParamData[functionParameterIndex] = data;
+
+	return LES_RETURN_OK;
+}
+
+/* Register where the output parameters are written back to when the result of the call arrives */
+static int LES_FunctionSetRPCOutputs(const LES_FunctionDefinition* const functionDefinitionPtr,
+																		 const LES_FunctionTempData* const functionTempData,
+																		 const LES_FunctionRPCHandle rpcHandle)
+{
+	const int numOutputs = functionDefinitionPtr->GetNumOutputs();
+	if (numOutputs == 0)
+	{
+		return LES_RETURN_OK;
+	}
+	const LES_FunctionPlan* const functionPlan = functionTempData->functionPlan;
+	if (functionPlan == LES_NULL)
+	{
+		LES_WARNING("'%s' : no function plan : output parameters won't be written back", functionTempData->functionName);
+		return LES_RETURN_ERROR;
+	}
+	LES_FunctionRPCOutput outputs[LES_MAX_NUM_FUNCTION_PARAMS];
+	int outputIndex = 0;
+	const int numParameters = functionDefinitionPtr->GetNumParameters();
+	for (int i = 0; i < numParameters; i++)
+	{
+		const LES_FunctionParameter* const functionParameterPtr = functionDefinitionPtr->GetParameterByIndex(i);
+		if (functionParameterPtr->m_mode != LES_PARAM_MODE_OUTPUT)
+		{
+			continue;
+		}
+		const LES_ParameterPlanEntry* const parameterPlan = functionPlan->GetParameterPlan(i);
+		if (parameterPlan == LES_NULL)
+		{
+			LES_WARNING("'%s' : parameter index:%d no plan : output parameters won't be written back", 
+									functionTempData->functionName, i);
+			return LES_RETURN_ERROR;
+		}
+		const LES_ParameterPlanOp* ops = functionPlan->GetOps(parameterPlan);
+		int numOps = parameterPlan->m_numOps;
+		void* destination = functionTempData->functionParamData[i];
+		/* Follow a pointer parameter now : the pointer variable itself may not live until the result arrives */
+		if ((numOps > 0) && (ops[0].m_opcode == LES_PLAN_OP_DEREF) && (ops[0].m_offset == 0))
+		{
+			destination = *(void**)destination;
+			ops++;
+			numOps--;
+		}
+		if (destination == LES_NULL)
+		{
+			LES_WARNING("'%s' : parameter index:%d is NULL : output parameters won't be written back", 
+									functionTempData->functionName, i);
+			return LES_RETURN_ERROR;
+		}
+		LES_FunctionRPCOutput* const pOutput = &outputs[outputIndex];
+		pOutput->m_ops = ops;
+		pOutput->m_numOps = numOps;
+		pOutput->m_destination = destination;
+		outputIndex++;
+	}
+	return LES_CoreEngineSetFunctionRPCOutputs(rpcHandle, outputs, outputIndex);
+}
+
+int LES_FunctionStart(const char* const name, const LES_Hash nameHash, 
+											const char* const returnType, const LES_Hash returnTypeHash,
 											const LES_FunctionDefinition** functionDefinitionPtr,
-											LES_FunctionTempData* const functionTempData)
+											LES_FunctionTempData* const functionTempData,
+											LES_FunctionCallSiteCache* const callSiteCache)
 {
 	functionTempData->functionName = name;
 	functionTempData->functionCurrentParamIndex = 0;
@@ -18,10 +191,37 @@ int LES_FunctionStart(const char* const name, const char* const returnType,
 	functionTempData->functionInputMacroParamIndex = 0;
 	functionTempData->functionOutputMacroParamIndex = 0;
 	functionTempData->functionParameterData = LES_NULL;
+	functionTempData->functionPlan = LES_NULL;
+	functionTempData->functionCallSiteCache = callSiteCache;
+	functionTempData->functionTrusted = false;
+	functionTempData->functionRPCHandle = LES_NULL;
+	functionTempData->functionNoCopy = false;
 	memset(functionTempData->paramUsed, 0, sizeof(char)*LES_MAX_NUM_FUNCTION_PARAMS);
 
-	const LES_Hash functionReturnTypeTypeHash = LES_GenerateHashCaseSensitive(returnType);
-	const LES_FunctionDefinition* const functionDefinition = LES_GetFunctionDefinition(name);
+	/* Recycle the parameter block from the last time this call-site ran */
+	if (callSiteCache && callSiteCache->parameterData)
+	{
+		if (callSiteCache->parameterDataPoolEpoch == LES_ParameterPoolGetEpoch())
+		{
+			LES_ReleaseFunctionParameterData(callSiteCache->parameterData);
+		}
+		callSiteCache->parameterData = LES_NULL;
+	}
+
+	/* Call-site cache : definition already found & validated for the current definitions */
+	const int definitionGeneration = LES_GetFunctionDefinitionGeneration();
+	if (callSiteCache && (callSiteCache->definitionGeneration == definitionGeneration))
+	{
+		const LES_FunctionDefinition* const functionDefinition = callSiteCache->functionDefinition;
+		*functionDefinitionPtr = functionDefinition;
+		functionTempData->functionPlan = callSiteCache->functionPlan;
+		functionTempData->functionTrusted = (LES_FUNCTION_VALIDATE_ALWAYS == 0) && 
+																				(callSiteCache->trustedGeneration == definitionGeneration);
+		return LES_FunctionStartParameterData(name, functionDefinition, functionTempData, callSiteCache);
+	}
+
+	const LES_Hash functionReturnTypeTypeHash = returnTypeHash;
+	const LES_FunctionDefinition* const functionDefinition = LES_GetFunctionDefinition(name, nameHash);
 	if (functionDefinition == LES_NULL)
 	{
 		/* ERROR: function not found */
@@ -56,28 +256,26 @@ int LES_FunctionStart(const char* const name, const char* const returnType,
 							  name, returnType, functionReturnTypeStringEntry->m_str);
 		return LES_RETURN_ERROR;
 	}
-	LES_FunctionParameterData* const functionParameterData = LES_GetFunctionParameterData(functionDefinition->GetNameID());
-	if (functionParameterData == LES_NULL)
+	if (LES_FunctionStartParameterData(name, functionDefinition, functionTempData, callSiteCache) != LES_RETURN_OK)
 	{
-		/* ERROR: functionParameterData should only be LES_NULL if no inputs or outputs */
-		if (functionDefinition->GetNumParameters() > 0)
-		{
-			LES_WARNING("'%s' : functionParameterData is NULL numInputs:%d numOutputs:%d nameID:%d",
-									name, functionDefinition->GetNumInputs(), functionDefinition->GetNumOutputs(), functionDefinition->GetNameID());
-			return LES_RETURN_ERROR;
-		}
+		return LES_RETURN_ERROR;
 	}
-	functionTempData->functionParameterData = functionParameterData;
+	functionTempData->functionPlan = LES_GetFunctionPlan(functionDefinition);
 
-	/* Initialise parameter indexes */
-	functionTempData->functionCurrentParamIndex = 0;
-	functionTempData->functionCurrentInputIndex = 0;
-	functionTempData->functionCurrentOutputIndex = 0;
+	/* Only cache the definition once it has been validated */
+	if (callSiteCache)
+	{
+		callSiteCache->functionDefinition = functionDefinition;
+		callSiteCache->functionPlan = functionTempData->functionPlan;
+		callSiteCache->definitionGeneration = definitionGeneration;
+		callSiteCache->trustedGeneration = -1;
+	}
 
 	return LES_RETURN_OK;
 }
 
-int LES_FunctionAddParam(const char* const type, const char* const name, const int index, 
+int LES_FunctionAddParam(const char* const type, const LES_Hash typeHash, 
+												 const char* const name, const LES_Hash nameHash, const int index, 
 												 const char* const mode, const bool isInput, void* const data,
 												 const LES_FunctionDefinition* const functionDefinition,
 												 LES_FunctionTempData* const functionTempData)
@@ -88,8 +286,21 @@ int LES_FunctionAddParam(const char* const type, const char* const name, const i
 		return LES_RETURN_ERROR;
 	}
 
-	const LES_Hash typeHash = LES_GenerateHashCaseSensitive(type);
-	const LES_Hash nameHash = LES_GenerateHashCaseSensitive(name);
+	/* Trusted call-site : the same parameters in the same order were validated on its first run */
+	if (functionTempData->functionTrusted)
+	{
+		const LES_FunctionParameter* const functionParameterPtr = 
+				functionDefinition->GetParameterByIndex(functionTempData->functionCurrentParamIndex);
+		if (functionParameterPtr == LES_NULL)
+		{
+			/* ERROR: more parameters than the validated call-site */
+			LES_WARNING("'%s' : trusted %s parameter index:%d parameter:'%s' type:'%s' not found",
+									functionTempData->functionName, mode, functionTempData->functionCurrentParamIndex, name, type);
+			return LES_RETURN_ERROR;
+		}
+		return LES_FunctionAddParamWrite(type, name, isInput, data, functionParameterPtr, functionTempData, LES_NULL);
+	}
+
 	/* Check the parameter index to see if it exceeds the number of declared parameters */
 	const int functionMaxParamTypeIndex = (isInput ? functionDefinition->GetNumInputs() : functionDefinition->GetNumOutputs());
 	if (index >= functionMaxParamTypeIndex)
@@ -213,40 +424,14 @@ int LES_FunctionAddParam(const char* const type, const char* const name, const i
 						nameHash, parameterNameStringEntry->m_hash);
 		return LES_RETURN_ERROR;
 	}
-	/* Store the parameter value */
-	LES_FunctionParameterData* const functionParameterData = functionTempData->functionParameterData;
-	if (functionParameterData == LES_NULL)
-	{
-		/* ERROR: functionParameterData is NULL */
-		LES_WARNING("'%s' : functionParameterData is NULL", functionTempData->functionName);
-		return LES_RETURN_ERROR;
-	}
-	if (functionParameterData->Write(parameterTypeStringEntry, data, functionParameterPtr->m_mode) != LES_RETURN_OK)
-	{
-		/* ERROR: during AddParam */
-		LES_WARNING("'%s' : Write parameter:'%s' type:'%s' failed", functionTempData->functionName, name, type);
-		return LES_RETURN_ERROR;
-	}
-
-	/* Update parameter indexes */
-	functionTempData->functionCurrentParamIndex++;
-	if (isInput)
-	{
-		functionTempData->functionCurrentInputIndex++;
-	}
-	else
-	{
-		functionTempData->functionCurrentOutputIndex++;
-	}
-	functionTempData->paramUsed[functionParameterIndex] = 1;
-
-	return LES_RETURN_OK;
+	return LES_FunctionAddParamWrite(type, name, isInput, data, functionParameterPtr, functionTempData, LES_NULL);
 }
 
 int LES_FunctionEnd(const LES_FunctionDefinition* const functionDefinitionPtr, 
 										const LES_FunctionTempData* const functionTempData)
 {
-	const int numParams = functionDefinitionPtr->GetNumParameters();
+	/* A trusted call-site always sets every parameter */
+	const int numParams = functionTempData->functionTrusted ? 0 : functionDefinitionPtr->GetNumParameters();
 
 	int numMissing = 0;
 	for (int i = 0; i < numParams; i++)
@@ -285,13 +470,44 @@ int LES_FunctionEnd(const LES_FunctionDefinition* const functionDefinitionPtr,
 	LES_FunctionParameterData* const functionParameterData = functionTempData->functionParameterData;
 	const int parameterDataSize = functionDefinitionPtr->GetParameterDataSize();
 	const int numBytesWritten = functionParameterData->GetNumBytesWritten();
-	if (parameterDataSize != numBytesWritten)
+	if (LES_IsParameterDataVarint())
 	{
-		LES_WARNING("'%s' : wrong number of bytes written NumBytesWritten:%d ParameterDataSize:%d", 
-								functionTempData->functionName, numBytesWritten, parameterDataSize);
-		return LES_RETURN_ERROR;
+		/* Varints can be smaller or bigger than the integers : only the buffer size limits the parameter data */
+		if (numBytesWritten > LES_GetMaxParameterDataSize(parameterDataSize))
+		{
+			LES_WARNING("'%s' : too many bytes written NumBytesWritten:%d MaxParameterDataSize:%d", 
+									functionTempData->functionName, numBytesWritten, LES_GetMaxParameterDataSize(parameterDataSize));
+			return LES_RETURN_ERROR;
+		}
+	}
+	else if (parameterDataSize != numBytesWritten)
+	{
+		/* ParameterDataSize is the maximum : variable sized parameters write less than it */
+		const int minParameterDataSize = functionDefinitionPtr->ComputeMinParameterDataSize();
+		if ((numBytesWritten < minParameterDataSize) || (numBytesWritten > parameterDataSize))
+		{
+			LES_WARNING("'%s' : wrong number of bytes written NumBytesWritten:%d ParameterDataSize:%d", 
+									functionTempData->functionName, numBytesWritten, parameterDataSize);
+			return LES_RETURN_ERROR;
+		}
+	}
+	/* The call-site has been fully validated : trust it until the definitions change */
+	LES_FunctionCallSiteCache* const callSiteCache = functionTempData->functionCallSiteCache;
+	if (callSiteCache && (callSiteCache->definitionGeneration == LES_GetFunctionDefinitionGeneration()))
+	{
+		callSiteCache->trustedGeneration = callSiteCache->definitionGeneration;
+	}
+	/* LES_FUNCTION_END_NOCOPY keeps the input memory valid by waiting for the call : it needs a handle to wait on */
+	LES_FunctionRPCHandle noCopyRPCHandle = LES_FUNCTIONRPC_INVALID_HANDLE;
+	const bool noCopyWait = functionTempData->functionNoCopy && (functionTempData->functionRPCHandle == LES_NULL) &&
+													(LES_CoreEngineInTick() == false);
+	LES_FunctionRPCHandle* const rpcHandle = noCopyWait ? &noCopyRPCHandle : functionTempData->functionRPCHandle;
+	/* Only LES_FUNCTION_END_ASYNC_NOCOPY & LES_FUNCTION_END_NOCOPY callers keep the input memory valid until it has been sent */
+	if ((functionTempData->functionNoCopy == false) || (rpcHandle == LES_NULL))
+	{
+		functionParameterData->ResolveReferences();
 	}
-	const int sendReturn = LES_CoreEngineSendFunctionRPC(functionDefinitionPtr, functionParameterData);
+	const int sendReturn = LES_CoreEngineSendFunctionRPC(functionDefinitionPtr, functionParameterData, rpcHandle);
 	if (sendReturn == LES_COREENGINE_SEND_ERROR)
 	{
 		LES_ERROR("Function RPC: '%s' : send error", functionTempData->functionName);
@@ -302,6 +518,19 @@ int LES_FunctionEnd(const LES_FunctionDefinition* const functionDefinitionPtr,
 		LES_ERROR("Function RPC: '%s' : not ready to send data", functionTempData->functionName);
 		return LES_RETURN_OK;
 	}
+	if (rpcHandle && (*rpcHandle != LES_FUNCTIONRPC_INVALID_HANDLE))
+	{
+		/* Not an error : the result of the call is still returned */
+		LES_FunctionSetRPCOutputs(functionDefinitionPtr, functionTempData, *rpcHandle);
+	}
+	if (noCopyRPCHandle != LES_FUNCTIONRPC_INVALID_HANDLE)
+	{
+		if (LES_CoreEngineWaitFunctionRPC(noCopyRPCHandle, LES_FUNCTION_NOCOPY_WAIT_TIME, LES_NULL) != LES_FUNCTIONRPC_COMPLETE)
+		{
+			LES_ERROR("Function RPC: '%s' : didn't complete in %f seconds", functionTempData->functionName, LES_FUNCTION_NOCOPY_WAIT_TIME);
+			return LES_RETURN_ERROR;
+		}
+	}
 
 	return LES_RETURN_OK;
 }
@@ -316,6 +545,127 @@ int LES_FunctionGetParameterData(const LES_FunctionTempData* const functionTempD
 		LES_WARNING("'%s' : functionParameterData is NULL", functionTempData->functionName);
 		return LES_RETURN_ERROR;
 	}
+	/* The parameter data is read back from the buffer */
+	functionParameterData->ResolveReferences();
 	*functionParameterDataPtr = functionParameterData;
 	return LES_RETURN_OK;
 }
+
+#if LES_COMPILETIME_HASH
+
+static int LES_FunctionAddCallParam(const LES_CallParam* const callParam, 
+																		const LES_FunctionDefinition* const functionDefinition,
+																		LES_FunctionTempData* const functionTempData)
+{
+	/* Parameters are added in declaration order : the definition parameter comes from the current index */
+	const int functionCurrentParamIndex = functionTempData->functionCurrentParamIndex;
+	const LES_FunctionParameter* const functionParameterPtr = functionDefinition->GetParameterByIndex(functionCurrentParamIndex);
+	if (functionParameterPtr == LES_NULL)
+	{
+		/* ERROR: more parameters than the definition */
+		LES_WARNING("'%s' : Too many parameters index:%d max:%d", 
+								functionTempData->functionName, functionCurrentParamIndex, functionDefinition->GetNumParameters());
+		return LES_RETURN_ERROR;
+	}
+	const LES_StringEntry* const parameterTypeStringEntry = LES_GetStringEntryForID(functionParameterPtr->m_typeID);
+	const LES_StringEntry* const parameterNameStringEntry = LES_GetStringEntryForID(functionParameterPtr->m_nameID);
+	if ((parameterTypeStringEntry == LES_NULL) || (parameterNameStringEntry == LES_NULL))
+	{
+		/* ERROR: can't find the parameter type or name */
+		LES_WARNING("'%s' : Can't find parameter index:%d typeID:%d nameID:%d", 
+								functionTempData->functionName, functionCurrentParamIndex, 
+								functionParameterPtr->m_typeID, functionParameterPtr->m_nameID);
+		return LES_RETURN_ERROR;
+	}
+	const char* const name = parameterNameStringEntry->m_str;
+	const char* const type = parameterTypeStringEntry->m_str;
+	if (functionTempData->functionTrusted == false)
+	{
+		/* Check the parameter mode: input or output */
+		const LES_uint32 currentMode = (callParam->m_isInput ? LES_PARAM_MODE_INPUT : LES_PARAM_MODE_OUTPUT);
+		if (functionParameterPtr->m_mode != currentMode)
+		{
+			/* ERROR: parameter mode doesn't match the definition */
+			LES_WARNING("'%s' : parameter:%d '%s' wrong mode Code:'%s' Definition:'%s'",
+									functionTempData->functionName, functionCurrentParamIndex, name, 
+									(callParam->m_isInput ? "Input" : "Output"),
+									((functionParameterPtr->m_mode == LES_PARAM_MODE_INPUT) ? "Input" : "Output"));
+			return LES_RETURN_ERROR;
+		}
+		/* Check the parameter type : hash */
+		if (callParam->m_typeHash != parameterTypeStringEntry->m_hash)
+		{
+			/* ERROR: parameter type hash doesn't match */
+			LES_WARNING("'%s' : parameter:%d '%s' type hash doesn't match 0x%X != 0x%X Definition:'%s'",
+									functionTempData->functionName, functionCurrentParamIndex, name,
+									callParam->m_typeHash, parameterTypeStringEntry->m_hash, type);
+			return LES_RETURN_ERROR;
+		}
+		/* Check the parameter type : data size of POD types */
+		if (callParam->m_rootDataSize > 0)
+		{
+			const LES_TypeEntry* const typeEntryPtr = LES_GetTypeEntryForStringID(functionParameterPtr->m_typeID);
+			const LES_TypeEntry* const rootTypeEntryPtr = typeEntryPtr ? typeEntryPtr->GetRootType() : LES_NULL;
+			if ((rootTypeEntryPtr == LES_NULL) || (rootTypeEntryPtr->m_dataSize != (LES_uint32)callParam->m_rootDataSize))
+			{
+				/* ERROR: parameter type data size doesn't match */
+				LES_WARNING("'%s' : parameter:%d '%s' type:'%s' data size doesn't match Code:%d Definition:%d",
+										functionTempData->functionName, functionCurrentParamIndex, name, type,
+										callParam->m_rootDataSize, (rootTypeEntryPtr ? (int)rootTypeEntryPtr->m_dataSize : -1));
+				return LES_RETURN_ERROR;
+			}
+			/* The straight-line stores always swap values bigger than a byte */
+			if (callParam->m_store && (callParam->m_rootDataSize > 1) && ((rootTypeEntryPtr->m_flags & LES_TYPE_ENDIANSWAP) == 0))
+			{
+				/* ERROR: parameter type isn't endian swapped */
+				LES_WARNING("'%s' : parameter:%d '%s' type:'%s' isn't endian swapped", 
+										functionTempData->functionName, functionCurrentParamIndex, name, type);
+				return LES_RETURN_ERROR;
+			}
+		}
+	}
+	return LES_FunctionAddParamWrite(type, name, callParam->m_isInput, (void*)callParam->m_data, 
+																	 functionParameterPtr, functionTempData, callParam->m_store);
+}
+
+int LES_FunctionCall(const char* const name, const LES_Hash nameHash,
+										 const char* const returnType, const LES_Hash returnTypeHash,
+										 const LES_CallParam* const params, const int numParams, const int numInputs,
+										 LES_FunctionCallSiteCache* const callSiteCache, LES_FunctionRPCHandle* const rpcHandle)
+{
+	if (rpcHandle)
+	{
+		*rpcHandle = LES_FUNCTIONRPC_INVALID_HANDLE;
+	}
+	const LES_FunctionDefinition* functionDefinition = LES_NULL;
+	LES_FunctionTempData functionTempData;
+	if (LES_FunctionStart(name, nameHash, returnType, returnTypeHash, &functionDefinition, &functionTempData, 
+												callSiteCache) != LES_RETURN_OK)
+	{
+		return LES_RETURN_ERROR;
+	}
+	functionTempData.functionRPCHandle = rpcHandle;
+	if (functionTempData.functionTrusted == false)
+	{
+		/* Check the number of inputs & outputs */
+		const int numOutputs = numParams - numInputs;
+		if ((numInputs != functionDefinition->GetNumInputs()) || (numOutputs != functionDefinition->GetNumOutputs()))
+		{
+			/* ERROR: number of inputs or outputs doesn't match the definition */
+			LES_WARNING("'%s' : wrong number of parameters Code numInputs:%d numOutputs:%d Definition numInputs:%d numOutputs:%d",
+									name, numInputs, numOutputs, functionDefinition->GetNumInputs(), functionDefinition->GetNumOutputs());
+			return LES_RETURN_ERROR;
+		}
+	}
+	for (int i = 0; i < numParams; i++)
+	{
+		if (LES_FunctionAddCallParam(&params[i], functionDefinition, &functionTempData) != LES_RETURN_OK)
+		{
+			LES_WARNING("'%s' : Error adding parameter %d", name, i);
+			return LES_RETURN_ERROR;
+		}
+	}
+	return LES_FunctionEnd(functionDefinition, &functionTempData);
+}
+
+#endif // #if LES_COMPILETIME_HASH
@@ -3,10 +3,14 @@
 
 #include "les_base.h"
 #include "les_logger.h"
+#include "les_hash.h"
 #include "les_function.h"
+#include "les_coreengine.h"
 
 class LES_FunctionDefinition;
 class LES_FunctionParameterData;
+class LES_FunctionPlan;
+struct LES_FunctionCallSiteCache;
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -26,21 +30,47 @@ struct LES_FunctionTempData
 	int functionOutputMacroParamIndex;
 
 	LES_FunctionParameterData* functionParameterData;
+	const LES_FunctionPlan* functionPlan;
+	LES_FunctionCallSiteCache* functionCallSiteCache;
+	bool functionTrusted;
+	LES_FunctionRPCHandle* functionRPCHandle;
+	bool functionNoCopy;
+	void* functionParamData[LES_MAX_NUM_FUNCTION_PARAMS];
 	char paramUsed[LES_MAX_NUM_FUNCTION_PARAMS];
 };
 
-extern int LES_FunctionStart(const char* const name, const char* const returnType, 
+/* 
+ * Per call-site cache of the validated function definition : invalid when generation doesn't match
+ * The call-site also owns its last parameter block which stays valid until the call-site runs again
+ * Once a call-site has completed without errors it is trusted : its parameters are added without being validated
+*/
+struct LES_FunctionCallSiteCache
+{
+	const LES_FunctionDefinition* functionDefinition;
+	const LES_FunctionPlan* functionPlan;
+	int definitionGeneration;
+	LES_FunctionParameterData* parameterData;
+	int parameterDataPoolEpoch;
+	int trustedGeneration;
+};
+
+extern int LES_FunctionStart(const char* const name, const LES_Hash nameHash, 
+														 const char* const returnType, const LES_Hash returnTypeHash,
 												  	 const LES_FunctionDefinition** functionDefinitionPtr,
-														 LES_FunctionTempData* const functionTempData);
+														 LES_FunctionTempData* const functionTempData,
+														 LES_FunctionCallSiteCache* const callSiteCache);
 
 #define LES_FUNCTION_START(FUNC_NAME, RETURN_TYPE) \
 	{ \
 		bool __LES_ok = true; \
+		static LES_FunctionCallSiteCache __LESfunctionCallSiteCache = { LES_NULL, LES_NULL, -1, LES_NULL, -1, -1 }; \
 		const LES_FunctionDefinition* __LESfunctionDefinition = LES_NULL; \
 		LES_FunctionTempData __LESfunctionTempData; \
-		if (LES_FunctionStart(#FUNC_NAME, #RETURN_TYPE, \
+		if (LES_FunctionStart(#FUNC_NAME, LES_HASH_LITERAL(#FUNC_NAME), \
+													#RETURN_TYPE, LES_HASH_LITERAL(#RETURN_TYPE), \
 													&__LESfunctionDefinition, \
-													&__LESfunctionTempData) != LES_RETURN_OK) \
+													&__LESfunctionTempData, \
+													&__LESfunctionCallSiteCache) != LES_RETURN_OK) \
 		{ \
 			LES_FATAL_ERROR("'%s' : Error during LES_FunctionStart", #FUNC_NAME); \
 			__LES_ok = false; \
@@ -75,7 +105,41 @@ extern int LES_FunctionEnd(const LES_FunctionDefinition* const functionDefinitio
 	} \
 
 
-extern int LES_FunctionAddParam(const char* const type, const char* const name, const int index, 
+/* 
+ * As LES_FUNCTION_END() : RPC_HANDLE is set to the handle to poll for the result of the call
+ * The output parameters are written back when the result arrives : they must stay valid until the call is complete
+*/
+#define LES_FUNCTION_END_ASYNC(RPC_HANDLE) \
+		RPC_HANDLE = LES_FUNCTIONRPC_INVALID_HANDLE; \
+		__LESfunctionTempData.functionRPCHandle = &(RPC_HANDLE); \
+		LES_FUNCTION_END() \
+
+
+/* 
+ * As LES_FUNCTION_END_ASYNC(RPC_HANDLE) : large input arrays & buffers are sent straight from the caller's memory
+ * The inputs must also stay valid and unchanged until the call is complete
+*/
+#define LES_FUNCTION_END_ASYNC_NOCOPY(RPC_HANDLE) \
+		__LESfunctionTempData.functionNoCopy = true; \
+		LES_FUNCTION_END_ASYNC(RPC_HANDLE) \
+
+
+/* 
+ * As LES_FUNCTION_END() : large input arrays & buffers are sent straight from the caller's memory
+ * It waits up to LES_FUNCTION_NOCOPY_WAIT_TIME seconds for the call to complete, the outputs are written back
+ * Inside LES_CoreEngineTick (a received message handler) it can't wait : the inputs are copied
+*/
+#ifndef LES_FUNCTION_NOCOPY_WAIT_TIME
+#define LES_FUNCTION_NOCOPY_WAIT_TIME (10.0f)
+#endif // #ifndef LES_FUNCTION_NOCOPY_WAIT_TIME
+
+#define LES_FUNCTION_END_NOCOPY() \
+		__LESfunctionTempData.functionNoCopy = true; \
+		LES_FUNCTION_END() \
+
+
+extern int LES_FunctionAddParam(const char* const type, const LES_Hash typeHash, 
+																const char* const name, const LES_Hash nameHash, const int index, 
 																const char* const mode, const bool isInput, void* const data,
 												  			const LES_FunctionDefinition* const functionDefinition,
 																LES_FunctionTempData* const functionTempData);
@@ -83,7 +147,8 @@ extern int LES_FunctionAddParam(const char* const type, const char* const name,
 #define LES_FUNCTION_ADD_PARAM(PARAM_TYPE, IS_INPUT, NUMBER, TYPE, NAME) \
 		if (__LES_ok == true) \
 		{ \
-			if (LES_FunctionAddParam(#TYPE, #NAME, NUMBER, #PARAM_TYPE, IS_INPUT, (void*)&NAME, \
+			if (LES_FunctionAddParam(#TYPE, LES_HASH_LITERAL(#TYPE), #NAME, LES_HASH_LITERAL(#NAME), \
+						NUMBER, #PARAM_TYPE, IS_INPUT, (void*)&NAME, \
 						__LESfunctionDefinition, &__LESfunctionTempData) != LES_RETURN_OK) \
 			{ \
 				LES_FATAL_ERROR("'%s' : Error adding " #PARAM_TYPE " parameter %d '%s' type:'%s'", \
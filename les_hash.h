@@ -10,5 +10,35 @@ typedef LES_uint LES_Hash;
 LES_Hash LES_GenerateHash(const char* const str);
 LES_Hash LES_GenerateHashCaseSensitive(const char* const str);
 
+/* 
+ * Compile-time version of LES_GenerateHashCaseSensitive for string literals : must give identical results
+ * LES_HASH_LITERAL("str") is a compile-time constant when the compiler supports constexpr
+ * otherwise it falls back to the runtime hash
+*/
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+
+#define LES_COMPILETIME_HASH 1
+
+constexpr LES_Hash LES_CompileTimeHashCaseSensitive(const char* const str, const LES_Hash hash = 0)
+{
+	// hash=387*hash+char : same as hash += (hash << 7); hash += (hash << 1); hash += char;
+	return (*str == 0) ? hash : LES_CompileTimeHashCaseSensitive(str + 1, (hash * 387U) + (LES_Hash)*str);
+}
+
+template <LES_Hash HASH> struct LES_CompileTimeHashValue
+{
+	static const LES_Hash value = HASH;
+};
+
+#define LES_HASH_LITERAL(STR) (LES_CompileTimeHashValue<LES_CompileTimeHashCaseSensitive(STR)>::value)
+
+#else // #if defined(__cplusplus) && (__cplusplus >= 201103L)
+
+#define LES_COMPILETIME_HASH 0
+
+#define LES_HASH_LITERAL(STR) (LES_GenerateHashCaseSensitive(STR))
+
+#endif // #if defined(__cplusplus) && (__cplusplus >= 201103L)
+
 #endif // #ifndef LES_HASH_HH
 
@@ -0,0 +1,140 @@
+#include "les_hashdata.h"
+#include "les_logger.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Internal Static functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Same as LES_HashTableMix in les_hashdata.py */
+static LES_uint32 LES_HashTableMix(const LES_Hash hash, const LES_uint32 seed)
+{
+	LES_uint32 mixed = ((LES_uint32)hash ^ seed) * 0x9E3779B1U;
+	mixed ^= mixed >> 15;
+	mixed *= 0x85EBCA77U;
+	mixed ^= mixed >> 13;
+	return mixed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int LES_HashTable::Find(const LES_Hash hash) const
+{
+	if (m_numEntries == 0)
+	{
+		return -1;
+	}
+	const LES_uint32 bucket = LES_HashTableMix(hash, 0) % (LES_uint32)m_numBuckets;
+	const LES_uint32 slot = LES_HashTableMix(hash, m_bucketSeeds[bucket]) % (LES_uint32)m_numEntries;
+	return GetEntryIndexes()[slot];
+}
+
+const LES_HashTable* LES_HashData::GetHashTable(const int table, const int numEntries) const
+{
+	if ((m_settled == 0) || (table < 0) || (table >= m_numTables))
+	{
+		return LES_NULL;
+	}
+	const LES_HashTable* const pHashTable = GetTable(table);
+	const int tableNumEntries = pHashTable->GetNumEntries();
+	if (tableNumEntries == 0)
+	{
+		return LES_NULL;
+	}
+	if (tableNumEntries != numEntries)
+	{
+		LES_WARNING("LES_HashData::GetHashTable table[%d] numEntries:%d doesn't match chunk numEntries:%d",
+								table, tableNumEntries, numEntries);
+		return LES_NULL;
+	}
+	return pHashTable;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Private External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int LES_HashData::Settle(const int chunkSize)
+{
+	// Each count & offset is checked against the chunk size before the data it describes is read
+	const int headerSize = 8;
+	if (chunkSize < headerSize)
+	{
+		LES_ERROR("LES_HashData::Settle chunkSize:%d too small", chunkSize);
+		return LES_RETURN_ERROR;
+	}
+	if (m_settled != 0)
+	{
+		LES_LOG("m_settled != 0");
+		return LES_RETURN_ERROR;
+	}
+
+	// Convert from little endian first
+	m_numTables = fromBigEndian32(m_numTables);
+	m_settled = fromBigEndian32(m_settled);
+
+	const int numTables = m_numTables;
+	if ((numTables < 0) || (numTables > ((chunkSize - headerSize) / 4)))
+	{
+		LES_ERROR("LES_HashData::Settle invalid numTables:%d chunkSize:%d", numTables, chunkSize);
+		return LES_RETURN_ERROR;
+	}
+	// The tables are written in order after the table offsets : they can't overlap
+	int tablesEnd = headerSize + (numTables * 4);
+	for (int i = 0; i < numTables; i++)
+	{
+		m_tableOffsets[i] = fromBigEndian32(m_tableOffsets[i]);
+		const int tableOffset = m_tableOffsets[i];
+		if ((tableOffset < tablesEnd) || ((tableOffset & 3) != 0) || (tableOffset > (chunkSize - headerSize)))
+		{
+			LES_ERROR("LES_HashData::Settle table[%d] invalid offset:%d chunkSize:%d", i, tableOffset, chunkSize);
+			return LES_RETURN_ERROR;
+		}
+
+		// Settle the table
+		LES_HashTable* const pHashTable = (LES_HashTable*)GetTable(i);
+		pHashTable->m_numEntries = fromBigEndian32(pHashTable->m_numEntries);
+		pHashTable->m_numBuckets = fromBigEndian32(pHashTable->m_numBuckets);
+		const int numBuckets = pHashTable->m_numBuckets;
+		const int numEntries = pHashTable->m_numEntries;
+		const int maxNumValues = (chunkSize - tableOffset - headerSize) / 4;
+		if ((numBuckets < 0) || (numEntries < 0) || (numBuckets > maxNumValues) || (numEntries > (maxNumValues - numBuckets)))
+		{
+			LES_ERROR("LES_HashData::Settle table[%d] numEntries:%d numBuckets:%d don't fit in chunkSize:%d", 
+								i, numEntries, numBuckets, chunkSize);
+			return LES_RETURN_ERROR;
+		}
+		if ((numEntries > 0) && (numBuckets == 0))
+		{
+			LES_ERROR("LES_HashData::Settle table[%d] numEntries:%d invalid numBuckets:%d", i, numEntries, numBuckets);
+			return LES_RETURN_ERROR;
+		}
+		for (int b = 0; b < numBuckets; b++)
+		{
+			pHashTable->m_bucketSeeds[b] = fromBigEndian32(pHashTable->m_bucketSeeds[b]);
+		}
+		LES_int32* const pEntryIndexes = (LES_int32*)pHashTable->GetEntryIndexes();
+		for (int e = 0; e < numEntries; e++)
+		{
+			pEntryIndexes[e] = fromBigEndian32(pEntryIndexes[e]);
+			// Find returns the entry index : GetHashTable checks numEntries is the number of entries in the chunk it indexes
+			if ((pEntryIndexes[e] < 0) || (pEntryIndexes[e] >= numEntries))
+			{
+				LES_ERROR("LES_HashData::Settle table[%d] slot:%d invalid entry index:%d numEntries:%d", 
+									i, e, pEntryIndexes[e], numEntries);
+				return LES_RETURN_ERROR;
+			}
+		}
+		tablesEnd = tableOffset + headerSize + ((numBuckets + numEntries) * 4);
+	}
+
+	m_settled = 1;
+	return LES_RETURN_OK;
+}
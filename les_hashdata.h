@@ -0,0 +1,100 @@
+#ifndef LES_HASHDATA_HH
+#define LES_HASHDATA_HH
+
+#include "les_base.h"
+#include "les_hash.h"
+
+/*
+ * Minimal perfect hash (hash & displace) from an entry hash to the index of the entry in its chunk : made by les_hashdata.py
+ * bucket = LES_HashTableMix(hash, 0) % m_numBuckets
+ * slot = LES_HashTableMix(hash, m_bucketSeeds[bucket]) % m_numEntries
+ * m_entryIndexes[slot] is the only candidate : the caller compares the hash of that entry
+
+LES_HashTable
+{
+	LES_int32 m_numEntries;										// 4-bytes : 0 if the chunk isn't hashed
+	LES_int32 m_numBuckets;										// 4-bytes
+	LES_uint32 m_bucketSeeds[m_numBuckets];		// 4-bytes * m_numBuckets
+	LES_int32 m_entryIndexes[m_numEntries];		// 4-bytes * m_numEntries
+};
+
+LES_HashData
+{
+	LES_int32 m_numTables; 										// 4-bytes
+	LES_int32 m_settled;											// 4-bytes
+	LES_int32 m_tableOffsets[m_numTables];		// 4-bytes * m_numTables : from the start of the chunk
+	LES_HashTable m_tables[m_numTables];			// variable
+};
+*/
+
+#define LES_HASHDATA_STRINGTABLE 	(0)
+#define LES_HASHDATA_TYPEDATA 		(1)
+#define LES_HASHDATA_STRUCTDATA 	(2)
+#define LES_HASHDATA_FUNCTIONDATA (3)
+#define LES_HASHDATA_NUMTABLES 		(4)
+
+class LES_HashTable
+{
+public:
+	int GetNumEntries(void) const;
+	/* The index of the only entry which can have the hash : -1 if the table is empty, Settle checked it is below GetNumEntries */
+	int Find(const LES_Hash hash) const;
+
+	friend class LES_HashData;
+private:
+	LES_HashTable();
+	~LES_HashTable();
+
+	const LES_int32* GetEntryIndexes(void) const;
+
+	LES_int32 m_numEntries;
+	LES_int32 m_numBuckets;
+	LES_uint32 m_bucketSeeds[1];		// m_bucketSeeds[m_numBuckets];
+	// LES_int32 m_entryIndexes[m_numEntries];
+};
+
+class LES_HashData
+{
+public:
+	int GetNumTables(void) const;
+	/* NULL if the table isn't in the file, isn't hashed or doesn't have numEntries entries */
+	const LES_HashTable* GetHashTable(const int table, const int numEntries) const;
+
+	friend class LES_DefinitionFile;
+private:
+	/* chunkSize is the number of bytes in the hash data chunk : the tables & entry indexes must be inside it */
+	int Settle(const int chunkSize);
+
+	LES_HashData();
+	~LES_HashData();
+
+	const LES_HashTable* GetTable(const int table) const;
+
+	LES_int32 m_numTables;
+	LES_int32 m_settled;
+	LES_int32 m_tableOffsets[1];		// m_tableOffsets[m_numTables];
+	// LES_HashTable m_tables[m_numTables];
+};
+
+inline int LES_HashTable::GetNumEntries(void) const
+{
+	return m_numEntries;
+}
+
+inline const LES_int32* LES_HashTable::GetEntryIndexes(void) const
+{
+	return (const LES_int32*)&m_bucketSeeds[m_numBuckets];
+}
+
+inline int LES_HashData::GetNumTables(void) const
+{
+	return m_numTables;
+}
+
+inline const LES_HashTable* LES_HashData::GetTable(const int table) const
+{
+	const char* const basePtr = (const char*)&m_numTables;
+	return (const LES_HashTable*)(basePtr + m_tableOffsets[table]);
+}
+
+#endif // #ifndef LES_HASHDATA_HH
@@ -0,0 +1,195 @@
+#!/usr/bin/python
+
+import les_logger
+
+# Minimal perfect hash (hash & displace) from an entry hash to the index of the entry in its chunk
+# bucket = LES_HashTableMix(hash, 0) % m_numBuckets
+# slot = LES_HashTableMix(hash, m_bucketSeeds[bucket]) % m_numEntries
+# m_entryIndexes[slot] is the only candidate : the caller compares the hash of that entry
+
+# LES_HashTable
+# {
+#		LES_int32 m_numEntries;																	- 4-bytes : 0 if the chunk isn't hashed
+#		LES_int32 m_numBuckets;																	- 4-bytes
+#		LES_uint32 m_bucketSeeds[m_numBuckets];									- 4-bytes * m_numBuckets
+#		LES_int32 m_entryIndexes[m_numEntries];									- 4-bytes * m_numEntries
+# };
+
+# LES_HashData
+# {
+# 	LES_int32 m_numTables; 																	- 4-bytes
+# 	LES_int32 m_settled; 																		- 4-bytes, 0 in file
+#		LES_int32 m_tableOffsets[m_numTables];									- 4-bytes * m_numTables : from the start of the chunk
+#		LES_HashTable m_tables[m_numTables];										- variable
+# };
+
+# Same order as LES_HASHDATA_* in les_hashdata.h
+LES_HASHDATA_STRINGTABLE = 0
+LES_HASHDATA_TYPEDATA = 1
+LES_HASHDATA_STRUCTDATA = 2
+LES_HASHDATA_FUNCTIONDATA = 3
+LES_HASHDATA_NUMTABLES = 4
+
+LES_HASHTABLE_ENTRIES_PER_BUCKET = 2
+LES_HASHTABLE_MAX_SEED = 0x100000
+
+# Same as LES_HashTableMix in les_hashdata.cpp
+def LES_HashTableMix(hashValue, seed):
+	mixed = ((hashValue ^ seed) * 0x9E3779B1) & 0xFFFFFFFF
+	mixed ^= mixed >> 15
+	mixed = (mixed * 0x85EBCA77) & 0xFFFFFFFF
+	mixed ^= mixed >> 13
+	return mixed
+
+class LES_HashTable():
+	def __init__(self, name, hashValues):
+		self.__m_numEntries__ = 0
+		self.__m_bucketSeeds__ = []
+		self.__m_entryIndexes__ = []
+
+		numEntries = len(hashValues)
+		if numEntries == 0:
+			return
+		# Entries with the same hash can't be perfectly hashed : the chunk is written without a table and found at runtime
+		if len(set(hashValues)) != numEntries:
+			les_logger.Warning("LES_HashTable '%s' has entries with the same hash : not hashed", name)
+			return
+
+		numBuckets = (numEntries + LES_HASHTABLE_ENTRIES_PER_BUCKET - 1) / LES_HASHTABLE_ENTRIES_PER_BUCKET
+		buckets = []
+		for b in range(numBuckets):
+			buckets.append([])
+		for i in range(numEntries):
+			bucket = LES_HashTableMix(hashValues[i], 0) % numBuckets
+			buckets[bucket].append(i)
+
+		bucketSeeds = [0] * numBuckets
+		entryIndexes = [-1] * numEntries
+		# Biggest buckets first while there are the most free slots
+		bucketOrder = sorted(range(numBuckets), key=lambda b: len(buckets[b]), reverse=True)
+		for bucket in bucketOrder:
+			entries = buckets[bucket]
+			if len(entries) == 0:
+				break
+			seed = 1
+			while seed < LES_HASHTABLE_MAX_SEED:
+				slots = []
+				for i in entries:
+					slot = LES_HashTableMix(hashValues[i], seed) % numEntries
+					if (entryIndexes[slot] != -1) or (slot in slots):
+						break
+					slots.append(slot)
+				if len(slots) == len(entries):
+					break
+				seed += 1
+			if seed == LES_HASHTABLE_MAX_SEED:
+				les_logger.Warning("LES_HashTable '%s' no seed found for bucket:%d numEntries:%d : not hashed", name, bucket, len(entries))
+				return
+			bucketSeeds[bucket] = seed
+			for s in range(len(entries)):
+				entryIndexes[slots[s]] = entries[s]
+
+		self.__m_numEntries__ = numEntries
+		self.__m_bucketSeeds__ = bucketSeeds
+		self.__m_entryIndexes__ = entryIndexes
+
+	def find(self, hashValue):
+		numEntries = self.__m_numEntries__
+		if numEntries == 0:
+			return -1
+		numBuckets = len(self.__m_bucketSeeds__)
+		bucket = LES_HashTableMix(hashValue, 0) % numBuckets
+		slot = LES_HashTableMix(hashValue, self.__m_bucketSeeds__[bucket]) % numEntries
+		return self.__m_entryIndexes__[slot]
+
+	def write(self, binFile):
+		#		LES_int32 m_numEntries;																	- 4-bytes : 0 if the chunk isn't hashed
+		binFile.writeInt32(self.__m_numEntries__)
+		#		LES_int32 m_numBuckets;																	- 4-bytes
+		binFile.writeInt32(len(self.__m_bucketSeeds__))
+		#		LES_uint32 m_bucketSeeds[m_numBuckets];									- 4-bytes * m_numBuckets
+		for seed in self.__m_bucketSeeds__:
+			binFile.writeUint32(seed)
+		#		LES_int32 m_entryIndexes[m_numEntries];									- 4-bytes * m_numEntries
+		for entryIndex in self.__m_entryIndexes__:
+			binFile.writeInt32(entryIndex)
+
+class LES_HashData():
+	def __init__(self, stringTable, typeData, structData, functionData):
+		self.__m_stringTable__ = stringTable
+		self.__m_typeData__ = typeData
+		self.__m_structData__ = structData
+		self.__m_functionData__ = functionData
+
+	# The tables are made when written so they include everything loaded into the other chunks
+	def createHashTables(self):
+		stringTable = self.__m_stringTable__
+		stringHashes = []
+		for i in range(stringTable.getNumStrings()):
+			stringHashes.append(stringTable.getHash(i))
+
+		typeHashes = []
+		for i in range(self.__m_typeData__.getNumTypes()):
+			typeHashes.append(self.__m_typeData__.getTypeEntryByIndex(i).m_hash)
+
+		structHashes = []
+		for i in range(self.__m_structData__.getNumStructDefinitions()):
+			nameID = self.__m_structData__.getStructDefinitionByIndex(i).GetNameID()
+			structHashes.append(stringTable.getHash(nameID))
+
+		functionHashes = []
+		for i in range(self.__m_functionData__.getNumFunctionDefinitions()):
+			nameID = self.__m_functionData__.getFunctionDefinitionByIndex(i).GetNameID()
+			functionHashes.append(stringTable.getHash(nameID))
+
+		hashTables = [None] * LES_HASHDATA_NUMTABLES
+		hashTables[LES_HASHDATA_STRINGTABLE] = LES_HashTable("StringTable", stringHashes)
+		hashTables[LES_HASHDATA_TYPEDATA] = LES_HashTable("TypeData", typeHashes)
+		hashTables[LES_HASHDATA_STRUCTDATA] = LES_HashTable("StructData", structHashes)
+		hashTables[LES_HASHDATA_FUNCTIONDATA] = LES_HashTable("FunctionData", functionHashes)
+		return hashTables
+
+	def write(self, binFile):
+		basePosition = binFile.getIndex()
+		hashTables = self.createHashTables()
+		numTables = len(hashTables)
+
+		# 	LES_int32 m_numTables; 																	- 4-bytes
+		binFile.writeInt32(numTables)
+
+		# 	LES_int32 m_settled; 																		- 4-bytes, 0 in file
+		settled = 0
+		binFile.writeInt32(settled)
+
+		#		LES_int32 m_tableOffsets[m_numTables];									- 4-bytes * m_numTables : from the start of the chunk
+		tableOffsetsIndex = binFile.getIndex()
+		for i in range(numTables):
+			binFile.writeInt32(-1)
+
+		#		LES_HashTable m_tables[m_numTables];										- variable
+		tableOffsets = []
+		for hashTable in hashTables:
+			tableOffsets.append(binFile.getIndex() - basePosition)
+			hashTable.write(binFile)
+
+		endPosition = binFile.getIndex()
+		binFile.seek(tableOffsetsIndex)
+		for offset in tableOffsets:
+			binFile.writeInt32(offset)
+		binFile.seek(endPosition)
+
+def runTest():
+	les_logger.Init()
+	hashValues = []
+	for i in range(1000):
+		hashValues.append((i * 0x9E3779B1) & 0xFFFFFFFF)
+	this = LES_HashTable("Test", hashValues)
+	for i in range(len(hashValues)):
+		if this.find(hashValues[i]) != i:
+			les_logger.Error("LES_HashTable hash:0x%X not found index:%d", hashValues[i], i)
+	duplicates = LES_HashTable("Duplicates", [1, 2, 1])
+	if duplicates.find(1) != -1:
+		les_logger.Error("LES_HashTable with duplicate hashes was hashed")
+
+if __name__ == '__main__':
+	runTest()
@@ -0,0 +1,133 @@
+#include <string.h>
+
+#include "les_hashindex.h"
+
+#define LES_HASHINDEX_MIN_NUM_SLOTS (64)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+LES_HashIndex::LES_HashIndex(void) : m_slots(LES_NULL), m_numSlots(0), m_numEntries(0)
+{
+}
+
+LES_HashIndex::~LES_HashIndex(void)
+{
+	Free();
+}
+
+/* Makes room for numEntries without growing again */
+void LES_HashIndex::Reserve(const int numEntries)
+{
+	int numSlots = LES_HASHINDEX_MIN_NUM_SLOTS;
+	while (numSlots < (numEntries * 2))
+	{
+		numSlots *= 2;
+	}
+	if (numSlots > m_numSlots)
+	{
+		Resize(numSlots);
+	}
+}
+
+void LES_HashIndex::Clear(void)
+{
+	if (m_slots)
+	{
+		memset(m_slots, 0xFF, sizeof(LES_HashIndexSlot) * (size_t)m_numSlots);
+	}
+	m_numEntries = 0;
+}
+
+void LES_HashIndex::Free(void)
+{
+	delete[] m_slots;
+	m_slots = LES_NULL;
+	m_numSlots = 0;
+	m_numEntries = 0;
+}
+
+void LES_HashIndex::Add(const LES_Hash hash, const int value)
+{
+	if (((m_numEntries + 1) * 2) > m_numSlots)
+	{
+		Resize((m_numSlots > 0) ? (m_numSlots * 2) : LES_HASHINDEX_MIN_NUM_SLOTS);
+	}
+	const int slotMask = m_numSlots - 1;
+	int slot = GetHomeSlot(hash);
+	while (m_slots[slot].m_value >= 0)
+	{
+		slot = (slot + 1) & slotMask;
+	}
+	m_slots[slot].m_hash = hash;
+	m_slots[slot].m_value = value;
+	m_numEntries++;
+}
+
+int LES_HashIndex::Find(const LES_Hash hash, int* const pSlot) const
+{
+	if (m_numEntries == 0)
+	{
+		*pSlot = -1;
+		return -1;
+	}
+	/* FindNext starts after the slot */
+	*pSlot = (GetHomeSlot(hash) - 1) & (m_numSlots - 1);
+	return FindNext(hash, pSlot);
+}
+
+int LES_HashIndex::FindNext(const LES_Hash hash, int* const pSlot) const
+{
+	if (*pSlot < 0)
+	{
+		return -1;
+	}
+	const int slotMask = m_numSlots - 1;
+	int slot = (*pSlot + 1) & slotMask;
+	/* There is always an empty slot to stop at */
+	while (m_slots[slot].m_value >= 0)
+	{
+		if (m_slots[slot].m_hash == hash)
+		{
+			*pSlot = slot;
+			return m_slots[slot].m_value;
+		}
+		slot = (slot + 1) & slotMask;
+	}
+	*pSlot = -1;
+	return -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Private functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LES_HashIndex::Resize(const int numSlots)
+{
+	LES_HashIndexSlot* const oldSlots = m_slots;
+	const int oldNumSlots = m_numSlots;
+
+	m_slots = new LES_HashIndexSlot[numSlots];
+	m_numSlots = numSlots;
+	Clear();
+	for (int i = 0; i < oldNumSlots; i++)
+	{
+		if (oldSlots[i].m_value >= 0)
+		{
+			Add(oldSlots[i].m_hash, oldSlots[i].m_value);
+		}
+	}
+	delete[] oldSlots;
+}
+
+/* Fibonacci hashing : hashes which only differ in a few bits are spread over the slots */
+int LES_HashIndex::GetHomeSlot(const LES_Hash hash) const
+{
+	const LES_uint32 mixed = (LES_uint32)hash * 2654435761U;
+	return (int)((mixed ^ (mixed >> 15)) & (LES_uint32)(m_numSlots - 1));
+}
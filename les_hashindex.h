@@ -0,0 +1,48 @@
+#ifndef LES_HASHINDEX_HH
+#define LES_HASHINDEX_HH
+
+#include "les_base.h"
+#include "les_hash.h"
+
+/*
+ * Open addressing (linear probing) index from a hash to an int value e.g. the index of the entry in its array
+ * Different entries can have the same hash : FindNext returns each value with the hash, the caller compares the entries
+ * The number of slots is a power of 2 and at least twice the number of entries : it grows as entries are added
+*/
+struct LES_HashIndexSlot
+{
+	LES_Hash m_hash;
+	LES_int32 m_value;			// -1 for an empty slot
+};
+
+class LES_HashIndex
+{
+public:
+	LES_HashIndex(void);
+	~LES_HashIndex(void);
+
+	void Reserve(const int numEntries);
+	void Clear(void);
+	void Free(void);
+	void Add(const LES_Hash hash, const int value);
+
+	/* The first value with the hash or -1 : pSlot is the search position to pass to FindNext */
+	int Find(const LES_Hash hash, int* const pSlot) const;
+	/* The next value with the hash after pSlot or -1 */
+	int FindNext(const LES_Hash hash, int* const pSlot) const;
+
+	int GetNumEntries(void) const { return m_numEntries; }
+
+private:
+	LES_HashIndex(const LES_HashIndex& other);
+	LES_HashIndex& operator=(const LES_HashIndex& other);
+
+	void Resize(const int numSlots);
+	int GetHomeSlot(const LES_Hash hash) const;
+
+	LES_HashIndexSlot* m_slots;
+	int m_numSlots;
+	int m_numEntries;
+};
+
+#endif // #ifndef LES_HASHINDEX_HH
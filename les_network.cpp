@@ -11,6 +11,7 @@
 #include "les_networkqueue.h"
 #include "les_networkmessage.h"
 #include "les_tcpsocket.h"
+#include "les_compress.h"
 
 #define LES_NETWORK_SEND_QUEUE_SIZE (128)
 #define LES_NETWORK_RECEIVE_QUEUE_SIZE (32)
@@ -44,13 +45,56 @@ static LES_NetworkSendQueue* s_pRequestSendItemQueue = LES_NULL;
 static LES_NetworkReceivedQueue* s_pReceivedMessageQueue = LES_NULL;
 static LES_NetworkReceivedQueue* s_pRequestReceivedMessageQueue = LES_NULL;
 
+// Send items which don't own their message : released by the main thread once the network thread has sent them
+struct LES_NetworkSendRelease
+{
+	LES_NetworkSendItemReleaseFunction* m_function;
+	void* m_context;
+};
+
+struct LES_NetworkSendReleaseList
+{
+	int m_numItems;
+	LES_NetworkSendRelease m_items[LES_NETWORK_SEND_QUEUE_SIZE];
+};
+
+static LES_NetworkSendReleaseList s_sendReleaseLists[2];
+static LES_NetworkSendReleaseList* s_pSendReleaseList = LES_NULL;
+static LES_NetworkSendReleaseList* s_pRequestSendReleaseList = LES_NULL;
+
 #define LES_NETWORK_MAX_NUM_HANDLERS 256
 static int s_numRegisteredMessageHandlers = 0;
 static LES_uint16 s_receivedMessageHandlerTypes[LES_NETWORK_MAX_NUM_HANDLERS];
 static LES_ReceivedMessageHandlerFunction* s_receivedMessageHandlerFunctions[LES_NETWORK_MAX_NUM_HANDLERS];
 
+// Handlers called on the network thread : registered with the network mutex locked
+#define LES_NETWORK_MAX_NUM_THREAD_HANDLERS 16
+static int s_numRegisteredMessageThreadHandlers = 0;
+static LES_uint16 s_receivedMessageThreadHandlerTypes[LES_NETWORK_MAX_NUM_THREAD_HANDLERS];
+static LES_ReceivedMessageHandlerFunction* s_receivedMessageThreadHandlerFunctions[LES_NETWORK_MAX_NUM_THREAD_HANDLERS];
+
+// A recv() can return several messages or part of a message : the unprocessed bytes stay at the start of the buffer
+// A whole message must fit in the buffer : the biggest the server sends is the definition file (8KB for the tests)
+// A bigger message is an error which stops the network thread : it can't be skipped without losing the stream
+#ifndef LES_NETWORK_MAX_RECEIVE_SIZE
 #define LES_NETWORK_MAX_RECEIVE_SIZE (128*1024)
+#endif // #ifndef LES_NETWORK_MAX_RECEIVE_SIZE
 static char les_receiveBuffer[LES_NETWORK_MAX_RECEIVE_SIZE];
+static int les_receiveBufferNumBytes = 0;
+
+// Smaller payloads aren't worth compressing : the saving is less than the time taken
+#ifndef LES_NETWORK_COMPRESS_MIN_PAYLOAD_SIZE
+#define LES_NETWORK_COMPRESS_MIN_PAYLOAD_SIZE (1024)
+#endif // #ifndef LES_NETWORK_COMPRESS_MIN_PAYLOAD_SIZE
+
+// Set by the main thread : the network thread's copy is taken when the queues are swapped (with the mutex locked)
+static bool s_networkSendCompression = false;
+static bool s_networkThreadSendCompression = false;
+static int s_networkNumCompressedSends = 0;
+
+// Only used by the network thread : compressed messages are built and uncompressed into these
+static char les_sendCompressBuffer[LES_NETWORK_MAX_RECEIVE_SIZE];
+static char les_receiveDecompressBuffer[LES_NETWORK_MAX_RECEIVE_SIZE];
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -76,6 +120,195 @@ static int LES_NetworkAddReceivedMessage(LES_NetworkMessage* const pReceivedMess
 	return LES_RETURN_OK;
 }
 
+static int LES_NetworkDispatchReceivedMessage(const char* const messageData, const LES_uint16 type, const LES_uint16 id, 
+																						 const LES_uint32 payloadSize)
+{
+	const int numThreadHandlers = s_numRegisteredMessageThreadHandlers;
+	for (int i = 0; i < numThreadHandlers; i++)
+	{
+		if (s_receivedMessageThreadHandlerTypes[i] == type)
+		{
+			void* const payload = (void*)(messageData + LES_NETWORK_MESSAGE_HEADER_SIZE);
+			const int ret = s_receivedMessageThreadHandlerFunctions[i](type, id, payloadSize, payload);
+			if (ret == LES_RETURN_ERROR)
+			{
+				LES_ERROR("LES_NetworkDispatchReceivedMessage ERROR returned by message thread handler type:0x%X", type);
+			}
+			return LES_RETURN_OK;
+		}
+	}
+
+	// Make a NetReceiveItem struct and put data into it
+	const int messageSize = LES_NETWORK_MESSAGE_HEADER_SIZE + (int)payloadSize;
+	LES_NetworkMessage* const pReceivedMessage = (LES_NetworkMessage* const)malloc(LES_NetworkMessageSize((int)payloadSize));
+	memcpy(pReceivedMessage, messageData, messageSize);
+	if (LES_NetworkAddReceivedMessage(pReceivedMessage) == LES_RETURN_ERROR)
+	{
+		LES_ERROR("Error adding received message");
+		free(pReceivedMessage);
+		return LES_RETURN_ERROR;
+	}
+	return LES_RETURN_OK;
+}
+
+static int LES_NetworkDispatchCompressedMessage(const char* const messageData, const LES_uint16 type, const LES_uint16 id, 
+																							 const LES_uint32 compressedPayloadSize)
+{
+	if (compressedPayloadSize < LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE)
+	{
+		LES_ERROR("LES_NetworkDispatchCompressedMessage type:0x%X compressed payloadSize:%d too small", type, compressedPayloadSize);
+		return LES_RETURN_ERROR;
+	}
+	LES_uint32 bigPayloadSize;
+	memcpy(&bigPayloadSize, messageData + LES_NETWORK_MESSAGE_HEADER_SIZE, sizeof(LES_uint32));
+	const LES_uint32 payloadSize = fromBigEndian32(bigPayloadSize);
+	if (payloadSize > (LES_NETWORK_MAX_RECEIVE_SIZE - LES_NETWORK_MESSAGE_HEADER_SIZE))
+	{
+		LES_ERROR("LES_NetworkDispatchCompressedMessage type:0x%X message too big payloadSize:%d max:%d", 
+							type, payloadSize, LES_NETWORK_MAX_RECEIVE_SIZE - LES_NETWORK_MESSAGE_HEADER_SIZE);
+		return LES_RETURN_ERROR;
+	}
+	const char* const compressedData = messageData + LES_NETWORK_MESSAGE_HEADER_SIZE + LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE;
+	const int compressedSize = (int)compressedPayloadSize - LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE;
+	const int numBytes = LES_DecompressBlock(les_receiveDecompressBuffer + LES_NETWORK_MESSAGE_HEADER_SIZE, (int)payloadSize, 
+																					 compressedData, compressedSize);
+	if (numBytes != (int)payloadSize)
+	{
+		LES_ERROR("LES_NetworkDispatchCompressedMessage type:0x%X decompress failed numBytes:%d payloadSize:%d", 
+							type, numBytes, payloadSize);
+		return LES_RETURN_ERROR;
+	}
+	// The uncompressed message has the same type & id
+	memcpy(les_receiveDecompressBuffer, messageData, 4);
+	memcpy(les_receiveDecompressBuffer + 4, &bigPayloadSize, sizeof(LES_uint32));
+	return LES_NetworkDispatchReceivedMessage(les_receiveDecompressBuffer, type, id, payloadSize);
+}
+
+static int LES_NetworkProcessReceiveBuffer(void)
+{
+	// Split the received data into whole messages : a partial message waits for the next recv()
+	const int numBytes = les_receiveBufferNumBytes;
+	int offset = 0;
+	while ((numBytes - offset) >= LES_NETWORK_MESSAGE_HEADER_SIZE)
+	{
+		const char* const messageData = les_receiveBuffer + offset;
+		LES_uint16 bigType;
+		LES_uint16 bigId;
+		LES_uint32 bigPayloadSize;
+		memcpy(&bigType, messageData + 0, sizeof(LES_uint16));
+		memcpy(&bigId, messageData + 2, sizeof(LES_uint16));
+		memcpy(&bigPayloadSize, messageData + 4, sizeof(LES_uint32));
+		const LES_uint32 payloadSizeFlags = fromBigEndian32(bigPayloadSize);
+		const LES_uint32 payloadSize = payloadSizeFlags & LES_NETWORK_MESSAGE_PAYLOAD_SIZE_MASK;
+		if (payloadSize > (LES_NETWORK_MAX_RECEIVE_SIZE - LES_NETWORK_MESSAGE_HEADER_SIZE))
+		{
+			LES_ERROR("LES_NetworkProcessReceiveBuffer message too big payloadSize:%d max:%d", 
+								payloadSize, LES_NETWORK_MAX_RECEIVE_SIZE - LES_NETWORK_MESSAGE_HEADER_SIZE);
+			return LES_RETURN_ERROR;
+		}
+		const int messageSize = LES_NETWORK_MESSAGE_HEADER_SIZE + (int)payloadSize;
+		if ((numBytes - offset) < messageSize)
+		{
+			break;
+		}
+		if (payloadSizeFlags & LES_NETWORK_MESSAGE_COMPRESSED)
+		{
+			LES_NetworkDispatchCompressedMessage(messageData, fromBigEndian16(bigType), fromBigEndian16(bigId), payloadSize);
+		}
+		else
+		{
+			LES_NetworkDispatchReceivedMessage(messageData, fromBigEndian16(bigType), fromBigEndian16(bigId), payloadSize);
+		}
+		offset += messageSize;
+	}
+	if (offset > 0)
+	{
+		memmove(les_receiveBuffer, les_receiveBuffer + offset, numBytes - offset);
+		les_receiveBufferNumBytes = numBytes - offset;
+	}
+	return LES_RETURN_OK;
+}
+
+/* Replaces the message with a compressed copy in les_sendCompressBuffer if compression is on and makes it smaller */
+static void LES_NetworkCompressSendMessage(const char** const ppSendData, int* const pSendDataSize)
+{
+	if (s_networkThreadSendCompression == false)
+	{
+		return;
+	}
+	const char* const messageData = *ppSendData;
+	LES_uint32 bigPayloadSize;
+	memcpy(&bigPayloadSize, messageData + 4, sizeof(LES_uint32));
+	const LES_uint32 payloadSize = fromBigEndian32(bigPayloadSize);
+	if ((payloadSize < LES_NETWORK_COMPRESS_MIN_PAYLOAD_SIZE) || (payloadSize & LES_NETWORK_MESSAGE_COMPRESSED) ||
+			(payloadSize > (LES_NETWORK_MAX_RECEIVE_SIZE - LES_NETWORK_MESSAGE_HEADER_SIZE)))
+	{
+		return;
+	}
+	char* const compressedData = les_sendCompressBuffer + LES_NETWORK_MESSAGE_HEADER_SIZE + LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE;
+	const int maxCompressedSize = (int)payloadSize - LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE - 1;
+	const int compressedSize = LES_CompressBlock(compressedData, maxCompressedSize, messageData + LES_NETWORK_MESSAGE_HEADER_SIZE, 
+																							 (int)payloadSize);
+	if (compressedSize < 0)
+	{
+		// Doesn't compress : send it as it is
+		return;
+	}
+	const int compressedPayloadSize = LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE + compressedSize;
+	const LES_uint32 bigCompressedPayloadSize = toBigEndian32((LES_uint32)compressedPayloadSize | LES_NETWORK_MESSAGE_COMPRESSED);
+	memcpy(les_sendCompressBuffer, messageData, 4);
+	memcpy(les_sendCompressBuffer + 4, &bigCompressedPayloadSize, sizeof(LES_uint32));
+	memcpy(les_sendCompressBuffer + LES_NETWORK_MESSAGE_HEADER_SIZE, &bigPayloadSize, sizeof(LES_uint32));
+	// Pad it like LES_NetworkSendItem::Create does
+	const int messageSize = LES_NetworkMessageSize(compressedPayloadSize);
+	const int compressedMessageSize = LES_NETWORK_MESSAGE_HEADER_SIZE + compressedPayloadSize;
+	memset(les_sendCompressBuffer + compressedMessageSize, 0, (size_t)(messageSize - compressedMessageSize));
+
+	*ppSendData = les_sendCompressBuffer;
+	*pSendDataSize = messageSize;
+	s_networkNumCompressedSends++;
+}
+
+/* The message memory with the referenced caller memory sent in between it : nothing is copied */
+static int LES_NetworkSendReferences(LES_TCPSocket* const pTCPSocket, const LES_NetworkSendItem* const pSendItem)
+{
+	const char* segmentData[LES_TCPSOCKET_MAX_NUM_SEGMENTS];
+	int segmentSizes[LES_TCPSOCKET_MAX_NUM_SEGMENTS];
+	const char* const messageData = (const char*)(pSendItem->GetMessagePtr());
+	const LES_NetworkSendReference* const references = pSendItem->GetReferences();
+	const int numReferences = pSendItem->GetNumReferences();
+	int numReferencedBytes = 0;
+	for (int i = 0; i < numReferences; i++)
+	{
+		numReferencedBytes += references[i].m_size;
+	}
+	// The padding at the end of the message is in the message memory
+	const int numMessageBytes = pSendItem->GetMessageSize() - numReferencedBytes;
+	int numSegments = 0;
+	int messageOffset = 0;
+	for (int i = 0; i < numReferences; i++)
+	{
+		const LES_NetworkSendReference* const reference = &references[i];
+		if (reference->m_offset > messageOffset)
+		{
+			segmentData[numSegments] = messageData + messageOffset;
+			segmentSizes[numSegments] = reference->m_offset - messageOffset;
+			numSegments++;
+			messageOffset = reference->m_offset;
+		}
+		segmentData[numSegments] = reference->m_data;
+		segmentSizes[numSegments] = reference->m_size;
+		numSegments++;
+	}
+	if (numMessageBytes > messageOffset)
+	{
+		segmentData[numSegments] = messageData + messageOffset;
+		segmentSizes[numSegments] = numMessageBytes - messageOffset;
+		numSegments++;
+	}
+	return pTCPSocket->SendSegments(segmentData, segmentSizes, numSegments);
+}
+
 #define LES_NETWORK_THREAD_PROCESS_FINISHED (0)
 #define LES_NETWORK_THREAD_PROCESS_MORE (1)
 #define LES_NETWORK_THREAD_PROCESS_ERROR (-1)
@@ -95,10 +328,21 @@ static int LES_NetworkThreadProcessOneLoop(LES_NetworkThreadStartStruct* const p
 	if (pSendItem != LES_NULL)
 	{
 		const char* pSendData = (const char*)(pSendItem->GetMessagePtr());
-		const int sendDataSize = pSendItem->GetMessageSize();
+		int sendDataSize = pSendItem->GetMessageSize();
 		if (sendDataSize > 0)
 		{
-			const int bytesSent = pTCPSocket->Send(pSendData, sendDataSize);
+			int bytesSent = 0;
+			if (pSendItem->GetNumReferences() > 0)
+			{
+				// Referenced memory is sent as it is : compressing it would mean copying it
+				bytesSent = LES_NetworkSendReferences(pTCPSocket, pSendItem);
+			}
+			else
+			{
+				// Compress here so the caller isn't charged for it : the send item's message isn't changed
+				LES_NetworkCompressSendMessage(&pSendData, &sendDataSize);
+				bytesSent = pTCPSocket->Send(pSendData, sendDataSize);
+			}
 			if (bytesSent == -1)
 			{
 				LES_ERROR("Send failed -1 bytes sent");
@@ -110,10 +354,9 @@ static int LES_NetworkThreadProcessOneLoop(LES_NetworkThreadStartStruct* const p
 		doMoreWork = true;
 	}
 
-	const int bufferLen = LES_NETWORK_MAX_RECEIVE_SIZE;
-	char* const buffer = les_receiveBuffer;
+	const int bufferLen = LES_NETWORK_MAX_RECEIVE_SIZE - les_receiveBufferNumBytes;
+	char* const buffer = les_receiveBuffer + les_receiveBufferNumBytes;
 	int bytesReceived = 0;
-	buffer[0] = '\0';
 	const int recvReturn = pTCPSocket->Recv(buffer, bufferLen, &bytesReceived);
 	if (recvReturn == LES_NETWORK_RECEIVE_ERROR)
 	{
@@ -126,12 +369,10 @@ static int LES_NetworkThreadProcessOneLoop(LES_NetworkThreadStartStruct* const p
 		if (bytesReceived > 0)
 		{
 			LES_LOG("Received bytes %d", bytesReceived);
-			// Make a NetReceiveItem struct and put data into it
-			LES_NetworkMessage* const pReceivedMessage = (LES_NetworkMessage* const)malloc(bytesReceived);
-			memcpy(pReceivedMessage, buffer, bytesReceived);
-			if (LES_NetworkAddReceivedMessage(pReceivedMessage) == LES_RETURN_ERROR)
+			les_receiveBufferNumBytes += bytesReceived;
+			if (LES_NetworkProcessReceiveBuffer() == LES_RETURN_ERROR)
 			{
-				LES_ERROR("Error adding received message");
+				return LES_NETWORK_THREAD_PROCESS_ERROR;
 			}
 		}
 	}
@@ -181,12 +422,31 @@ static void LES_NetworkSwapQueues(void)
 	s_pSendItemQueue = &s_sendItemQueues[networkThreadQueueIndex];
 	s_pRequestSendItemQueue = &s_sendItemQueues[mainThreadQueueIndex];
 
+	s_pSendReleaseList = &s_sendReleaseLists[networkThreadQueueIndex];
+	s_pRequestSendReleaseList = &s_sendReleaseLists[mainThreadQueueIndex];
+
 	s_pRequestReceivedMessageQueue = &s_receivedMessageQueues[networkThreadQueueIndex];
 	s_pReceivedMessageQueue = &s_receivedMessageQueues[mainThreadQueueIndex];
 
+	// The send items queued since the last swap are sent with the compression setting of the main thread at this swap
+	s_networkThreadSendCompression = s_networkSendCompression;
+
 	LES_NETWORK_UNLOCK_MUTEX;
 }
 
+static void LES_NetworkProcessSentReleases(void)
+{
+	// Only called once the network thread send queue is empty : every message in the release list has been sent
+	LES_NetworkSendReleaseList* const pSendReleaseList = s_pSendReleaseList;
+	const int numItems = pSendReleaseList->m_numItems;
+	for (int i = 0; i < numItems; i++)
+	{
+		const LES_NetworkSendRelease* const pSendRelease = &pSendReleaseList->m_items[i];
+		pSendRelease->m_function(pSendRelease->m_context);
+	}
+	pSendReleaseList->m_numItems = 0;
+}
+
 static void LES_NetworkProcessReceivedMessages(void)
 {
 	const int numRegisteredHandlers = s_numRegisteredMessageHandlers;
@@ -272,6 +532,32 @@ int LES_NetworkAddSendItem(const LES_NetworkSendItem* const pSendItem)
 	return LES_RETURN_OK;
 }
 
+int LES_NetworkAddSendItem(const LES_NetworkSendItem* const pSendItem, 
+													 LES_NetworkSendItemReleaseFunction* const pReleaseFunction, void* const releaseContext)
+{
+	if (pReleaseFunction == LES_NULL)
+	{
+		LES_ERROR("LES_NetworkAddSendItem() release function is NULL");
+		return LES_RETURN_ERROR;
+	}
+	LES_NetworkSendReleaseList* const pSendReleaseList = s_pRequestSendReleaseList;
+	if (pSendReleaseList->m_numItems >= LES_NETWORK_SEND_QUEUE_SIZE)
+	{
+		LES_ERROR("LES_NetworkAddSendItem() release list full");
+		return LES_RETURN_ERROR;
+	}
+	if (LES_NetworkAddSendItem(pSendItem) == LES_RETURN_ERROR)
+	{
+		return LES_RETURN_ERROR;
+	}
+	LES_NetworkSendRelease* const pSendRelease = &pSendReleaseList->m_items[pSendReleaseList->m_numItems];
+	pSendRelease->m_function = pReleaseFunction;
+	pSendRelease->m_context = releaseContext;
+	pSendReleaseList->m_numItems++;
+
+	return LES_RETURN_OK;
+}
+
 int LES_NetworkRegisterReceivedMessageHandler(const LES_uint16 type, LES_ReceivedMessageHandlerFunction* pFunction)
 {
 	const int index = s_numRegisteredMessageHandlers;
@@ -314,6 +600,53 @@ int LES_NetworkRegisterReceivedMessageHandler(const LES_uint16 type, LES_Receive
 	return LES_RETURN_OK;
 }
 
+int LES_NetworkRegisterReceivedMessageThreadHandler(const LES_uint16 type, LES_ReceivedMessageHandlerFunction* pFunction)
+{
+	LES_NETWORK_SCOPE_MUTEX;
+	const int index = s_numRegisteredMessageThreadHandlers;
+	if (type == LES_NETWORK_INVALID_MESSAGE_TYPE)
+	{
+		LES_ERROR("LES_NetworkRegisterReceivedMessageThreadHandler type:%d illegal type", type);
+		return LES_RETURN_ERROR;
+	}
+	if (index >= LES_NETWORK_MAX_NUM_THREAD_HANDLERS)
+	{
+		LES_ERROR("LES_NetworkRegisterReceivedMessageThreadHandler type:%d no free space for any more handlers MAX:%d", 
+							type, LES_NETWORK_MAX_NUM_THREAD_HANDLERS);
+		return LES_RETURN_ERROR;
+	}
+	for (int i = 0; i < index; i++)
+	{
+		if (s_receivedMessageThreadHandlerTypes[i] == type)
+		{
+			LES_ERROR("LES_NetworkRegisterReceivedMessageThreadHandler type:%d already registered", type);
+			return LES_RETURN_ERROR;
+		}
+	}
+
+	s_receivedMessageThreadHandlerTypes[index] = type;
+	s_receivedMessageThreadHandlerFunctions[index] = pFunction;
+	s_numRegisteredMessageThreadHandlers++;
+
+	return LES_RETURN_OK;
+}
+
+void LES_NetworkSetSendCompression(const bool enable)
+{
+	s_networkSendCompression = enable;
+}
+
+bool LES_NetworkGetSendCompression(void)
+{
+	return s_networkSendCompression;
+}
+
+int LES_NetworkGetNumCompressedSends(void)
+{
+	LES_NETWORK_SCOPE_MUTEX;
+	return s_networkNumCompressedSends;
+}
+
 void LES_NetworkInit(void)
 {
 	if (LES_TCPSocket::InitSystem() == LES_RETURN_ERROR)
@@ -324,6 +657,8 @@ void LES_NetworkInit(void)
 
 	LES_MutexVariableInit(&s_networkMutexVariable);
 	s_networkThreadQueueIndex = 0;
+	s_sendReleaseLists[0].m_numItems = 0;
+	s_sendReleaseLists[1].m_numItems = 0;
 	LES_NetworkSwapQueues();
 
 	for (int i = 0; i < LES_NETWORK_MAX_NUM_HANDLERS; i++)
@@ -333,6 +668,17 @@ void LES_NetworkInit(void)
 	}
 	s_numRegisteredMessageHandlers = 0;
 
+	for (int i = 0; i < LES_NETWORK_MAX_NUM_THREAD_HANDLERS; i++)
+	{
+		s_receivedMessageThreadHandlerTypes[i] = LES_NETWORK_INVALID_MESSAGE_TYPE;
+		s_receivedMessageThreadHandlerFunctions[i] = LES_NULL;
+	}
+	s_numRegisteredMessageThreadHandlers = 0;
+	les_receiveBufferNumBytes = 0;
+	s_networkSendCompression = false;
+	s_networkThreadSendCompression = false;
+	s_networkNumCompressedSends = 0;
+
 	const int ret = LES_CreateThread(&s_networkThreadHandle, LES_NULL, LES_NetworkThreadProcess, &s_networkThreadStartStruct);
 	LES_LOG("Network thread created handle:0x%X ret:%d", s_networkThreadHandle, ret);
 }
@@ -357,6 +703,9 @@ void LES_NetworkTick(void)
 		LES_Sleep(0.001f);
 	}
 
+	// Messages owned by the main thread can be released now they have been sent
+	LES_NetworkProcessSentReleases();
+
 	// s_pReceivedMessageQueue must be empty - otherwise main thread still processing received messages
 	// Drain the received message queue
 	LES_NetworkProcessReceivedMessages();
@@ -8,6 +8,7 @@
 struct LES_NetworkMessage;
 
 typedef int LES_ReceivedMessageHandlerFunction(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, void* payload);
+typedef void LES_NetworkSendItemReleaseFunction(void* const releaseContext);
 
 void LES_NetworkInit(void);
 void LES_NetworkTick(void);
@@ -15,6 +16,24 @@ void LES_NetworkShutdown(void);
 
 int LES_NetworkCreateTCPSocket(const char* const ip, const short port);
 int LES_NetworkAddSendItem(const LES_NetworkSendItem* const pSendItem);
+/* The release function is called from the main thread during LES_NetworkTick once the message has been sent */
+int LES_NetworkAddSendItem(const LES_NetworkSendItem* const pSendItem, 
+													 LES_NetworkSendItemReleaseFunction* const pReleaseFunction, void* const releaseContext);
 int LES_NetworkRegisterReceivedMessageHandler(const LES_uint16 type, LES_ReceivedMessageHandlerFunction* pFunction);
+/* 
+ * Thread handlers are called on the network thread as soon as the message arrives instead of during LES_NetworkTick
+ * They must be thread safe and must not keep the payload pointer : the payload is only valid during the call
+*/
+int LES_NetworkRegisterReceivedMessageThreadHandler(const LES_uint16 type, LES_ReceivedMessageHandlerFunction* pFunction);
+
+/* 
+ * Payloads bigger than LES_NETWORK_COMPRESS_MIN_PAYLOAD_SIZE are compressed on the network thread when sending them
+ * Only enable it once the other end has agreed it can decompress them : compressed messages are always accepted
+ * Main thread only : it applies to the send items the next LES_NetworkTick hands to the network thread
+*/
+void LES_NetworkSetSendCompression(const bool enable);
+bool LES_NetworkGetSendCompression(void);
+/* The number of messages which have been sent compressed */
+int LES_NetworkGetNumCompressedSends(void);
 
 #endif // #ifndef LES_NETWORK_HH
@@ -4,6 +4,16 @@
 #include "les_base.h"
 
 #define LES_NETWORK_INVALID_MESSAGE_TYPE (0xFFFF)
+/* type, id, payloadSize */
+#define LES_NETWORK_MESSAGE_HEADER_SIZE (8)
+
+/* 
+ * Set in m_payloadSize when the payload is compressed : the size without the flag is the compressed payload size
+ * A compressed payload is the big endian uncompressed payload size then the LES_CompressBlock data
+*/
+#define LES_NETWORK_MESSAGE_COMPRESSED (0x80000000)
+#define LES_NETWORK_MESSAGE_PAYLOAD_SIZE_MASK (0x7FFFFFFF)
+#define LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE (4)
 
 struct LES_NetworkMessage
 {
@@ -19,5 +29,7 @@ private:
 	~LES_NetworkMessage();
 };
 
+int LES_NetworkMessageSize(const int payloadSize);
+
 #endif //#ifndef LES_NETWORKMESSAGE_HH
 
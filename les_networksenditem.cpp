@@ -11,25 +11,19 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-static int LES_NetworkMessageSize(const int payloadSize)
+static void LES_SetNetworkMessageHeader(LES_NetworkMessage* const pNetworkMessage, 
+																				const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize)
 {
-	int payloadExtraMemmory = payloadSize - sizeof(int);
-	if (payloadExtraMemmory < 0)
-	{
-		payloadExtraMemmory = 0;
-	}
-	payloadExtraMemmory = (payloadExtraMemmory + 3) & ~3;
-	const int memorySize = sizeof(LES_NetworkMessage) + payloadExtraMemmory;
-	return memorySize;
+	pNetworkMessage->m_type = toBigEndian16(type);
+	pNetworkMessage->m_id = toBigEndian16(id);
+	pNetworkMessage->m_payloadSize = toBigEndian32(payloadSize);
 }
 
 static LES_NetworkMessage* LES_CreateNetworkMessage(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, 
 																										const int messageSize)
 {
 	LES_NetworkMessage* const pNetworkMessage = (LES_NetworkMessage*)malloc(messageSize);
-	pNetworkMessage->m_type = toBigEndian16(type);
-	pNetworkMessage->m_id = toBigEndian16(id);
-	pNetworkMessage->m_payloadSize = toBigEndian32(payloadSize);
+	LES_SetNetworkMessageHeader(pNetworkMessage, type, id, payloadSize);
 
 	return pNetworkMessage;
 }
@@ -40,11 +34,40 @@ static LES_NetworkMessage* LES_CreateNetworkMessage(const LES_uint16 type, const
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+int LES_NetworkMessageSize(const int payloadSize)
+{
+	int payloadExtraMemmory = payloadSize - sizeof(int);
+	if (payloadExtraMemmory < 0)
+	{
+		payloadExtraMemmory = 0;
+	}
+	payloadExtraMemmory = (payloadExtraMemmory + 3) & ~3;
+	const int memorySize = sizeof(LES_NetworkMessage) + payloadExtraMemmory;
+	return memorySize;
+}
+
 void LES_NetworkSendItem::Create(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize)
 {
 	const int messageSize = LES_NetworkMessageSize(payloadSize);
 	m_messageSize = messageSize;
 	m_message = LES_CreateNetworkMessage(type, id, payloadSize, messageSize);
+	m_ownsMessage = true;
+}
+
+void LES_NetworkSendItem::CreateInPlace(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, 
+																				LES_NetworkMessage* const message)
+{
+	m_messageSize = LES_NetworkMessageSize(payloadSize);
+	m_message = message;
+	m_ownsMessage = false;
+	LES_SetNetworkMessageHeader(m_message, type, id, payloadSize);
+}
+
+void LES_NetworkSendItem::CreateFromMessage(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, 
+																						LES_NetworkMessage* const message)
+{
+	CreateInPlace(type, id, payloadSize, message);
+	m_ownsMessage = true;
 }
 
 void LES_NetworkSendItem::Create(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, void* const payload)
@@ -53,10 +76,22 @@ void LES_NetworkSendItem::Create(const LES_uint16 type, const LES_uint16 id, con
 	memcpy(m_message->m_payload, payload, payloadSize);
 }
 
+void LES_NetworkSendItem::SetReferences(const LES_NetworkSendReference* const references, const int numReferences)
+{
+	m_references = references;
+	m_numReferences = numReferences;
+}
+
 void LES_NetworkSendItem::Free(void)
 {
-	free(m_message);
+	if (m_ownsMessage)
+	{
+		free(m_message);
+	}
 	m_message = LES_NULL;
 	m_messageSize = 0;
+	m_ownsMessage = false;
+	m_references = LES_NULL;
+	m_numReferences = 0;
 }
 
@@ -5,6 +5,17 @@
 
 struct LES_NetworkMessage;
 
+/* 
+ * Caller memory sent in the middle of a message without being copied into it : writev'ed by the network thread
+ * m_offset is where the data goes in the message memory : the message memory doesn't have a gap for it
+*/
+struct LES_NetworkSendReference
+{
+	int m_offset;
+	int m_size;
+	const char* m_data;
+};
+
 class LES_NetworkSendItem
 {
 public:
@@ -12,11 +23,17 @@ public:
 	{
 		m_message = LES_NULL;
 		m_messageSize = 0;
+		m_ownsMessage = false;
+		m_references = LES_NULL;
+		m_numReferences = 0;
 	}
 	~LES_NetworkSendItem()
 	{
 		m_message = LES_NULL;
 		m_messageSize = 0;
+		m_ownsMessage = false;
+		m_references = LES_NULL;
+		m_numReferences = 0;
 	}
 
 	LES_NetworkMessage* GetMessagePtr(void) const
@@ -27,16 +44,33 @@ public:
 	{
 		return m_messageSize;
 	}
+	const LES_NetworkSendReference* GetReferences(void) const
+	{
+		return m_references;
+	}
+	int GetNumReferences(void) const
+	{
+		return m_numReferences;
+	}
 	LES_NetworkSendItem& operator = (const LES_NetworkSendItem& other)
 	{
 		m_message = other.m_message;
 		m_messageSize = other.m_messageSize;
+		m_ownsMessage = other.m_ownsMessage;
+		m_references = other.m_references;
+		m_numReferences = other.m_numReferences;
 
 		return *this;
 	}
 
 	void Create(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, void* const payload);
 	void Create(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize);
+	/* Wrap an existing message buffer of at least LES_NetworkMessageSize(payloadSize) bytes : Free() won't free it */
+	void CreateInPlace(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, LES_NetworkMessage* const message);
+	/* Take ownership of a malloc'ed message buffer of at least LES_NetworkMessageSize(payloadSize) bytes : Free() frees it */
+	void CreateFromMessage(const LES_uint16 type, const LES_uint16 id, const LES_uint32 payloadSize, LES_NetworkMessage* const message);
+	/* The payload size includes the referenced bytes : the references must stay valid until the item has been sent */
+	void SetReferences(const LES_NetworkSendReference* const references, const int numReferences);
 	void Free(void);
 
 private:
@@ -44,6 +78,9 @@ private:
 
 	LES_NetworkMessage* m_message;
 	int m_messageSize;
+	bool m_ownsMessage;
+	const LES_NetworkSendReference* m_references;
+	int m_numReferences;
 };
 
 #endif // #ifndef LES_NETWORKSENDITEM_HH
@@ -1,4 +1,5 @@
 #include <memory.h>
+#include <string.h>
 
 #include "les_parameter.h"
 #include "les_core.h"
@@ -6,28 +7,105 @@
 #include "les_type.h"
 #include "les_stringentry.h"
 #include "les_struct.h"
+#include "les_parameterplan.h"
+#include "les_endianswap.h"
+#include "les_varint.h"
 
 #define LES_PARAMETER_DEBUG 0
 
+static bool les_parameterDataNativeEndian = false;
+static bool les_parameterDataVarint = false;
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Public External functions
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-LES_FunctionParameterData::LES_FunctionParameterData(char* const bufferPtr) : m_bufferPtr(bufferPtr)
+void LES_SetParameterDataNativeEndian(const bool nativeEndian)
+{
+	les_parameterDataNativeEndian = nativeEndian;
+}
+
+bool LES_IsParameterDataNativeEndian(void)
+{
+	return les_parameterDataNativeEndian;
+}
+
+void LES_SetParameterDataVarint(const bool varint)
+{
+	les_parameterDataVarint = varint;
+}
+
+bool LES_IsParameterDataVarint(void)
+{
+	return les_parameterDataVarint;
+}
+
+/* The biggest varint is 3 bytes for a 2 byte integer : 4 & 8 byte integers grow less */
+int LES_GetMaxParameterDataSize(const int parameterDataSize)
+{
+	return les_parameterDataVarint ? (parameterDataSize + (parameterDataSize / 2)) : parameterDataSize;
+}
+
+/* The type flag which means a struct can be copied as one block in the current parameter data byte order */
+/* TRIVIAL structs have no endian swapped members so no integers to write as varints */
+static unsigned int LES_GetTrivialStructFlag(void)
+{
+	if (les_parameterDataVarint)
+	{
+		return LES_TYPE_TRIVIAL;
+	}
+	return les_parameterDataNativeEndian ? LES_TYPE_TRIVIAL_NATIVE : LES_TYPE_TRIVIAL;
+}
+
+LES_FunctionParameterData::LES_FunctionParameterData(char* const messagePtr) : 
+	m_messagePtr(messagePtr), m_bufferPtr(messagePtr + LES_FUNCTIONPARAMETERDATA_MESSAGE_HEADER_SIZE)
 {
 	m_currentWriteBufferPtr = m_bufferPtr;
 	m_currentReadBufferPtr = m_bufferPtr;
+	m_numReferences = 0;
+	m_numReferencedBytes = 0;
+	m_poolNext = LES_NULL;
+	m_poolSizeClass = -1;
+	m_poolRefCount = 0;
+	m_poolEpoch = -1;
 }
 
 LES_FunctionParameterData::~LES_FunctionParameterData()
 {
-	delete[] m_bufferPtr;
+	delete[] m_messagePtr;
 	m_currentWriteBufferPtr = LES_NULL;
 	m_currentReadBufferPtr = LES_NULL;
 }
 
+void LES_FunctionParameterData::Reset(void)
+{
+	m_currentWriteBufferPtr = m_bufferPtr;
+	m_currentReadBufferPtr = m_bufferPtr;
+	m_numReferences = 0;
+	m_numReferencedBytes = 0;
+}
+
+/* Copy the referenced memory into the buffer : the written data after each reference moves up to make room for it */
+void LES_FunctionParameterData::ResolveReferences(void)
+{
+	int shift = m_numReferencedBytes;
+	char* endPtr = m_currentWriteBufferPtr;
+	for (int i = m_numReferences - 1; i >= 0; i--)
+	{
+		const LES_NetworkSendReference* const reference = &m_references[i];
+		char* const referencePtr = m_messagePtr + reference->m_offset;
+		memmove(referencePtr + shift, referencePtr, (size_t)(endPtr - referencePtr));
+		shift -= reference->m_size;
+		memcpy(referencePtr + shift, reference->m_data, (size_t)reference->m_size);
+		endPtr = referencePtr;
+	}
+	m_currentWriteBufferPtr += m_numReferencedBytes;
+	m_numReferences = 0;
+	m_numReferencedBytes = 0;
+}
+
 int LES_FunctionParameterData::Read(const LES_StringEntry* const typeStringEntry, void* const parameterDataPtr ) const
 {
 	const LES_TypeEntry* const typeEntryPtr = LES_GetTypeEntry(typeStringEntry);
@@ -43,7 +121,7 @@ int LES_FunctionParameterData::Read(const LES_StringEntry* const typeStringEntry
 								typeStringEntry->m_str, typeEntryPtr->m_aliasedTypeID);
 		return LES_RETURN_ERROR;
 	}
-	const LES_TypeEntry* const aliasedTypeEntryPtr = LES_GetTypeEntry(aliasedStringEntryPtr);
+	const LES_TypeEntry* const aliasedTypeEntryPtr = LES_GetTypeEntryForStringID(typeEntryPtr->m_aliasedTypeID);
 	if (aliasedTypeEntryPtr == LES_NULL)
 	{
 		LES_WARNING("LES_FunctionParameterData::Read type:'%s' aliased type:'%s' not found", 
@@ -55,6 +133,10 @@ int LES_FunctionParameterData::Read(const LES_StringEntry* const typeStringEntry
 		LES_WARNING("LES_FunctionParameterData::Read type:'%s' parameterDataPtr is NULL", typeStringEntry->m_str);
 		return LES_RETURN_ERROR;
 	}
+	if (typeEntryPtr->m_flags & LES_TYPE_VARIABLE_SIZE)
+	{
+		return ReadVariableSize(typeStringEntry, typeEntryPtr, parameterDataPtr);
+	}
 
 	const void* valueAddress = parameterDataPtr;
 	unsigned int flags = typeEntryPtr->m_flags;
@@ -70,40 +152,104 @@ int LES_FunctionParameterData::Read(const LES_StringEntry* const typeStringEntry
 		return LES_RETURN_ERROR;
 	}
 
-	if ((flags & LES_TYPE_POD) || (flags & LES_TYPE_STRUCT))
-	{
 #if LES_PARAMETER_DEBUG
-		LES_LOG("Read type:'%s' size:%d %p -> %p", typeStringEntry->m_str, typeEntryPtr->m_dataSize, m_currentReadBufferPtr, parameterDataPtr);
+	LES_LOG("Read type:'%s' size:%d %p -> %p", typeStringEntry->m_str, typeEntryPtr->m_dataSize, m_currentReadBufferPtr, parameterDataPtr);
 #endif // #if LES_PARAMETER_DEBUG
-		if (flags & LES_TYPE_ENDIANSWAP)
+	if (ReadValue(parameterDataPtr, (int)parameterDataSize, flags) != LES_RETURN_OK)
+	{
+		LES_WARNING("LES_FunctionParameterData::Read type:'%s' truncated or invalid value", typeStringEntry->m_str);
+		return LES_RETURN_ERROR;
+	}
+	return LES_RETURN_OK;
+}
+
+/* A single POD or struct value of dataSize bytes with the type flags already resolved : other types don't have any data */
+int LES_FunctionParameterData::ReadValue(void* const valuePtr, const int dataSize, const unsigned int typeFlags) const
+{
+	if (((typeFlags & LES_TYPE_POD) == 0) && ((typeFlags & LES_TYPE_STRUCT) == 0))
+	{
+		return LES_RETURN_OK;
+	}
+	const int numBytesToRead = GetNumBytesToRead();
+	if ((typeFlags & LES_TYPE_INTEGER) && les_parameterDataVarint)
+	{
+		const int maxNumBytesToRead = (numBytesToRead < LES_VARINT_MAX_SIZE(dataSize)) ? numBytesToRead : LES_VARINT_MAX_SIZE(dataSize);
+		const int numBytesRead = LES_ReadVarint((char*)valuePtr, dataSize, m_currentReadBufferPtr, maxNumBytesToRead);
+		if (numBytesRead < 0)
 		{
-			if (parameterDataSize == 2)
-			{
-				fromBigEndian16((char* const)parameterDataPtr, m_currentReadBufferPtr);
-			}
-			else if (parameterDataSize == 4)
-			{
-				fromBigEndian32((char* const)parameterDataPtr, m_currentReadBufferPtr);
-			}
-			else if (parameterDataSize == 8)
-			{
-				fromBigEndian64((char* const)parameterDataPtr, m_currentReadBufferPtr);
-			}
-			else
-			{
-				LES_FATAL_ERROR("Read type:'%s' marked for ENDIANSWAP but unknown size to swap:%d", typeStringEntry->m_str, parameterDataSize);
-			}
+			return LES_RETURN_ERROR;
+		}
+		m_currentReadBufferPtr += numBytesRead;
+		return LES_RETURN_OK;
+	}
+	if (dataSize > numBytesToRead)
+	{
+		return LES_RETURN_ERROR;
+	}
+	if ((typeFlags & LES_TYPE_ENDIANSWAP) && (les_parameterDataNativeEndian == false))
+	{
+		if (dataSize == 2)
+		{
+			fromBigEndian16((char*)valuePtr, m_currentReadBufferPtr);
+		}
+		else if (dataSize == 4)
+		{
+			fromBigEndian32((char*)valuePtr, m_currentReadBufferPtr);
+		}
+		else if (dataSize == 8)
+		{
+			fromBigEndian64((char*)valuePtr, m_currentReadBufferPtr);
 		}
 		else
 		{
-			memcpy(parameterDataPtr, m_currentReadBufferPtr, parameterDataSize);
+			LES_FATAL_ERROR("ReadValue marked for ENDIANSWAP but unknown size to swap:%d", dataSize);
 		}
-		m_currentReadBufferPtr += parameterDataSize;
 	}
+	else
+	{
+		memcpy(valuePtr, m_currentReadBufferPtr, (size_t)dataSize);
+	}
+	m_currentReadBufferPtr += dataSize;
+	return LES_RETURN_OK;
+}
 
+/* Returns the data in place and skips over it : the bytes aren't converted, LES_NULL if the data is truncated */
+const char* LES_FunctionParameterData::ReadBytes(const int numBytes) const
+{
+	if ((numBytes < 0) || (numBytes > GetNumBytesToRead()))
+	{
+		return LES_NULL;
+	}
+	const char* const dataPtr = m_currentReadBufferPtr;
+	m_currentReadBufferPtr += numBytes;
+	return dataPtr;
+}
+
+/* The count at the start of a variable sized type */
+int LES_FunctionParameterData::ReadCount(LES_uint32* const pCount) const
+{
+	if (GetNumBytesToRead() < LES_TYPE_COUNT_SIZE)
+	{
+		LES_WARNING("LES_FunctionParameterData::ReadCount truncated numBytesToRead:%d", GetNumBytesToRead());
+		return LES_RETURN_ERROR;
+	}
+	if (les_parameterDataNativeEndian)
+	{
+		memcpy(pCount, m_currentReadBufferPtr, LES_TYPE_COUNT_SIZE);
+	}
+	else
+	{
+		fromBigEndian32((char*)pCount, m_currentReadBufferPtr);
+	}
+	m_currentReadBufferPtr += LES_TYPE_COUNT_SIZE;
 	return LES_RETURN_OK;
 }
 
+int LES_FunctionParameterData::GetNumBytesToRead(void) const
+{
+	return (int)(m_currentWriteBufferPtr - m_currentReadBufferPtr);
+}
+
 int LES_FunctionParameterData::Write(const LES_StringEntry* const typeStringEntry, 
 																 		 const void* const parameterDataPtr, const unsigned int paramMode)
 {
@@ -136,12 +282,118 @@ int LES_FunctionParameterData::Write(const LES_StringEntry* const typeStringEntr
 	return WriteInternal(typeStringEntry, typeEntryPtr, valueAddress);
 }
 
+/* Executes a parameter plan from LES_CreateFunctionPlan : no type lookups */
+int LES_FunctionParameterData::WritePlan(const LES_ParameterPlanOp* const ops, const int numOps, const void* const parameterDataPtr)
+{
+	const char* baseStack[LES_PLAN_MAX_DEPTH];
+	int depth = 0;
+	const char* base = (const char*)parameterDataPtr;
+	char* writeBufferPtr = m_currentWriteBufferPtr;
+	/* Native endian swaps are copies : m_size is the number of bytes for both */
+	const int lastSwapOpcode = les_parameterDataNativeEndian ? LES_PLAN_OP_SWAP64 : LES_PLAN_OP_COPY;
+	for (int i = 0; i < numOps; i++)
+	{
+		const LES_ParameterPlanOp* const op = &ops[i];
+		const char* const valueAddress = base + op->m_offset;
+		int opcode = op->m_opcode;
+		if ((opcode >= LES_PLAN_OP_INT16) && (les_parameterDataVarint == false))
+		{
+			opcode += (LES_PLAN_OP_SWAP16 - LES_PLAN_OP_INT16);
+		}
+		opcode = (opcode <= lastSwapOpcode) ? LES_PLAN_OP_COPY : opcode;
+		switch (opcode)
+		{
+			case LES_PLAN_OP_COPY:
+				writeBufferPtr = WriteBlock(writeBufferPtr, valueAddress, op->m_size);
+				break;
+			case LES_PLAN_OP_SWAP16:
+				if (op->m_size == 2)
+				{
+					toBigEndian16(writeBufferPtr, valueAddress);
+				}
+				else
+				{
+					toBigEndianArray16(writeBufferPtr, valueAddress, op->m_size / 2);
+				}
+				writeBufferPtr += op->m_size;
+				break;
+			case LES_PLAN_OP_SWAP32:
+				if (op->m_size == 4)
+				{
+					toBigEndian32(writeBufferPtr, valueAddress);
+				}
+				else
+				{
+					toBigEndianArray32(writeBufferPtr, valueAddress, op->m_size / 4);
+				}
+				writeBufferPtr += op->m_size;
+				break;
+			case LES_PLAN_OP_SWAP64:
+				if (op->m_size == 8)
+				{
+					toBigEndian64(writeBufferPtr, valueAddress);
+				}
+				else
+				{
+					toBigEndianArray64(writeBufferPtr, valueAddress, op->m_size / 8);
+				}
+				writeBufferPtr += op->m_size;
+				break;
+			case LES_PLAN_OP_INT16:
+			case LES_PLAN_OP_INT32:
+			case LES_PLAN_OP_INT64:
+			{
+				const int numBytes = 2 << (opcode - LES_PLAN_OP_INT16);
+				for (int offset = 0; offset < op->m_size; offset += numBytes)
+				{
+					writeBufferPtr += LES_WriteVarint(writeBufferPtr, valueAddress + offset, numBytes);
+				}
+				break;
+			}
+			case LES_PLAN_OP_DEREF:
+				baseStack[depth] = base;
+				depth++;
+				base = *(const char* const*)valueAddress;
+				if (base == LES_NULL)
+				{
+					m_currentWriteBufferPtr = writeBufferPtr;
+					LES_WARNING("LES_FunctionParameterData::WritePlan op:%d pointer is NULL", i);
+					return LES_RETURN_ERROR;
+				}
+				break;
+			case LES_PLAN_OP_POP:
+				depth--;
+				base = baseStack[depth];
+				break;
+			default:
+				m_currentWriteBufferPtr = writeBufferPtr;
+				LES_FATAL_ERROR("LES_FunctionParameterData::WritePlan op:%d unknown opcode:%d", i, op->m_opcode);
+				return LES_RETURN_ERROR;
+		}
+	}
+	m_currentWriteBufferPtr = writeBufferPtr;
+	return LES_RETURN_OK;
+}
+
+/* Executes a generated parameter stub from les_parameterstubdata.cpp : straight-line version of WritePlan */
+int LES_FunctionParameterData::WriteStub(LES_ParameterStubFunction* const stub, const void* const parameterDataPtr)
+{
+	const int numBytesWritten = stub(m_currentWriteBufferPtr, parameterDataPtr);
+	if (numBytesWritten < 0)
+	{
+		LES_WARNING("LES_FunctionParameterData::WriteStub pointer is NULL");
+		return LES_RETURN_ERROR;
+	}
+	m_currentWriteBufferPtr += numBytesWritten;
+	return LES_RETURN_OK;
+}
+
 int LES_FunctionParameterData::GetNumBytesWritten(void) const
 {
 	unsigned int start = (unsigned int)m_bufferPtr;
 	unsigned int current = (unsigned int)m_currentWriteBufferPtr;
 	unsigned int numBytesWritten = current - start;
-	return numBytesWritten;
+	return numBytesWritten + m_numReferencedBytes;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +417,10 @@ int LES_FunctionParameterData::WriteInternal(const LES_StringEntry* const typeSt
 	}
 
 	unsigned int inputTypeFlags = inputTypeEntryPtr->m_flags;
+	if (inputTypeFlags & LES_TYPE_VARIABLE_SIZE)
+	{
+		return WriteVariableSize(typeStringEntry, inputTypeEntryPtr, parameterDataPtr);
+	}
 	if ((inputTypeFlags & LES_TYPE_ARRAY) == 0)
 	{
 		return WriteItem(typeStringEntry, inputTypeEntryPtr, parameterDataPtr);
@@ -172,16 +428,9 @@ int LES_FunctionParameterData::WriteInternal(const LES_StringEntry* const typeSt
 
 	// Loop over the elements of the array writing each item 1 by 1
 	const int numElements = inputTypeEntryPtr->m_numElements;
-	const LES_TypeEntry* typeEntryPtr = inputTypeEntryPtr;
-
-	typeEntryPtr = typeEntryPtr->GetRootType();
-
-	unsigned int parameterDataSize = inputTypeEntryPtr->m_dataSize;
-	parameterDataSize = typeEntryPtr->m_dataSize;
 
 	const LES_StringEntry* const itemTypeStringEntry = typeStringEntry;
 	const LES_TypeEntry* const itemTypeEntryPtr = inputTypeEntryPtr;
-	//const unsigned int parameterDataSize = itemTypeEntryPtr->m_dataSize; 
 	const void** pointerAddress = (const void**)parameterDataPtr;
 	const void* paramDataPtr = parameterDataPtr;
 	if ((inputTypeFlags & LES_TYPE_REFERENCE) == 0)
@@ -189,7 +438,63 @@ int LES_FunctionParameterData::WriteInternal(const LES_StringEntry* const typeSt
 		pointerAddress = (const void**)parameterDataPtr;
 		paramDataPtr = *pointerAddress;
 	}
-	const char* itemParameterDataPtr = (const char*)paramDataPtr;
+	const char* const itemParameterDataPtr = (const char*)paramDataPtr;
+	return WriteElements(itemTypeStringEntry, itemTypeEntryPtr, itemParameterDataPtr, numElements);
+}
+
+/* Writes numElements items of the root type of inputTypeEntryPtr stored contiguously at elementsPtr */
+int LES_FunctionParameterData::WriteElements(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const inputTypeEntryPtr, 
+																						 const char* const elementsPtr, const int numElements)
+{
+	const LES_TypeEntry* const typeEntryPtr = inputTypeEntryPtr->GetRootType();
+	const unsigned int parameterDataSize = typeEntryPtr->m_dataSize;
+
+	const LES_StringEntry* const itemTypeStringEntry = typeStringEntry;
+	const LES_TypeEntry* const itemTypeEntryPtr = inputTypeEntryPtr;
+	const char* itemParameterDataPtr = elementsPtr;
+
+	/* Arrays of endian swapped PODs (not varints) are converted in one go : anything else goes through WriteItem which reports errors */
+	const unsigned int rootTypeFlags = typeEntryPtr->m_flags;
+	if (itemParameterDataPtr && (rootTypeFlags & LES_TYPE_STRUCT) && (typeEntryPtr->GetTrivialFlags() & LES_GetTrivialStructFlag()))
+	{
+		m_currentWriteBufferPtr = WriteBlock(m_currentWriteBufferPtr, itemParameterDataPtr, numElements * parameterDataSize);
+		return LES_RETURN_OK;
+	}
+	/* PODs which aren't endian swapped are the same in every byte order */
+	if (itemParameterDataPtr && (rootTypeFlags & LES_TYPE_POD) && 
+			((rootTypeFlags & (LES_TYPE_ENDIANSWAP | LES_TYPE_STRUCT | LES_TYPE_INTEGER)) == 0))
+	{
+		m_currentWriteBufferPtr = WriteBlock(m_currentWriteBufferPtr, itemParameterDataPtr, numElements * parameterDataSize);
+		return LES_RETURN_OK;
+	}
+	if (itemParameterDataPtr && (rootTypeFlags & LES_TYPE_POD) && (rootTypeFlags & LES_TYPE_ENDIANSWAP) && 
+			((rootTypeFlags & LES_TYPE_STRUCT) == 0) && 
+			(((rootTypeFlags & LES_TYPE_INTEGER) == 0) || (les_parameterDataVarint == false)))
+	{
+		if (les_parameterDataNativeEndian)
+		{
+			m_currentWriteBufferPtr = WriteBlock(m_currentWriteBufferPtr, itemParameterDataPtr, numElements * parameterDataSize);
+			return LES_RETURN_OK;
+		}
+		else if (parameterDataSize == 2)
+		{
+			toBigEndianArray16(m_currentWriteBufferPtr, itemParameterDataPtr, numElements);
+			m_currentWriteBufferPtr += numElements * 2;
+			return LES_RETURN_OK;
+		}
+		else if (parameterDataSize == 4)
+		{
+			toBigEndianArray32(m_currentWriteBufferPtr, itemParameterDataPtr, numElements);
+			m_currentWriteBufferPtr += numElements * 4;
+			return LES_RETURN_OK;
+		}
+		else if (parameterDataSize == 8)
+		{
+			toBigEndianArray64(m_currentWriteBufferPtr, itemParameterDataPtr, numElements);
+			m_currentWriteBufferPtr += numElements * 8;
+			return LES_RETURN_OK;
+		}
+	}
 	for (int element = 0; element < numElements; element++)
 	{
 		const void* const voidParameterDataPtr = (const void*)itemParameterDataPtr;
@@ -207,6 +512,142 @@ int LES_FunctionParameterData::WriteInternal(const LES_StringEntry* const typeSt
 	return LES_RETURN_OK;
 }
 
+/* The count then the items : strings are written without the terminator */
+int LES_FunctionParameterData::WriteVariableSize(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const inputTypeEntryPtr, 
+																								 const void* const parameterDataPtr)
+{
+	const unsigned int inputTypeFlags = inputTypeEntryPtr->m_flags;
+	const int maxNumElements = inputTypeEntryPtr->m_numElements;
+	const char* elementsPtr = LES_NULL;
+	int numElements = 0;
+	if (inputTypeFlags & LES_TYPE_STRING)
+	{
+		elementsPtr = *(const LES_String*)parameterDataPtr;
+		if (elementsPtr == LES_NULL)
+		{
+			LES_WARNING("LES_FunctionParameterData::WriteVariableSize type:'%s' string is NULL", typeStringEntry->m_str);
+			return LES_RETURN_ERROR;
+		}
+		numElements = (int)strlen(elementsPtr);
+	}
+	else
+	{
+		const LES_DynamicArray<const char>* const dynamicArray = (const LES_DynamicArray<const char>*)parameterDataPtr;
+		elementsPtr = dynamicArray->m_data;
+		numElements = dynamicArray->m_numElements;
+		if ((elementsPtr == LES_NULL) && (numElements > 0))
+		{
+			LES_WARNING("LES_FunctionParameterData::WriteVariableSize type:'%s' data is NULL numElements:%d", 
+									typeStringEntry->m_str, numElements);
+			return LES_RETURN_ERROR;
+		}
+	}
+	if ((numElements < 0) || (numElements > maxNumElements))
+	{
+		LES_WARNING("LES_FunctionParameterData::WriteVariableSize type:'%s' invalid numElements:%d max:%d", 
+								typeStringEntry->m_str, numElements, maxNumElements);
+		return LES_RETURN_ERROR;
+	}
+
+	const LES_uint32 count = (LES_uint32)numElements;
+	if (les_parameterDataNativeEndian)
+	{
+		memcpy(m_currentWriteBufferPtr, &count, LES_TYPE_COUNT_SIZE);
+	}
+	else
+	{
+		toBigEndian32(m_currentWriteBufferPtr, (const char*)&count);
+	}
+	m_currentWriteBufferPtr += LES_TYPE_COUNT_SIZE;
+
+	if (inputTypeFlags & LES_TYPE_STRING)
+	{
+		m_currentWriteBufferPtr = WriteBlock(m_currentWriteBufferPtr, elementsPtr, (int)count);
+		return LES_RETURN_OK;
+	}
+	return WriteElements(typeStringEntry, inputTypeEntryPtr, elementsPtr, numElements);
+}
+
+/* Returns the write pointer after the block : large blocks are recorded as a reference and take no space in the buffer */
+char* LES_FunctionParameterData::WriteBlock(char* const writeBufferPtr, const char* const blockPtr, const int blockSize)
+{
+	if ((blockSize >= LES_PARAMETER_REFERENCE_MIN_SIZE) && (m_numReferences < LES_PARAMETER_MAX_NUM_REFERENCES))
+	{
+		LES_NetworkSendReference* const reference = &m_references[m_numReferences];
+		reference->m_offset = (int)(writeBufferPtr - m_messagePtr);
+		reference->m_size = blockSize;
+		reference->m_data = blockPtr;
+		m_numReferences++;
+		m_numReferencedBytes += blockSize;
+		return writeBufferPtr;
+	}
+	memcpy(writeBufferPtr, blockPtr, (size_t)blockSize);
+	return writeBufferPtr + blockSize;
+}
+
+/* Strings are read into a char buffer of the maximum length + 1 and NUL terminated */
+/* Dynamic arrays are read into the LES_DynamicArray m_data buffer which must hold the maximum number of elements */
+int LES_FunctionParameterData::ReadVariableSize(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const typeEntryPtr, 
+																								void* const parameterDataPtr) const
+{
+	const int maxNumElements = typeEntryPtr->m_numElements;
+	LES_uint32 count = 0;
+	if (ReadCount(&count) != LES_RETURN_OK)
+	{
+		return LES_RETURN_ERROR;
+	}
+	if (count > (LES_uint32)maxNumElements)
+	{
+		LES_WARNING("LES_FunctionParameterData::ReadVariableSize type:'%s' invalid count:%u max:%d", 
+								typeStringEntry->m_str, count, maxNumElements);
+		return LES_RETURN_ERROR;
+	}
+	if (typeEntryPtr->m_flags & LES_TYPE_STRING)
+	{
+		const char* const strData = ReadBytes((int)count);
+		if (strData == LES_NULL)
+		{
+			LES_WARNING("LES_FunctionParameterData::ReadVariableSize type:'%s' truncated count:%u numBytesToRead:%d", 
+									typeStringEntry->m_str, count, GetNumBytesToRead());
+			return LES_RETURN_ERROR;
+		}
+		char* const str = (char*)parameterDataPtr;
+		memcpy(str, strData, count);
+		str[count] = '\0';
+		return LES_RETURN_OK;
+	}
+
+	LES_DynamicArray<char>* const dynamicArray = (LES_DynamicArray<char>*)parameterDataPtr;
+	if ((dynamicArray->m_data == LES_NULL) && (count > 0))
+	{
+		LES_WARNING("LES_FunctionParameterData::ReadVariableSize type:'%s' data is NULL", typeStringEntry->m_str);
+		return LES_RETURN_ERROR;
+	}
+	/* The element type is resolved once : it can't be a pointer, reference, array or variable sized */
+	const LES_TypeEntry* const elementTypeEntryPtr = LES_GetTypeEntryForStringID(typeEntryPtr->m_aliasedTypeID);
+	const LES_TypeEntry* const rootTypeEntryPtr = typeEntryPtr->GetRootType();
+	if ((elementTypeEntryPtr == LES_NULL) || (rootTypeEntryPtr == LES_NULL))
+	{
+		LES_WARNING("LES_FunctionParameterData::ReadVariableSize type:'%s' element type:%d not found", 
+								typeStringEntry->m_str, typeEntryPtr->m_aliasedTypeID);
+		return LES_RETURN_ERROR;
+	}
+	const int elementSize = (int)rootTypeEntryPtr->m_dataSize;
+	const int elementDataSize = (int)elementTypeEntryPtr->m_dataSize;
+	const unsigned int elementFlags = elementTypeEntryPtr->m_flags;
+	for (int i = 0; i < (int)count; i++)
+	{
+		if (ReadValue(dynamicArray->m_data + (i * elementSize), elementDataSize, elementFlags) != LES_RETURN_OK)
+		{
+			LES_WARNING("LES_FunctionParameterData::ReadVariableSize type:'%s' element:%d truncated or invalid value", 
+									typeStringEntry->m_str, i);
+			return LES_RETURN_ERROR;
+		}
+	}
+	dynamicArray->m_numElements = (LES_int32)count;
+	return LES_RETURN_OK;
+}
+
 int LES_FunctionParameterData::WriteItem(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const inputTypeEntryPtr, 
 																				 const void* const parameterDataPtr)
 {
@@ -246,8 +687,14 @@ int LES_FunctionParameterData::WriteItem(const LES_StringEntry* const typeString
 #if LES_PARAMETER_DEBUG
 		LES_LOG("Write type:'%s' size:%d hash:0x%X STRUCT", typeStringEntry->m_str, typeDataSize, typeEntryPtr->m_hash);
 #endif // #if LES_PARAMETER_DEBUG
+		/* The memory layout is the wire layout : no need to walk the members */
+		if (typeEntryPtr->GetTrivialFlags() & LES_GetTrivialStructFlag())
+		{
+			m_currentWriteBufferPtr = WriteBlock(m_currentWriteBufferPtr, (const char*)valueAddress, (int)parameterDataSize);
+			return LES_RETURN_OK;
+		}
 		int returnCode = LES_RETURN_OK;
-		const LES_StructDefinition* const structDefinition = LES_GetStructDefinition(typeEntryPtr->m_hash);
+		const LES_StructDefinition* const structDefinition = typeEntryPtr->GetStructDefinition();
 		if (structDefinition == LES_NULL)
 		{
 			LES_WARNING("Write type:'%s' is a struct but can't be found", typeStringEntry->m_str);
@@ -260,7 +707,7 @@ int LES_FunctionParameterData::WriteItem(const LES_StringEntry* const typeString
 			const LES_StructMember* const structMember = structDefinition->GetMemberByIndex(i);
 			const int memberTypeID = structMember->m_typeID;
 			const LES_StringEntry* const memberTypeStringEntry = LES_GetStringEntryForID(memberTypeID);
-			const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntry(memberTypeStringEntry);
+			const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntryForStringID(memberTypeID);
 			const int memberAlignmentPadding = structMember->m_alignmentPadding;
 			memberDataPtr += memberAlignmentPadding;
 			//struct members which are references are really pointers to the data
@@ -311,7 +758,12 @@ int LES_FunctionParameterData::WriteItem(const LES_StringEntry* const typeString
 #if LES_PARAMETER_DEBUG
 		LES_LOG("Write type:'%s' size:%d %p -> %p", typeStringEntry->m_str, typeEntryPtr->m_dataSize, valueAddress, m_currentWriteBufferPtr);
 #endif // #if LES_PARAMETER_DEBUG
-		if (typeFlags & LES_TYPE_ENDIANSWAP)
+		if ((typeFlags & LES_TYPE_INTEGER) && les_parameterDataVarint)
+		{
+			m_currentWriteBufferPtr += LES_WriteVarint(m_currentWriteBufferPtr, (const char*)valueAddress, (int)parameterDataSize);
+			return LES_RETURN_OK;
+		}
+		if ((typeFlags & LES_TYPE_ENDIANSWAP) && (les_parameterDataNativeEndian == false))
 		{
 			if (parameterDataSize == 2)
 			{
@@ -3,9 +3,48 @@
 
 #include "les_base.h"
 #include "les_hash.h"
+#include "les_parameterstub.h"
+#include "les_networksenditem.h"
 
 struct LES_StringEntry;
 struct LES_TypeEntry;
+struct LES_ParameterPlanOp;
+
+/*
+ * Parameter data is written in place into the outgoing network message : the buffer starts after the
+ * message header (type, id, payloadSize), the function nameID and the correlationID so the RPC can be sent without a copy
+*/
+#define LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE (8)
+#define LES_FUNCTIONPARAMETERDATA_MESSAGE_HEADER_SIZE (8 + LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE)
+#define LES_FUNCTIONPARAMETERDATA_MESSAGE_SIZE(PARAMETER_DATA_SIZE) \
+	(LES_FUNCTIONPARAMETERDATA_MESSAGE_HEADER_SIZE + (((PARAMETER_DATA_SIZE) + 3) & ~3))
+
+/*
+ * Parameter data is big endian on the wire unless native endian was negotiated during the connect handshake
+ * When it is native endian the data is written and read without any endian swaps
+*/
+void LES_SetParameterDataNativeEndian(const bool nativeEndian);
+bool LES_IsParameterDataNativeEndian(void);
+
+/*
+ * Varint parameter data is negotiated during the connect handshake : LES_TYPE_INTEGER values are written as
+ * zig-zag LEB128 varints (see les_varint.h), the other types are unchanged
+ * A varint can be bigger than the integer : LES_GetMaxParameterDataSize is the most a parameter data size can grow to
+*/
+void LES_SetParameterDataVarint(const bool varint);
+bool LES_IsParameterDataVarint(void);
+int LES_GetMaxParameterDataSize(const int parameterDataSize);
+
+/*
+ * Large contiguous regions which don't need converting are recorded as references to the caller memory instead of being copied
+ * They are sent from the caller memory by the network thread : ResolveReferences copies them in for callers which can't keep it valid
+ * The buffer is sized for the whole parameter data so the references always fit if they are copied in
+*/
+#ifndef LES_PARAMETER_REFERENCE_MIN_SIZE
+#define LES_PARAMETER_REFERENCE_MIN_SIZE (4096)
+#endif // #ifndef LES_PARAMETER_REFERENCE_MIN_SIZE
+
+#define LES_PARAMETER_MAX_NUM_REFERENCES (8)
 
 struct LES_FunctionParameter
 {
@@ -19,24 +58,58 @@ struct LES_FunctionParameter
 class LES_FunctionParameterData
 {
 public:
-	LES_FunctionParameterData(char* const bufferPtr);
+	LES_FunctionParameterData(char* const messagePtr);
 	~LES_FunctionParameterData();
 
 	int Write(const LES_StringEntry* const typeStringEntry, const void* const parameterDataPtr, const unsigned int paramMode);
+	int WritePlan(const LES_ParameterPlanOp* const ops, const int numOps, const void* const parameterDataPtr);
+	int WriteStub(LES_ParameterStubFunction* const stub, const void* const parameterDataPtr);
 	int Read(const LES_StringEntry* const typeStringEntry, void* const parameterDataPtr) const;
+	int ReadCount(LES_uint32* const pCount) const;
+	int ReadValue(void* const valuePtr, const int dataSize, const unsigned int typeFlags) const;
+	const char* ReadBytes(const int numBytes) const;
+	/* The bytes written which haven't been read : reads which need more than this fail */
+	int GetNumBytesToRead(void) const;
 
 	int GetNumBytesWritten(void) const;
 	const char* GetBufferPtr(void) const { return m_bufferPtr; }
+	char* GetMessagePtr(void) const { return m_messagePtr; }
+	const LES_NetworkSendReference* GetReferences(void) const { return m_references; }
+	int GetNumReferences(void) const { return m_numReferences; }
+	void ResolveReferences(void);
+	void Reset(void);
+
+	friend LES_FunctionParameterData* LES_ParameterPoolAlloc(const int parameterDataSize);
+	friend void LES_ParameterPoolFree(LES_FunctionParameterData* const parameterData);
+	friend void LES_ParameterPoolAddRef(LES_FunctionParameterData* const parameterData);
+	friend void LES_ParameterPoolShutdown(void);
 private:
 
 	int WriteInternal(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const rawTypeEntryPtr, 
 										const void* const parameterDataPtr);
 	int WriteItem(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const rawTypeEntryPtr, 
 								const void* const parameterDataPtr);
+	int WriteElements(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const rawTypeEntryPtr, 
+										const char* const elementsPtr, const int numElements);
+	int WriteVariableSize(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const rawTypeEntryPtr, 
+												const void* const parameterDataPtr);
+	int ReadVariableSize(const LES_StringEntry* const typeStringEntry, const LES_TypeEntry* const typeEntryPtr, 
+											 void* const parameterDataPtr) const;
+	char* WriteBlock(char* const writeBufferPtr, const char* const blockPtr, const int blockSize);
 
+	char* const m_messagePtr;
 	char* const m_bufferPtr;
 	char* m_currentWriteBufferPtr;
 	mutable char* m_currentReadBufferPtr;
+
+	LES_NetworkSendReference m_references[LES_PARAMETER_MAX_NUM_REFERENCES];
+	int m_numReferences;
+	int m_numReferencedBytes;
+
+	LES_FunctionParameterData* m_poolNext;
+	int m_poolSizeClass;
+	int m_poolRefCount;
+	int m_poolEpoch;
 };
 
 #endif // #ifndef LES_PARAMETER_HH
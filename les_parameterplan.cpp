@@ -0,0 +1,524 @@
+#include <malloc.h>
+#include <string.h>
+
+#include "les_parameterplan.h"
+#include "les_core.h"
+#include "les_logger.h"
+#include "les_type.h"
+#include "les_stringentry.h"
+#include "les_struct.h"
+#include "les_function.h"
+#include "les_endianswap.h"
+#include "les_varint.h"
+
+#define LES_PARAMETERPLAN_DEBUG 0
+
+#define LES_PLAN_MAX_NUM_OPS (4096)
+
+/* LES_ReadPlan relies on the opcode order : native endian turns COPY to SWAP64 into copies, INT ops map onto SWAP ops */
+static_assert((LES_PLAN_OP_COPY == 0) && (LES_PLAN_OP_SWAP16 == 1) && (LES_PLAN_OP_SWAP32 == 2) && (LES_PLAN_OP_SWAP64 == 3), 
+							"LES_PLAN_OP_COPY & the SWAP opcodes must be 0 to 3");
+static_assert((LES_PLAN_OP_DEREF > LES_PLAN_OP_SWAP64) && (LES_PLAN_OP_POP > LES_PLAN_OP_SWAP64), 
+							"LES_PLAN_OP_DEREF & LES_PLAN_OP_POP must be after the SWAP opcodes");
+static_assert((LES_PLAN_OP_INT16 > LES_PLAN_OP_DEREF) && (LES_PLAN_OP_INT16 > LES_PLAN_OP_POP) && 
+							(LES_PLAN_OP_INT32 == LES_PLAN_OP_INT16 + 1) && (LES_PLAN_OP_INT64 == LES_PLAN_OP_INT16 + 2), 
+							"The INT opcodes must be last & in the same order as the SWAP opcodes");
+
+/* Set to 0 to ignore the generated parameter stubs and always execute the plan ops */
+#ifndef LES_PARAMETERPLAN_USE_STUBS
+#define LES_PARAMETERPLAN_USE_STUBS 1
+#endif // #ifndef LES_PARAMETERPLAN_USE_STUBS
+
+struct LES_PlanCompileState
+{
+	LES_ParameterPlanOp* m_ops;
+	int m_numOps;
+	int m_parameterFirstOp;
+	int m_depth;
+};
+
+static int LES_PlanCompileInternal(LES_PlanCompileState* const state, const LES_TypeEntry* const typeEntryPtr,
+																	 const int offset, const bool derefArray);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Internal Static functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int LES_PlanAddOp(LES_PlanCompileState* const state, const int opcode, const int offset, const int size)
+{
+	/* Merge contiguous copies into a single copy and contiguous swaps of the same width into an array swap */
+	const bool canMerge = ((opcode == LES_PLAN_OP_COPY) || (opcode == LES_PLAN_OP_SWAP16) || 
+												 (opcode == LES_PLAN_OP_SWAP32) || (opcode == LES_PLAN_OP_SWAP64) ||
+												 (opcode == LES_PLAN_OP_INT16) || (opcode == LES_PLAN_OP_INT32) || (opcode == LES_PLAN_OP_INT64));
+	if (canMerge && (state->m_numOps > state->m_parameterFirstOp))
+	{
+		LES_ParameterPlanOp* const lastOp = &state->m_ops[state->m_numOps-1];
+		if ((lastOp->m_opcode == opcode) && ((lastOp->m_offset + lastOp->m_size) == offset))
+		{
+			lastOp->m_size += size;
+			return LES_RETURN_OK;
+		}
+	}
+	if (state->m_numOps >= LES_PLAN_MAX_NUM_OPS)
+	{
+#if LES_PARAMETERPLAN_DEBUG
+		LES_LOG("LES_PlanAddOp too many ops max:%d", LES_PLAN_MAX_NUM_OPS);
+#endif // #if LES_PARAMETERPLAN_DEBUG
+		return LES_RETURN_ERROR;
+	}
+	if (opcode == LES_PLAN_OP_DEREF)
+	{
+		if (state->m_depth >= LES_PLAN_MAX_DEPTH)
+		{
+			return LES_RETURN_ERROR;
+		}
+		state->m_depth++;
+	}
+	else if (opcode == LES_PLAN_OP_POP)
+	{
+		state->m_depth--;
+	}
+	LES_ParameterPlanOp* const op = &state->m_ops[state->m_numOps];
+	op->m_opcode = opcode;
+	op->m_offset = offset;
+	op->m_size = size;
+	state->m_numOps++;
+	return LES_RETURN_OK;
+}
+
+/* Mirrors LES_FunctionParameterData::WriteItem */
+static int LES_PlanCompileItem(LES_PlanCompileState* const state, const LES_TypeEntry* const inputTypeEntryPtr, const int offset)
+{
+	const LES_TypeEntry* const typeEntryPtr = inputTypeEntryPtr->GetRootType();
+	if (typeEntryPtr == LES_NULL)
+	{
+		return LES_RETURN_ERROR;
+	}
+	const unsigned int typeFlags = typeEntryPtr->m_flags;
+	const int typeDataSize = (int)typeEntryPtr->m_dataSize;
+
+	/* Only TRIVIAL : the plan ops are big endian and are folded to copies at runtime for native endian data */
+	if ((typeFlags & LES_TYPE_STRUCT) && (typeEntryPtr->GetTrivialFlags() & LES_TYPE_TRIVIAL))
+	{
+		return LES_PlanAddOp(state, LES_PLAN_OP_COPY, offset, typeDataSize);
+	}
+	if (typeFlags & LES_TYPE_STRUCT)
+	{
+		const LES_StructDefinition* const structDefinition = typeEntryPtr->GetStructDefinition();
+		if (structDefinition == LES_NULL)
+		{
+			return LES_RETURN_ERROR;
+		}
+		const int numMembers = structDefinition->GetNumMembers();
+		int memberOffset = offset;
+		for (int i = 0; i < numMembers; i++)
+		{
+			const LES_StructMember* const structMember = structDefinition->GetMemberByIndex(i);
+			const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntryForStringID(structMember->m_typeID);
+			if (memberTypeEntryPtr == LES_NULL)
+			{
+				return LES_RETURN_ERROR;
+			}
+			memberOffset += structMember->m_alignmentPadding;
+
+			const unsigned int memberFlags = memberTypeEntryPtr->m_flags;
+			const bool isArray = (memberFlags & LES_TYPE_ARRAY);
+			const bool isPointer = (memberFlags & LES_TYPE_POINTER);
+			const bool isReference = (memberFlags & LES_TYPE_REFERENCE);
+			//struct members which are pointers, references or reference arrays are really pointers to the data
+			const bool deferencePtr = ((!isArray && (isPointer || isReference)) || (isArray && isReference));
+			if (deferencePtr)
+			{
+				if (LES_PlanAddOp(state, LES_PLAN_OP_DEREF, memberOffset, 0) != LES_RETURN_OK)
+				{
+					return LES_RETURN_ERROR;
+				}
+				if (LES_PlanCompileInternal(state, memberTypeEntryPtr, 0, true) != LES_RETURN_OK)
+				{
+					return LES_RETURN_ERROR;
+				}
+				if (LES_PlanAddOp(state, LES_PLAN_OP_POP, 0, 0) != LES_RETURN_OK)
+				{
+					return LES_RETURN_ERROR;
+				}
+			}
+			else
+			{
+				// Arrays inside a struct are stored inline : no dereference
+				if (LES_PlanCompileInternal(state, memberTypeEntryPtr, memberOffset, false) != LES_RETURN_OK)
+				{
+					return LES_RETURN_ERROR;
+				}
+			}
+			memberOffset += structMember->m_dataSize;
+		}
+		return LES_RETURN_OK;
+	}
+
+	if (typeFlags & LES_TYPE_POD)
+	{
+		int opcode = LES_PLAN_OP_COPY;
+		if (typeFlags & LES_TYPE_ENDIANSWAP)
+		{
+			if (typeDataSize == 2)
+			{
+				opcode = LES_PLAN_OP_SWAP16;
+			}
+			else if (typeDataSize == 4)
+			{
+				opcode = LES_PLAN_OP_SWAP32;
+			}
+			else if (typeDataSize == 8)
+			{
+				opcode = LES_PLAN_OP_SWAP64;
+			}
+			else
+			{
+				/* Leave the error reporting to the non-plan path */
+				return LES_RETURN_ERROR;
+			}
+			if (typeFlags & LES_TYPE_INTEGER)
+			{
+				opcode += (LES_PLAN_OP_INT16 - LES_PLAN_OP_SWAP16);
+			}
+		}
+		return LES_PlanAddOp(state, opcode, offset, typeDataSize);
+	}
+
+	return LES_RETURN_OK;
+}
+
+/* Mirrors LES_FunctionParameterData::WriteInternal */
+static int LES_PlanCompileInternal(LES_PlanCompileState* const state, const LES_TypeEntry* const inputTypeEntryPtr,
+																	 const int offset, const bool derefArray)
+{
+	const unsigned int inputTypeFlags = inputTypeEntryPtr->m_flags;
+	if (inputTypeFlags & LES_TYPE_VARIABLE_SIZE)
+	{
+		/* Variable sized data : use the non-plan path */
+		return LES_RETURN_ERROR;
+	}
+	if ((inputTypeFlags & LES_TYPE_ARRAY) == 0)
+	{
+		return LES_PlanCompileItem(state, inputTypeEntryPtr, offset);
+	}
+
+	const LES_TypeEntry* const rootTypeEntryPtr = inputTypeEntryPtr->GetRootType();
+	if (rootTypeEntryPtr == LES_NULL)
+	{
+		return LES_RETURN_ERROR;
+	}
+	const int numElements = inputTypeEntryPtr->m_numElements;
+	const int elementSize = (int)rootTypeEntryPtr->m_dataSize;
+
+	const bool dereference = (derefArray && ((inputTypeFlags & LES_TYPE_REFERENCE) == 0));
+	int elementOffset = offset;
+	if (dereference)
+	{
+		if (LES_PlanAddOp(state, LES_PLAN_OP_DEREF, offset, 0) != LES_RETURN_OK)
+		{
+			return LES_RETURN_ERROR;
+		}
+		elementOffset = 0;
+	}
+	for (int element = 0; element < numElements; element++)
+	{
+		if (LES_PlanCompileItem(state, inputTypeEntryPtr, elementOffset) != LES_RETURN_OK)
+		{
+			return LES_RETURN_ERROR;
+		}
+		elementOffset += elementSize;
+	}
+	if (dereference)
+	{
+		if (LES_PlanAddOp(state, LES_PLAN_OP_POP, 0, 0) != LES_RETURN_OK)
+		{
+			return LES_RETURN_ERROR;
+		}
+	}
+	return LES_RETURN_OK;
+}
+
+/* Mirrors LES_FunctionParameterData::Write */
+static int LES_PlanCompileParameter(LES_PlanCompileState* const state, const LES_FunctionParameter* const functionParameterPtr,
+																		LES_ParameterPlanEntry* const parameterPlan)
+{
+	const LES_TypeEntry* const typeEntryPtr = LES_GetTypeEntryForStringID(functionParameterPtr->m_typeID);
+	if (typeEntryPtr == LES_NULL)
+	{
+		return LES_RETURN_ERROR;
+	}
+	const unsigned int typeFlags = typeEntryPtr->m_flags;
+	parameterPlan->m_typeFlags = typeFlags;
+	parameterPlan->m_firstOp = state->m_numOps;
+	state->m_parameterFirstOp = state->m_numOps;
+	state->m_depth = 0;
+	if (typeFlags & LES_TYPE_POINTER)
+	{
+		if (LES_PlanAddOp(state, LES_PLAN_OP_DEREF, 0, 0) != LES_RETURN_OK)
+		{
+			return LES_RETURN_ERROR;
+		}
+	}
+	if (LES_PlanCompileInternal(state, typeEntryPtr, 0, true) != LES_RETURN_OK)
+	{
+		return LES_RETURN_ERROR;
+	}
+	// The executor starts with a fresh base for each parameter : no need for the final POP
+	parameterPlan->m_numOps = state->m_numOps - parameterPlan->m_firstOp;
+	return LES_RETURN_OK;
+}
+
+/* Must match ComputeLayoutHash in les_stubgen.py */
+static LES_Hash LES_ComputePlanLayoutHash(const LES_ParameterPlanOp* const ops, const int numOps)
+{
+	LES_Hash hash = 0;
+	for (int i = 0; i < numOps; i++)
+	{
+		const LES_ParameterPlanOp* const op = &ops[i];
+		hash = (hash * 387U) + (LES_Hash)op->m_opcode;
+		hash = (hash * 387U) + (LES_Hash)op->m_offset;
+		hash = (hash * 387U) + (LES_Hash)op->m_size;
+	}
+	return hash;
+}
+
+/* Bind the generated stub for the parameter : only if it was generated from the same ops */
+static LES_ParameterStubFunction* LES_PlanFindStub(const LES_Hash functionNameHash, const int parameterIndex,
+																									 const LES_ParameterPlanOp* const ops, const int numOps)
+{
+#if LES_PARAMETERPLAN_USE_STUBS
+	const LES_ParameterStub* const parameterStub = LES_FindParameterStub(functionNameHash, parameterIndex);
+	if (parameterStub == LES_NULL)
+	{
+		return LES_NULL;
+	}
+	if (parameterStub->m_layoutHash != LES_ComputePlanLayoutHash(ops, numOps))
+	{
+#if LES_PARAMETERPLAN_DEBUG
+		LES_LOG("LES_PlanFindStub functionNameHash:0x%X parameter[%d] layout doesn't match the generated stub", 
+						functionNameHash, parameterIndex);
+#endif // #if LES_PARAMETERPLAN_DEBUG
+		return LES_NULL;
+	}
+	return parameterStub->m_stub;
+#else // #if LES_PARAMETERPLAN_USE_STUBS
+	(void)functionNameHash;
+	(void)parameterIndex;
+	(void)ops;
+	(void)numOps;
+	return LES_NULL;
+#endif // #if LES_PARAMETERPLAN_USE_STUBS
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+const LES_ParameterPlanEntry* LES_FunctionPlan::GetParameterPlan(const int index) const
+{
+	if ((index < 0) || (index >= m_numParameters))
+	{
+		return LES_NULL;
+	}
+	const LES_ParameterPlanEntry* const parameterPlan = &m_parameters[index];
+	if (parameterPlan->m_valid == 0)
+	{
+		return LES_NULL;
+	}
+	return parameterPlan;
+}
+
+const LES_ParameterPlanOp* LES_FunctionPlan::GetOps(const LES_ParameterPlanEntry* const parameterPlan) const
+{
+	return &m_ops[parameterPlan->m_firstOp];
+}
+
+LES_FunctionPlan* LES_CreateFunctionPlan(const LES_FunctionDefinition* const functionDefinition)
+{
+	if (functionDefinition == LES_NULL)
+	{
+		return LES_NULL;
+	}
+	const int numParameters = functionDefinition->GetNumParameters();
+	if ((numParameters < 0) || (numParameters > LES_MAX_NUM_FUNCTION_PARAMS))
+	{
+		return LES_NULL;
+	}
+
+	const LES_StringEntry* const functionNameStringEntry = LES_GetStringEntryForID(functionDefinition->GetNameID());
+	const LES_Hash functionNameHash = functionNameStringEntry ? functionNameStringEntry->m_hash : 0;
+
+	LES_ParameterPlanEntry parameters[LES_MAX_NUM_FUNCTION_PARAMS];
+	LES_PlanCompileState state;
+	state.m_ops = new LES_ParameterPlanOp[LES_PLAN_MAX_NUM_OPS];
+	state.m_numOps = 0;
+	state.m_parameterFirstOp = 0;
+	state.m_depth = 0;
+
+	for (int p = 0; p < numParameters; p++)
+	{
+		LES_ParameterPlanEntry* const parameterPlan = &parameters[p];
+		parameterPlan->m_valid = 0;
+		parameterPlan->m_typeFlags = 0;
+		parameterPlan->m_firstOp = 0;
+		parameterPlan->m_numOps = 0;
+		parameterPlan->m_stub = LES_NULL;
+
+		const int numOps = state.m_numOps;
+		const LES_FunctionParameter* const functionParameterPtr = functionDefinition->GetParameterByIndex(p);
+		if (functionParameterPtr == LES_NULL)
+		{
+			continue;
+		}
+		if (LES_PlanCompileParameter(&state, functionParameterPtr, parameterPlan) != LES_RETURN_OK)
+		{
+			/* Parameter will use the non-plan path which reports the errors */
+#if LES_PARAMETERPLAN_DEBUG
+			LES_LOG("LES_CreateFunctionPlan nameID:%d parameter[%d] failed to compile", functionDefinition->GetNameID(), p);
+#endif // #if LES_PARAMETERPLAN_DEBUG
+			state.m_numOps = numOps;
+			continue;
+		}
+		parameterPlan->m_valid = 1;
+		if (functionNameStringEntry)
+		{
+			parameterPlan->m_stub = LES_PlanFindStub(functionNameHash, p, &state.m_ops[parameterPlan->m_firstOp], 
+																							 parameterPlan->m_numOps);
+		}
+	}
+
+	int memorySize = sizeof(LES_FunctionPlan);
+	if (state.m_numOps > 1)
+	{
+		memorySize += (int)sizeof(LES_ParameterPlanOp) * (state.m_numOps - 1);
+	}
+	LES_FunctionPlan* const functionPlan = (LES_FunctionPlan*)malloc(memorySize);
+	functionPlan->m_numParameters = numParameters;
+	functionPlan->m_numOps = state.m_numOps;
+	memcpy(functionPlan->m_parameters, parameters, sizeof(LES_ParameterPlanEntry) * numParameters);
+	memcpy(functionPlan->m_ops, state.m_ops, sizeof(LES_ParameterPlanOp) * state.m_numOps);
+
+	delete[] state.m_ops;
+
+	return functionPlan;
+}
+
+void LES_DestroyFunctionPlan(LES_FunctionPlan* const functionPlan)
+{
+	free(functionPlan);
+}
+
+int LES_ReadPlan(const LES_ParameterPlanOp* const ops, const int numOps, 
+								 const char* const readBufferPtr, const int readBufferSize, void* const parameterDataPtr)
+{
+	char* baseStack[LES_PLAN_MAX_DEPTH];
+	int depth = 0;
+	char* base = (char*)parameterDataPtr;
+	const char* readPtr = readBufferPtr;
+	const char* const readEndPtr = readBufferPtr + readBufferSize;
+	/* Native endian swaps are copies : m_size is the number of bytes for both */
+	const int lastSwapOpcode = LES_IsParameterDataNativeEndian() ? LES_PLAN_OP_SWAP64 : LES_PLAN_OP_COPY;
+	const bool varint = LES_IsParameterDataVarint();
+	for (int i = 0; i < numOps; i++)
+	{
+		const LES_ParameterPlanOp* const op = &ops[i];
+		char* const valueAddress = base + op->m_offset;
+		const int size = op->m_size;
+		int opcode = op->m_opcode;
+		if ((opcode >= LES_PLAN_OP_INT16) && (varint == false))
+		{
+			opcode += (LES_PLAN_OP_SWAP16 - LES_PLAN_OP_INT16);
+		}
+		opcode = (opcode <= lastSwapOpcode) ? LES_PLAN_OP_COPY : opcode;
+		switch (opcode)
+		{
+			case LES_PLAN_OP_COPY:
+			case LES_PLAN_OP_SWAP16:
+			case LES_PLAN_OP_SWAP32:
+			case LES_PLAN_OP_SWAP64:
+				break;
+			case LES_PLAN_OP_INT16:
+			case LES_PLAN_OP_INT32:
+			case LES_PLAN_OP_INT64:
+			{
+				const int numBytes = 2 << (opcode - LES_PLAN_OP_INT16);
+				for (int offset = 0; offset < size; offset += numBytes)
+				{
+					const int numBytesRead = LES_ReadVarint(valueAddress + offset, numBytes, readPtr, (int)(readEndPtr - readPtr));
+					if (numBytesRead < 0)
+					{
+						LES_WARNING("LES_ReadPlan op:%d invalid varint %d bytes left", i, (int)(readEndPtr - readPtr));
+						return -1;
+					}
+					readPtr += numBytesRead;
+				}
+				continue;
+			}
+			case LES_PLAN_OP_DEREF:
+				baseStack[depth] = base;
+				depth++;
+				base = *(char* const*)valueAddress;
+				if (base == LES_NULL)
+				{
+					LES_WARNING("LES_ReadPlan op:%d pointer is NULL", i);
+					return -1;
+				}
+				continue;
+			case LES_PLAN_OP_POP:
+				depth--;
+				base = baseStack[depth];
+				continue;
+			default:
+				LES_FATAL_ERROR("LES_ReadPlan op:%d unknown opcode:%d", i, op->m_opcode);
+				return -1;
+		}
+		if ((readEndPtr - readPtr) < size)
+		{
+			LES_WARNING("LES_ReadPlan op:%d needs %d bytes only %d left", i, size, (int)(readEndPtr - readPtr));
+			return -1;
+		}
+		switch (opcode)
+		{
+			case LES_PLAN_OP_SWAP16:
+				if (size == 2)
+				{
+					fromBigEndian16(valueAddress, readPtr);
+				}
+				else
+				{
+					fromBigEndianArray16(valueAddress, readPtr, size / 2);
+				}
+				break;
+			case LES_PLAN_OP_SWAP32:
+				if (size == 4)
+				{
+					fromBigEndian32(valueAddress, readPtr);
+				}
+				else
+				{
+					fromBigEndianArray32(valueAddress, readPtr, size / 4);
+				}
+				break;
+			case LES_PLAN_OP_SWAP64:
+				if (size == 8)
+				{
+					fromBigEndian64(valueAddress, readPtr);
+				}
+				else
+				{
+					fromBigEndianArray64(valueAddress, readPtr, size / 8);
+				}
+				break;
+			default:
+				memcpy(valueAddress, readPtr, size);
+				break;
+		}
+		readPtr += size;
+	}
+	return (int)(readPtr - readBufferPtr);
+}
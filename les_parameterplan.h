@@ -0,0 +1,73 @@
+#ifndef LES_PARAMETERPLAN_HH
+#define LES_PARAMETERPLAN_HH
+
+#include "les_base.h"
+#include "les_function.h"
+#include "les_parameterstub.h"
+
+class LES_FunctionDefinition;
+
+/*
+ * A plan is the type graph of each function parameter flattened into a linear list of ops
+ * Offsets are relative to the current source base pointer, DEREF pushes a new base and POP restores it
+ * m_size is the number of bytes : contiguous SWAP or INT ops of the same width are merged into one array op
+ * INT ops are LES_TYPE_INTEGER swaps : varints when the parameter data is varint otherwise the same as the SWAP op
+*/
+#define LES_PLAN_OP_COPY 		(0)
+#define LES_PLAN_OP_SWAP16 	(1)
+#define LES_PLAN_OP_SWAP32 	(2)
+#define LES_PLAN_OP_SWAP64 	(3)
+#define LES_PLAN_OP_DEREF 	(4)
+#define LES_PLAN_OP_POP 		(5)
+#define LES_PLAN_OP_INT16 	(6)
+#define LES_PLAN_OP_INT32 	(7)
+#define LES_PLAN_OP_INT64 	(8)
+
+#define LES_PLAN_MAX_DEPTH (16)
+
+struct LES_ParameterPlanOp
+{
+	LES_int32 m_opcode;
+	LES_int32 m_offset;
+	LES_int32 m_size;
+};
+
+struct LES_ParameterPlanEntry
+{
+	LES_int32 m_valid;
+	LES_uint32 m_typeFlags;
+	LES_int32 m_firstOp;
+	LES_int32 m_numOps;
+	LES_ParameterStubFunction* m_stub;		// generated serialiser for the same ops, LES_NULL if there isn't one
+};
+
+class LES_FunctionPlan
+{
+public:
+	const LES_ParameterPlanEntry* GetParameterPlan(const int index) const;
+	const LES_ParameterPlanOp* GetOps(const LES_ParameterPlanEntry* const parameterPlan) const;
+
+	friend LES_FunctionPlan* LES_CreateFunctionPlan(const LES_FunctionDefinition* const functionDefinition);
+private:
+	LES_FunctionPlan(void);
+	~LES_FunctionPlan(void);
+	LES_FunctionPlan(const LES_FunctionPlan& other);
+	LES_FunctionPlan& operator=(const LES_FunctionPlan& other);
+
+	LES_int32 m_numParameters;
+	LES_int32 m_numOps;
+	LES_ParameterPlanEntry m_parameters[LES_MAX_NUM_FUNCTION_PARAMS];
+	LES_ParameterPlanOp m_ops[1];	// m_ops[m_numOps]
+};
+
+LES_FunctionPlan* LES_CreateFunctionPlan(const LES_FunctionDefinition* const functionDefinition);
+void LES_DestroyFunctionPlan(LES_FunctionPlan* const functionPlan);
+
+/* 
+ * Inverse of LES_FunctionParameterData::WritePlan : decodes parameter data written by the same ops back into memory
+ * Returns the number of bytes read or -1 if the data is too small or a pointer is NULL
+*/
+int LES_ReadPlan(const LES_ParameterPlanOp* const ops, const int numOps, 
+								 const char* const readBufferPtr, const int readBufferSize, void* const parameterDataPtr);
+
+#endif // #ifndef LES_PARAMETERPLAN_HH
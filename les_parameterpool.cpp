@@ -0,0 +1,244 @@
+#include <string.h>
+
+#include "les_parameterpool.h"
+#include "les_parameter.h"
+#include "les_logger.h"
+#include "les_loggerchannel.h"
+
+#define LES_PARAMETERPOOL_DEBUG 0
+
+struct LES_ParameterPoolSizeClass
+{
+	LES_FunctionParameterData* m_freeList;
+	LES_ParameterPoolStats m_stats;
+};
+
+static LES_ParameterPoolSizeClass les_parameterPoolSizeClasses[LES_PARAMETERPOOL_NUM_SIZE_CLASSES];
+static LES_ParameterPoolStats les_parameterPoolOversizeStats;
+/* Only m_numInUse & m_highWaterMark : the size class high water marks can't be summed into a peak */
+static LES_ParameterPoolStats les_parameterPoolTotalStats;
+static int les_parameterPoolEpoch = 0;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Internal Static functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int LES_ParameterPoolGetSizeClass(const int parameterDataSize)
+{
+	int sizeClass = 0;
+	int blockSize = LES_PARAMETERPOOL_MIN_BLOCK_SIZE;
+	while (blockSize < parameterDataSize)
+	{
+		blockSize <<= 1;
+		sizeClass++;
+	}
+	if (sizeClass >= LES_PARAMETERPOOL_NUM_SIZE_CLASSES)
+	{
+		return -1;
+	}
+	return sizeClass;
+}
+
+static void LES_ParameterPoolClearStats(LES_ParameterPoolStats* const stats)
+{
+	stats->m_numAllocs = 0;
+	stats->m_numMisses = 0;
+	stats->m_numInUse = 0;
+	stats->m_highWaterMark = 0;
+}
+
+static void LES_ParameterPoolAddStats(LES_ParameterPoolStats* const total, const LES_ParameterPoolStats* const stats)
+{
+	total->m_numAllocs += stats->m_numAllocs;
+	total->m_numMisses += stats->m_numMisses;
+}
+
+static void LES_ParameterPoolUpdateInUse(LES_ParameterPoolStats* const stats, const int delta)
+{
+	stats->m_numInUse += delta;
+	if (stats->m_numInUse > stats->m_highWaterMark)
+	{
+		stats->m_highWaterMark = stats->m_numInUse;
+	}
+	LES_ParameterPoolStats* const totalStats = &les_parameterPoolTotalStats;
+	totalStats->m_numInUse += delta;
+	if (totalStats->m_numInUse > totalStats->m_highWaterMark)
+	{
+		totalStats->m_highWaterMark = totalStats->m_numInUse;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+LES_FunctionParameterData* LES_ParameterPoolAlloc(const int parameterDataSize)
+{
+	const int messageSize = LES_FUNCTIONPARAMETERDATA_MESSAGE_SIZE(parameterDataSize);
+	const int sizeClass = LES_ParameterPoolGetSizeClass(messageSize);
+	if (sizeClass < 0)
+	{
+		/* Too big for the pool : heap allocate it */
+		LES_ParameterPoolStats* const stats = &les_parameterPoolOversizeStats;
+		stats->m_numAllocs++;
+		stats->m_numMisses++;
+		LES_ParameterPoolUpdateInUse(stats, +1);
+		LES_FunctionParameterData* const parameterData = new LES_FunctionParameterData(new char[messageSize]);
+		parameterData->m_poolSizeClass = -1;
+		parameterData->m_poolNext = LES_NULL;
+		parameterData->m_poolRefCount = 1;
+		parameterData->m_poolEpoch = les_parameterPoolEpoch;
+		return parameterData;
+	}
+
+	LES_ParameterPoolSizeClass* const poolSizeClass = &les_parameterPoolSizeClasses[sizeClass];
+	LES_ParameterPoolStats* const stats = &poolSizeClass->m_stats;
+	stats->m_numAllocs++;
+	LES_ParameterPoolUpdateInUse(stats, +1);
+
+	LES_FunctionParameterData* parameterData = poolSizeClass->m_freeList;
+	if (parameterData)
+	{
+		poolSizeClass->m_freeList = parameterData->m_poolNext;
+		parameterData->m_poolNext = LES_NULL;
+		parameterData->m_poolRefCount = 1;
+		parameterData->Reset();
+		return parameterData;
+	}
+
+	/* Free list is empty : grow the pool */
+	stats->m_numMisses++;
+	const int blockSize = (LES_PARAMETERPOOL_MIN_BLOCK_SIZE << sizeClass);
+#if LES_PARAMETERPOOL_DEBUG
+	LES_LOG("LES_ParameterPoolAlloc size:%d miss sizeClass:%d blockSize:%d", messageSize, sizeClass, blockSize);
+#endif // #if LES_PARAMETERPOOL_DEBUG
+	parameterData = new LES_FunctionParameterData(new char[blockSize]);
+	parameterData->m_poolSizeClass = sizeClass;
+	parameterData->m_poolNext = LES_NULL;
+	parameterData->m_poolRefCount = 1;
+	parameterData->m_poolEpoch = les_parameterPoolEpoch;
+	return parameterData;
+}
+
+void LES_ParameterPoolFree(LES_FunctionParameterData* const parameterData)
+{
+	if (parameterData == LES_NULL)
+	{
+		return;
+	}
+	/* Blocks from before a pool shutdown are no longer tracked by the pool */
+	if (parameterData->m_poolEpoch != les_parameterPoolEpoch)
+	{
+		return;
+	}
+	parameterData->m_poolRefCount--;
+	if (parameterData->m_poolRefCount > 0)
+	{
+		return;
+	}
+	const int sizeClass = parameterData->m_poolSizeClass;
+	if ((sizeClass < 0) || (sizeClass >= LES_PARAMETERPOOL_NUM_SIZE_CLASSES))
+	{
+		LES_ParameterPoolUpdateInUse(&les_parameterPoolOversizeStats, -1);
+		delete parameterData;
+		return;
+	}
+	LES_ParameterPoolSizeClass* const poolSizeClass = &les_parameterPoolSizeClasses[sizeClass];
+	LES_ParameterPoolUpdateInUse(&poolSizeClass->m_stats, -1);
+	parameterData->m_poolNext = poolSizeClass->m_freeList;
+	poolSizeClass->m_freeList = parameterData;
+}
+
+void LES_ParameterPoolAddRef(LES_FunctionParameterData* const parameterData)
+{
+	if (parameterData == LES_NULL)
+	{
+		return;
+	}
+	parameterData->m_poolRefCount++;
+}
+
+int LES_ParameterPoolGetEpoch(void)
+{
+	return les_parameterPoolEpoch;
+}
+
+void LES_ParameterPoolGetStats(LES_ParameterPoolStats* const stats)
+{
+	LES_ParameterPoolClearStats(stats);
+	for (int i = 0; i < LES_PARAMETERPOOL_NUM_SIZE_CLASSES; i++)
+	{
+		LES_ParameterPoolAddStats(stats, &les_parameterPoolSizeClasses[i].m_stats);
+	}
+	LES_ParameterPoolAddStats(stats, &les_parameterPoolOversizeStats);
+	stats->m_numInUse = les_parameterPoolTotalStats.m_numInUse;
+	stats->m_highWaterMark = les_parameterPoolTotalStats.m_highWaterMark;
+}
+
+int LES_ParameterPoolGetSizeClassStats(const int sizeClass, LES_ParameterPoolStats* const stats)
+{
+	if ((sizeClass < -1) || (sizeClass >= LES_PARAMETERPOOL_NUM_SIZE_CLASSES))
+	{
+		LES_ParameterPoolClearStats(stats);
+		return LES_RETURN_ERROR;
+	}
+	*stats = (sizeClass < 0) ? les_parameterPoolOversizeStats : les_parameterPoolSizeClasses[sizeClass].m_stats;
+	return LES_RETURN_OK;
+}
+
+void LES_DebugOutputParameterPool(LES_LoggerChannel* const pLogChannel)
+{
+	for (int i = 0; i < LES_PARAMETERPOOL_NUM_SIZE_CLASSES; i++)
+	{
+		const LES_ParameterPoolStats* const stats = &les_parameterPoolSizeClasses[i].m_stats;
+		if (stats->m_numAllocs == 0)
+		{
+			continue;
+		}
+		pLogChannel->Print("ParameterPool[%d] blockSize:%d numAllocs:%d numMisses:%d numInUse:%d highWaterMark:%d",
+											 i, (LES_PARAMETERPOOL_MIN_BLOCK_SIZE << i), stats->m_numAllocs, stats->m_numMisses,
+											 stats->m_numInUse, stats->m_highWaterMark);
+	}
+	const LES_ParameterPoolStats* const stats = &les_parameterPoolOversizeStats;
+	pLogChannel->Print("ParameterPool oversize numAllocs:%d numMisses:%d numInUse:%d highWaterMark:%d",
+										 stats->m_numAllocs, stats->m_numMisses, stats->m_numInUse, stats->m_highWaterMark);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Private External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LES_ParameterPoolInit(void)
+{
+	for (int i = 0; i < LES_PARAMETERPOOL_NUM_SIZE_CLASSES; i++)
+	{
+		les_parameterPoolSizeClasses[i].m_freeList = LES_NULL;
+		LES_ParameterPoolClearStats(&les_parameterPoolSizeClasses[i].m_stats);
+	}
+	LES_ParameterPoolClearStats(&les_parameterPoolOversizeStats);
+	LES_ParameterPoolClearStats(&les_parameterPoolTotalStats);
+	les_parameterPoolEpoch++;
+}
+
+void LES_ParameterPoolShutdown(void)
+{
+	/* Blocks still in use are owned by their call sites : the epoch change stops them being released */
+	for (int i = 0; i < LES_PARAMETERPOOL_NUM_SIZE_CLASSES; i++)
+	{
+		LES_FunctionParameterData* parameterData = les_parameterPoolSizeClasses[i].m_freeList;
+		while (parameterData)
+		{
+			LES_FunctionParameterData* const next = parameterData->m_poolNext;
+			delete parameterData;
+			parameterData = next;
+		}
+		les_parameterPoolSizeClasses[i].m_freeList = LES_NULL;
+	}
+	les_parameterPoolEpoch++;
+}
@@ -0,0 +1,37 @@
+#ifndef LES_PARAMETERPOOL_HH
+#define LES_PARAMETERPOOL_HH
+
+#include "les_base.h"
+
+class LES_FunctionParameterData;
+class LES_LoggerChannel;
+
+/*
+ * Pool of parameter blocks in power of 2 size classes : blocks are recycled through per size class free lists
+ * Sizes above the largest size class are heap allocated and freed on release (counted as misses)
+ * Blocks are reference counted : a block in flight in a network message is only recycled once it has been sent
+ * Not thread safe : parameter blocks are only created and released from the main thread
+*/
+#define LES_PARAMETERPOOL_MIN_BLOCK_SIZE (16)
+#define LES_PARAMETERPOOL_NUM_SIZE_CLASSES (13)
+
+struct LES_ParameterPoolStats
+{
+	LES_int32 m_numAllocs;
+	LES_int32 m_numMisses;
+	LES_int32 m_numInUse;
+	LES_int32 m_highWaterMark;
+};
+
+LES_FunctionParameterData* LES_ParameterPoolAlloc(const int parameterDataSize);
+void LES_ParameterPoolFree(LES_FunctionParameterData* const parameterData);
+void LES_ParameterPoolAddRef(LES_FunctionParameterData* const parameterData);
+int LES_ParameterPoolGetEpoch(void);
+
+/* The totals over every size class : m_highWaterMark is the peak number of blocks in use at once */
+void LES_ParameterPoolGetStats(LES_ParameterPoolStats* const stats);
+/* sizeClass -1 is the oversize heap allocations */
+int LES_ParameterPoolGetSizeClassStats(const int sizeClass, LES_ParameterPoolStats* const stats);
+void LES_DebugOutputParameterPool(LES_LoggerChannel* const pLogChannel);
+
+#endif // #ifndef LES_PARAMETERPOOL_HH
@@ -0,0 +1,36 @@
+#include "les_parameterstub.h"
+
+/* From the generated les_parameterstubdata.cpp : sorted by function name hash then parameter index */
+extern const LES_ParameterStub les_parameterStubs[];
+extern const int les_numParameterStubs;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+const LES_ParameterStub* LES_FindParameterStub(const LES_Hash functionNameHash, const int parameterIndex)
+{
+	int low = 0;
+	int high = les_numParameterStubs - 1;
+	while (low <= high)
+	{
+		const int middle = (low + high) / 2;
+		const LES_ParameterStub* const parameterStub = &les_parameterStubs[middle];
+		if ((parameterStub->m_functionNameHash == functionNameHash) && (parameterStub->m_parameterIndex == parameterIndex))
+		{
+			return parameterStub;
+		}
+		if ((parameterStub->m_functionNameHash < functionNameHash) || 
+				((parameterStub->m_functionNameHash == functionNameHash) && (parameterStub->m_parameterIndex < parameterIndex)))
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle - 1;
+		}
+	}
+	return LES_NULL;
+}
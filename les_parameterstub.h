@@ -0,0 +1,25 @@
+#ifndef LES_PARAMETERSTUB_HH
+#define LES_PARAMETERSTUB_HH
+
+#include "les_base.h"
+#include "les_hash.h"
+
+/*
+ * Parameter stubs are straight-line serialisers generated by les_stubgen.py from the data XML files (les_parameterstubdata.cpp)
+ * A stub writes one function parameter exactly like its compiled plan : it returns the number of bytes written
+ * or -1 if a pointer in the parameter data is NULL
+ * m_layoutHash is the hash of the plan ops the stub was generated from : a stub is only bound to a plan with the same hash
+*/
+typedef int LES_ParameterStubFunction(char* const writeBufferPtr, const void* const parameterDataPtr);
+
+struct LES_ParameterStub
+{
+	LES_uint32 m_functionNameHash;
+	LES_int32 m_parameterIndex;
+	LES_uint32 m_layoutHash;
+	LES_ParameterStubFunction* m_stub;
+};
+
+const LES_ParameterStub* LES_FindParameterStub(const LES_Hash functionNameHash, const int parameterIndex);
+
+#endif // #ifndef LES_PARAMETERSTUB_HH
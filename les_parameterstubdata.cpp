@@ -0,0 +1,1622 @@
+/* Generated by les_stubgen.py from the data XML files : DO NOT EDIT */
+
+#include <memory.h>
+
+#include "les_base.h"
+#include "les_endianswap.h"
+#include "les_parameterstub.h"
+
+/* 'LES_Test_InputParamUsedAsOutput' parameter:'input_0' type:'unsigned int' */
+static int LES_Stub_LES_Test_InputParamUsedAsOutput_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputParamUsedAsOutput' parameter:'output_0' type:'unsigned short' */
+static int LES_Stub_LES_Test_InputParamUsedAsOutput_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	return 2;
+}
+
+/* 'LES_Test_ReferenceOutputStructParam' parameter:'output_0' type:'TestStruct2&' */
+static int LES_Stub_LES_Test_ReferenceOutputStructParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	toBigEndian64(writeBufferPtr + 4, base0 + 4);
+	memcpy(writeBufferPtr + 12, base0 + 12, 1);
+	toBigEndian32(writeBufferPtr + 13, base0 + 16);
+	toBigEndian16(writeBufferPtr + 17, base0 + 20);
+	toBigEndian32(writeBufferPtr + 19, base0 + 24);
+	memcpy(writeBufferPtr + 23, base0 + 28, 1);
+	toBigEndian16(writeBufferPtr + 24, base0 + 30);
+	toBigEndian32(writeBufferPtr + 26, base0 + 32);
+	return 30;
+}
+
+/* 'LES_Test_InputParamMissing' parameter:'output_0' type:'unsigned int*' */
+static int LES_Stub_LES_Test_InputParamMissing_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputParamMissing' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_InputParamMissing_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputParamMissing' parameter:'input_1' type:'int' */
+static int LES_Stub_LES_Test_InputParamMissing_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputParamMissing' parameter:'input_2' type:'int' */
+static int LES_Stub_LES_Test_InputParamMissing_3(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadInputParameters' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_ReadInputParameters_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadInputParameters' parameter:'input_1' type:'short' */
+static int LES_Stub_LES_Test_ReadInputParameters_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	return 2;
+}
+
+/* 'LES_Test_ReadInputParameters' parameter:'input_2' type:'char' */
+static int LES_Stub_LES_Test_ReadInputParameters_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_ReadInputParameters' parameter:'input_3' type:'float' */
+static int LES_Stub_LES_Test_ReadInputParameters_3(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadInputParameters' parameter:'input_4' type:'int*' */
+static int LES_Stub_LES_Test_ReadInputParameters_4(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputParamUsedAsInput' parameter:'input_0' type:'output_only' */
+static int LES_Stub_LES_Test_OutputParamUsedAsInput_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 4);
+	return 4;
+}
+
+/* 'LES_Test_OutputParamUsedAsInput' parameter:'output_0' type:'unsigned short*' */
+static int LES_Stub_LES_Test_OutputParamUsedAsInput_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_DecodeOutputArrayReference' parameter:'output_0' type:'short&[3]' */
+static int LES_Stub_LES_Test_DecodeOutputArrayReference_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndianArray16(writeBufferPtr + 0, base0 + 0, 3);
+	return 6;
+}
+
+/* 'LES_Test_DecodeOutputArrayReference' parameter:'output_1' type:'int&[3]' */
+static int LES_Stub_LES_Test_DecodeOutputArrayReference_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndianArray32(writeBufferPtr + 0, base0 + 0, 3);
+	return 12;
+}
+
+/* 'LES_Test_InputUsedAsOutput' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_InputUsedAsOutput_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputUsedAsOutput' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_InputUsedAsOutput_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_DecodeOutputArraySTRUCT' parameter:'output_0' type:'TestStruct3[2]' */
+static int LES_Stub_LES_Test_DecodeOutputArraySTRUCT_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	toBigEndian32(writeBufferPtr + 2, base1 + 4);
+	toBigEndian32(writeBufferPtr + 6, base1 + 8);
+	memcpy(writeBufferPtr + 10, base1 + 12, 1);
+	toBigEndian16(writeBufferPtr + 11, base1 + 16);
+	toBigEndian32(writeBufferPtr + 13, base1 + 20);
+	toBigEndian32(writeBufferPtr + 17, base1 + 24);
+	memcpy(writeBufferPtr + 21, base1 + 28, 1);
+	return 22;
+}
+
+/* 'LES_Test_DecodeOutputArraySTRUCT' parameter:'output_1' type:'TestStruct4[1]' */
+static int LES_Stub_LES_Test_DecodeOutputArraySTRUCT_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	toBigEndian32(writeBufferPtr + 4, base1 + 4);
+	memcpy(writeBufferPtr + 8, base1 + 8, 1);
+	toBigEndianArray16(writeBufferPtr + 9, base1 + 10, 2);
+	toBigEndian16(writeBufferPtr + 13, base1 + 16);
+	toBigEndian32(writeBufferPtr + 15, base1 + 20);
+	toBigEndian32(writeBufferPtr + 19, base1 + 24);
+	memcpy(writeBufferPtr + 23, base1 + 28, 1);
+	return 24;
+}
+
+/* 'LES_Test_ReferenceInputStructParam' parameter:'input_0' type:'TestStruct1&' */
+static int LES_Stub_LES_Test_ReferenceInputStructParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian64(writeBufferPtr + 0, base0 + 0);
+	memcpy(writeBufferPtr + 8, base0 + 8, 1);
+	toBigEndian32(writeBufferPtr + 9, base0 + 12);
+	toBigEndian16(writeBufferPtr + 13, base0 + 16);
+	toBigEndian32(writeBufferPtr + 15, base0 + 20);
+	return 19;
+}
+
+/* 'LES_Test_ReadOutputParameters' parameter:'output_0' type:'unsigned int*' */
+static int LES_Stub_LES_Test_ReadOutputParameters_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadOutputParameters' parameter:'output_1' type:'unsigned short*' */
+static int LES_Stub_LES_Test_ReadOutputParameters_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_ReadOutputParameters' parameter:'output_2' type:'unsigned char*' */
+static int LES_Stub_LES_Test_ReadOutputParameters_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 0, base1 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_ReadOutputParameters' parameter:'output_3' type:'float*' */
+static int LES_Stub_LES_Test_ReadOutputParameters_3(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputParamMissing' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_OutputParamMissing_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputParamMissing' parameter:'output_0' type:'unsigned int*' */
+static int LES_Stub_LES_Test_OutputParamMissing_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputParamMissing' parameter:'output_1' type:'unsigned short*' */
+static int LES_Stub_LES_Test_OutputParamMissing_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_OutputNameHashIsWrong' parameter:'wrongHash' type:'int*' */
+static int LES_Stub_LES_Test_OutputNameHashIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputNameDoesntExist' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_InputNameDoesntExist_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputNameDoesntExist' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_InputNameDoesntExist_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReferenceStructInputParam' parameter:'input_0' type:'TestStruct7&' */
+static int LES_Stub_LES_Test_ReferenceStructInputParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	const char* const base1 = *(const char* const*)(base0 + 4);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 2, base1 + 0);
+	memcpy(writeBufferPtr + 6, base0 + 8, 1);
+	const char* const base2 = *(const char* const*)(base0 + 12);
+	if (base2 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 7, base2 + 0, 1);
+	const char* const base3 = *(const char* const*)(base0 + 16);
+	if (base3 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 8, base3 + 0, 1);
+	return 9;
+}
+
+/* 'LES_Test_DecodeInputArrayPOD' parameter:'input_0' type:'char[3]' */
+static int LES_Stub_LES_Test_DecodeInputArrayPOD_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 0, base1 + 0, 3);
+	return 3;
+}
+
+/* 'LES_Test_DecodeInputArrayPOD' parameter:'input_1' type:'short[3]' */
+static int LES_Stub_LES_Test_DecodeInputArrayPOD_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray16(writeBufferPtr + 0, base1 + 0, 3);
+	return 6;
+}
+
+/* 'LES_Test_OutputParamAlreadyUsed' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_OutputParamAlreadyUsed_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputParamAlreadyUsed' parameter:'output_0' type:'unsigned int*' */
+static int LES_Stub_LES_Test_OutputParamAlreadyUsed_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputParamAlreadyUsed' parameter:'output_1' type:'unsigned short*' */
+static int LES_Stub_LES_Test_OutputParamAlreadyUsed_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'output_0' type:'unsigned int*' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'input_1' type:'short' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	return 2;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'output_1' type:'unsigned short*' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_3(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'input_2' type:'char' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_4(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'output_2' type:'unsigned char*' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_5(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 0, base1 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'input_3' type:'float' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_6(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'output_3' type:'float*' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_7(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'input_4' type:'int*' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_8(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'input_5' type:'short*' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_9(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_DecodeInputOutputParameters' parameter:'input_6' type:'char*' */
+static int LES_Stub_LES_Test_DecodeInputOutputParameters_10(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 0, base1 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_StructInputParam' parameter:'input_0' type:'TestStruct2' */
+static int LES_Stub_LES_Test_StructInputParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	toBigEndian64(writeBufferPtr + 4, base0 + 4);
+	memcpy(writeBufferPtr + 12, base0 + 12, 1);
+	toBigEndian32(writeBufferPtr + 13, base0 + 16);
+	toBigEndian16(writeBufferPtr + 17, base0 + 20);
+	toBigEndian32(writeBufferPtr + 19, base0 + 24);
+	memcpy(writeBufferPtr + 23, base0 + 28, 1);
+	toBigEndian16(writeBufferPtr + 24, base0 + 30);
+	toBigEndian32(writeBufferPtr + 26, base0 + 32);
+	return 30;
+}
+
+/* 'LES_Test_StructInputParam' parameter:'input_1' type:'int' */
+static int LES_Stub_LES_Test_StructInputParam_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_StructInputParam' parameter:'input_2' type:'TestStruct1' */
+static int LES_Stub_LES_Test_StructInputParam_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian64(writeBufferPtr + 0, base0 + 0);
+	memcpy(writeBufferPtr + 8, base0 + 8, 1);
+	toBigEndian32(writeBufferPtr + 9, base0 + 12);
+	toBigEndian16(writeBufferPtr + 13, base0 + 16);
+	toBigEndian32(writeBufferPtr + 15, base0 + 20);
+	return 19;
+}
+
+/* 'LES_Test_StructInputParam' parameter:'input_3' type:'TestStruct3' */
+static int LES_Stub_LES_Test_StructInputParam_3(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	toBigEndian32(writeBufferPtr + 2, base0 + 4);
+	toBigEndian32(writeBufferPtr + 6, base0 + 8);
+	memcpy(writeBufferPtr + 10, base0 + 12, 1);
+	return 11;
+}
+
+/* 'LES_Test_StructInputParam' parameter:'input_4' type:'TestStruct4*' */
+static int LES_Stub_LES_Test_StructInputParam_4(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	toBigEndian32(writeBufferPtr + 4, base1 + 4);
+	memcpy(writeBufferPtr + 8, base1 + 8, 1);
+	toBigEndianArray16(writeBufferPtr + 9, base1 + 10, 2);
+	toBigEndian16(writeBufferPtr + 13, base1 + 16);
+	toBigEndian32(writeBufferPtr + 15, base1 + 20);
+	toBigEndian32(writeBufferPtr + 19, base1 + 24);
+	memcpy(writeBufferPtr + 23, base1 + 28, 1);
+	return 24;
+}
+
+/* 'LES_Test_OutputWrongIndex' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_OutputWrongIndex_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputWrongIndex' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_OutputWrongIndex_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputWrongIndex' parameter:'output_1' type:'int*' */
+static int LES_Stub_LES_Test_OutputWrongIndex_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputTypeHashIsWrong' parameter:'output_0' type:'output_wrongHash' */
+static int LES_Stub_LES_Test_OutputTypeHashIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 4);
+	return 4;
+}
+
+/* 'PyTestFunction1' parameter:'m_longlong' type:'long long int' */
+static int LES_Stub_PyTestFunction1_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian64(writeBufferPtr + 0, base0 + 0);
+	return 8;
+}
+
+/* 'PyTestFunction1' parameter:'m_char' type:'char' */
+static int LES_Stub_PyTestFunction1_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 1);
+	return 1;
+}
+
+/* 'PyTestFunction1' parameter:'m_int' type:'int*' */
+static int LES_Stub_PyTestFunction1_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputGlobalIndexIsWrong' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_InputGlobalIndexIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputGlobalIndexIsWrong' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_InputGlobalIndexIsWrong_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReferenceStructOutputParam' parameter:'output_0' type:'TestStruct8&' */
+static int LES_Stub_LES_Test_ReferenceStructOutputParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	const char* const base1 = *(const char* const*)(base0 + 4);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 2, base1 + 0, 1);
+	const char* const base2 = *(const char* const*)(base1 + 4);
+	if (base2 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 3, base2 + 0);
+	const char* const base3 = *(const char* const*)(base0 + 8);
+	if (base3 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 5, base3 + 0, 1);
+	return 6;
+}
+
+/* 'LES_Test_DecodeInputStructPODArray' parameter:'input_0' type:'TestStruct9' */
+static int LES_Stub_LES_Test_DecodeInputStructPODArray_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndianArray16(writeBufferPtr + 0, base0 + 0, 3);
+	return 6;
+}
+
+/* 'LES_Test_InputTypeStringIsWrong' parameter:'input_0' type:'input_brokenString' */
+static int LES_Stub_LES_Test_InputTypeStringIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 4);
+	return 4;
+}
+
+/* 'LES_Test_InputParamAlreadyUsed' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_InputParamAlreadyUsed_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputParamAlreadyUsed' parameter:'input_1' type:'int' */
+static int LES_Stub_LES_Test_InputParamAlreadyUsed_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputParamAlreadyUsed' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_InputParamAlreadyUsed_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputNameHashIsWrong' parameter:'wrongHash' type:'int' */
+static int LES_Stub_LES_Test_InputNameHashIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputTypeStringIsWrong' parameter:'output_0' type:'output_brokenString' */
+static int LES_Stub_LES_Test_OutputTypeStringIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 4);
+	return 4;
+}
+
+/* 'LES_Test_InputWrongIndex' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_InputWrongIndex_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputWrongIndex' parameter:'input_1' type:'int' */
+static int LES_Stub_LES_Test_InputWrongIndex_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputWrongIndex' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_InputWrongIndex_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_DecodeInputArraySTRUCTA' parameter:'input_0' type:'TestStruct2[2]' */
+static int LES_Stub_LES_Test_DecodeInputArraySTRUCTA_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	toBigEndian64(writeBufferPtr + 4, base1 + 4);
+	memcpy(writeBufferPtr + 12, base1 + 12, 1);
+	toBigEndian32(writeBufferPtr + 13, base1 + 16);
+	toBigEndian16(writeBufferPtr + 17, base1 + 20);
+	toBigEndian32(writeBufferPtr + 19, base1 + 24);
+	memcpy(writeBufferPtr + 23, base1 + 28, 1);
+	toBigEndian16(writeBufferPtr + 24, base1 + 30);
+	toBigEndian32(writeBufferPtr + 26, base1 + 32);
+	toBigEndian32(writeBufferPtr + 30, base1 + 36);
+	toBigEndian64(writeBufferPtr + 34, base1 + 40);
+	memcpy(writeBufferPtr + 42, base1 + 48, 1);
+	toBigEndian32(writeBufferPtr + 43, base1 + 52);
+	toBigEndian16(writeBufferPtr + 47, base1 + 56);
+	toBigEndian32(writeBufferPtr + 49, base1 + 60);
+	memcpy(writeBufferPtr + 53, base1 + 64, 1);
+	toBigEndian16(writeBufferPtr + 54, base1 + 66);
+	toBigEndian32(writeBufferPtr + 56, base1 + 68);
+	return 60;
+}
+
+/* 'LES_Test_DecodeInputArraySTRUCTA' parameter:'input_1' type:'TestStruct1[1]' */
+static int LES_Stub_LES_Test_DecodeInputArraySTRUCTA_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian64(writeBufferPtr + 0, base1 + 0);
+	memcpy(writeBufferPtr + 8, base1 + 8, 1);
+	toBigEndian32(writeBufferPtr + 9, base1 + 12);
+	toBigEndian16(writeBufferPtr + 13, base1 + 16);
+	toBigEndian32(writeBufferPtr + 15, base1 + 20);
+	return 19;
+}
+
+/* 'LES_Test_DecodeInputArraySTRUCTB' parameter:'input_0' type:'TestStruct1[2]' */
+static int LES_Stub_LES_Test_DecodeInputArraySTRUCTB_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian64(writeBufferPtr + 0, base1 + 0);
+	memcpy(writeBufferPtr + 8, base1 + 8, 1);
+	toBigEndian32(writeBufferPtr + 9, base1 + 12);
+	toBigEndian16(writeBufferPtr + 13, base1 + 16);
+	toBigEndian32(writeBufferPtr + 15, base1 + 20);
+	toBigEndian64(writeBufferPtr + 19, base1 + 24);
+	memcpy(writeBufferPtr + 27, base1 + 32, 1);
+	toBigEndian32(writeBufferPtr + 28, base1 + 36);
+	toBigEndian16(writeBufferPtr + 32, base1 + 40);
+	toBigEndian32(writeBufferPtr + 34, base1 + 44);
+	return 38;
+}
+
+/* 'LES_Test_DecodeInputArraySTRUCTB' parameter:'input_1' type:'TestStruct2[1]' */
+static int LES_Stub_LES_Test_DecodeInputArraySTRUCTB_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	toBigEndian64(writeBufferPtr + 4, base1 + 4);
+	memcpy(writeBufferPtr + 12, base1 + 12, 1);
+	toBigEndian32(writeBufferPtr + 13, base1 + 16);
+	toBigEndian16(writeBufferPtr + 17, base1 + 20);
+	toBigEndian32(writeBufferPtr + 19, base1 + 24);
+	memcpy(writeBufferPtr + 23, base1 + 28, 1);
+	toBigEndian16(writeBufferPtr + 24, base1 + 30);
+	toBigEndian32(writeBufferPtr + 26, base1 + 32);
+	return 30;
+}
+
+/* 'LES_Test_StructInputOutputParam' parameter:'in_0' type:'TestStruct5*' */
+static int LES_Stub_LES_Test_StructInputOutputParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 0, base1 + 0, 1);
+	const char* const base2 = *(const char* const*)(base1 + 4);
+	if (base2 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 1, base2 + 0);
+	return 3;
+}
+
+/* 'LES_Test_StructInputOutputParam' parameter:'out_0' type:'TestStruct6*' */
+static int LES_Stub_LES_Test_StructInputOutputParam_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	const char* const base2 = *(const char* const*)(base1 + 4);
+	if (base2 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 2, base2 + 0, 1);
+	const char* const base3 = *(const char* const*)(base2 + 4);
+	if (base3 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 3, base3 + 0);
+	const char* const base4 = *(const char* const*)(base1 + 8);
+	if (base4 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 5, base4 + 0, 1);
+	return 6;
+}
+
+/* 'LES_Test_OutputUsedAsInput' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_OutputUsedAsInput_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputUsedAsInput' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_OutputUsedAsInput_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputNameIDNotFound' parameter:'None' type:'int*' */
+static int LES_Stub_LES_Test_OutputNameIDNotFound_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputTypeHashIsWrong' parameter:'input_0' type:'input_wrongHash' */
+static int LES_Stub_LES_Test_InputTypeHashIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 4);
+	return 4;
+}
+
+/* 'LES_Test_DecodeInputArrayReference' parameter:'input_0' type:'char&[3]' */
+static int LES_Stub_LES_Test_DecodeInputArrayReference_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 3);
+	return 3;
+}
+
+/* 'LES_Test_DecodeInputArrayReference' parameter:'input_1' type:'short&[3]' */
+static int LES_Stub_LES_Test_DecodeInputArrayReference_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndianArray16(writeBufferPtr + 0, base0 + 0, 3);
+	return 6;
+}
+
+/* 'LES_Test_DecodeOutputArrayPOD' parameter:'output_0' type:'short[3]' */
+static int LES_Stub_LES_Test_DecodeOutputArrayPOD_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray16(writeBufferPtr + 0, base1 + 0, 3);
+	return 6;
+}
+
+/* 'LES_Test_DecodeOutputArrayPOD' parameter:'output_1' type:'int[3]' */
+static int LES_Stub_LES_Test_DecodeOutputArrayPOD_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray32(writeBufferPtr + 0, base1 + 0, 3);
+	return 12;
+}
+
+/* 'LES_Test_TooManyInputParameters' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_TooManyInputParameters_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_TooManyInputParameters' parameter:'input_1' type:'int' */
+static int LES_Stub_LES_Test_TooManyInputParameters_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_TooManyInputParameters' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_TooManyInputParameters_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReferenceInputPODParam' parameter:'input_0' type:'int&' */
+static int LES_Stub_LES_Test_ReferenceInputPODParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_DecodeOutputParameters' parameter:'output_0' type:'char&' */
+static int LES_Stub_LES_Test_DecodeOutputParameters_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_OutputNameDoesntExist' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_OutputNameDoesntExist_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_StructOutputParam' parameter:'out_0' type:'TestStruct3*' */
+static int LES_Stub_LES_Test_StructOutputParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	toBigEndian32(writeBufferPtr + 2, base1 + 4);
+	toBigEndian32(writeBufferPtr + 6, base1 + 8);
+	memcpy(writeBufferPtr + 10, base1 + 12, 1);
+	return 11;
+}
+
+/* 'LES_Test_StructOutputParam' parameter:'out_1' type:'TestStruct4*' */
+static int LES_Stub_LES_Test_StructOutputParam_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	toBigEndian32(writeBufferPtr + 4, base1 + 4);
+	memcpy(writeBufferPtr + 8, base1 + 8, 1);
+	toBigEndianArray16(writeBufferPtr + 9, base1 + 10, 2);
+	toBigEndian16(writeBufferPtr + 13, base1 + 16);
+	toBigEndian32(writeBufferPtr + 15, base1 + 20);
+	toBigEndian32(writeBufferPtr + 19, base1 + 24);
+	memcpy(writeBufferPtr + 23, base1 + 28, 1);
+	return 24;
+}
+
+/* 'LES_Test_DecodeInputStructStructArrayReference' parameter:'input_0' type:'TestStruct12' */
+static int LES_Stub_LES_Test_DecodeInputStructStructArrayReference_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray16(writeBufferPtr + 0, base1 + 0, 3);
+	const char* const base2 = *(const char* const*)(base0 + 4);
+	if (base2 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray16(writeBufferPtr + 6, base2 + 0, 6);
+	const char* const base3 = *(const char* const*)(base0 + 8);
+	if (base3 == LES_NULL)
+	{
+		return -1;
+	}
+	const char* const base4 = *(const char* const*)(base3 + 0);
+	if (base4 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray16(writeBufferPtr + 18, base4 + 0, 3);
+	const char* const base5 = *(const char* const*)(base3 + 4);
+	if (base5 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray32(writeBufferPtr + 24, base5 + 0, 2);
+	const char* const base6 = *(const char* const*)(base3 + 8);
+	if (base6 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 32, base6 + 0, 5);
+	return 37;
+}
+
+/* 'jakeInit' parameter:'a' type:'int' */
+static int LES_Stub_jakeInit_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'jakeInit' parameter:'b' type:'short' */
+static int LES_Stub_jakeInit_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	return 2;
+}
+
+/* 'jakeInit' parameter:'rPtr' type:'float*' */
+static int LES_Stub_jakeInit_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputNameStringIsWrong' parameter:'InputNameBrokenString' type:'int' */
+static int LES_Stub_LES_Test_InputNameStringIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'output_0' type:'unsigned int*' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'input_1' type:'short' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	return 2;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'output_1' type:'unsigned short*' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_3(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'input_2' type:'char' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_4(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'output_2' type:'unsigned char*' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_5(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 0, base1 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'input_3' type:'float' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_6(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'output_3' type:'float*' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_7(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReadInputOutputParameters' parameter:'input_4' type:'int*' */
+static int LES_Stub_LES_Test_ReadInputOutputParameters_8(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_ReferenceOutputPODParam' parameter:'output_0' type:'char&' */
+static int LES_Stub_LES_Test_ReferenceOutputPODParam_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_InputNameIDNotFound' parameter:'None' type:'int' */
+static int LES_Stub_LES_Test_InputNameIDNotFound_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputOutputMixture' parameter:'input_0' type:'unsigned short' */
+static int LES_Stub_LES_Test_InputOutputMixture_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian16(writeBufferPtr + 0, base0 + 0);
+	return 2;
+}
+
+/* 'LES_Test_InputOutputMixture' parameter:'output_0' type:'unsigned int*' */
+static int LES_Stub_LES_Test_InputOutputMixture_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_InputOutputMixture' parameter:'input_1' type:'unsigned char' */
+static int LES_Stub_LES_Test_InputOutputMixture_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	memcpy(writeBufferPtr + 0, base0 + 0, 1);
+	return 1;
+}
+
+/* 'LES_Test_InputOutputMixture' parameter:'output_1' type:'unsigned short*' */
+static int LES_Stub_LES_Test_InputOutputMixture_3(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_OutputGlobalIndexIsWrong' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_OutputGlobalIndexIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputGlobalIndexIsWrong' parameter:'output_0' type:'int*' */
+static int LES_Stub_LES_Test_OutputGlobalIndexIsWrong_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_OutputNameStringIsWrong' parameter:'OutputNameBrokenString' type:'int*' */
+static int LES_Stub_LES_Test_OutputNameStringIsWrong_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_TooManyOutputParameters' parameter:'input_0' type:'int' */
+static int LES_Stub_LES_Test_TooManyOutputParameters_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndian32(writeBufferPtr + 0, base0 + 0);
+	return 4;
+}
+
+/* 'LES_Test_TooManyOutputParameters' parameter:'output_0' type:'unsigned int*' */
+static int LES_Stub_LES_Test_TooManyOutputParameters_1(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian32(writeBufferPtr + 0, base1 + 0);
+	return 4;
+}
+
+/* 'LES_Test_TooManyOutputParameters' parameter:'output_1' type:'unsigned short*' */
+static int LES_Stub_LES_Test_TooManyOutputParameters_2(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndian16(writeBufferPtr + 0, base1 + 0);
+	return 2;
+}
+
+/* 'LES_Test_DecodeInputStructPODArrayReference' parameter:'input_0' type:'TestStruct11' */
+static int LES_Stub_LES_Test_DecodeInputStructPODArrayReference_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	const char* const base1 = *(const char* const*)(base0 + 0);
+	if (base1 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray16(writeBufferPtr + 0, base1 + 0, 3);
+	const char* const base2 = *(const char* const*)(base0 + 4);
+	if (base2 == LES_NULL)
+	{
+		return -1;
+	}
+	toBigEndianArray32(writeBufferPtr + 6, base2 + 0, 2);
+	const char* const base3 = *(const char* const*)(base0 + 8);
+	if (base3 == LES_NULL)
+	{
+		return -1;
+	}
+	memcpy(writeBufferPtr + 14, base3 + 0, 5);
+	return 19;
+}
+
+/* 'LES_Test_DecodeInputStructStructArray' parameter:'input_0' type:'TestStruct10' */
+static int LES_Stub_LES_Test_DecodeInputStructStructArray_0(char* const writeBufferPtr, const void* const parameterDataPtr)
+{
+	const char* const base0 = (const char*)parameterDataPtr;
+	toBigEndianArray16(writeBufferPtr + 0, base0 + 0, 9);
+	return 18;
+}
+
+extern const LES_ParameterStub les_parameterStubs[];
+extern const int les_numParameterStubs;
+
+const LES_ParameterStub les_parameterStubs[] = 
+{
+	{ 0x0317C517, 0, 0x000FFF43, LES_Stub_LES_Test_InputParamUsedAsOutput_0 },
+	{ 0x0317C517, 1, 0x000DB638, LES_Stub_LES_Test_InputParamUsedAsOutput_1 },
+	{ 0x055E0B94, 0, 0xCFA0EE6C, LES_Stub_LES_Test_ReferenceOutputStructParam_0 },
+	{ 0x0A21758F, 0, 0x8897810F, LES_Stub_LES_Test_InputParamMissing_0 },
+	{ 0x0A21758F, 1, 0x000FFF43, LES_Stub_LES_Test_InputParamMissing_1 },
+	{ 0x0A21758F, 2, 0x000FFF43, LES_Stub_LES_Test_InputParamMissing_2 },
+	{ 0x0A21758F, 3, 0x000FFF43, LES_Stub_LES_Test_InputParamMissing_3 },
+	{ 0x0CE2C536, 0, 0x000FFF43, LES_Stub_LES_Test_ReadInputParameters_0 },
+	{ 0x0CE2C536, 1, 0x000DB638, LES_Stub_LES_Test_ReadInputParameters_1 },
+	{ 0x0CE2C536, 2, 0x00000001, LES_Stub_LES_Test_ReadInputParameters_2 },
+	{ 0x0CE2C536, 3, 0x00049216, LES_Stub_LES_Test_ReadInputParameters_3 },
+	{ 0x0CE2C536, 4, 0x8897810F, LES_Stub_LES_Test_ReadInputParameters_4 },
+	{ 0x12FD08BB, 0, 0x00000004, LES_Stub_LES_Test_OutputParamUsedAsInput_0 },
+	{ 0x12FD08BB, 1, 0x88953804, LES_Stub_LES_Test_OutputParamUsedAsInput_1 },
+	{ 0x17D75211, 0, 0x000DB63C, LES_Stub_LES_Test_DecodeOutputArrayReference_0 },
+	{ 0x17D75211, 1, 0x000FFF4B, LES_Stub_LES_Test_DecodeOutputArrayReference_1 },
+	{ 0x17FC4776, 0, 0x000FFF43, LES_Stub_LES_Test_InputUsedAsOutput_0 },
+	{ 0x17FC4776, 1, 0x8897810F, LES_Stub_LES_Test_InputUsedAsOutput_1 },
+	{ 0x1C3D2987, 0, 0x51F6AF49, LES_Stub_LES_Test_DecodeOutputArraySTRUCT_0 },
+	{ 0x1C3D2987, 1, 0xA41EB55D, LES_Stub_LES_Test_DecodeOutputArraySTRUCT_1 },
+	{ 0x1E7B4CBD, 0, 0x7052EF94, LES_Stub_LES_Test_ReferenceInputStructParam_0 },
+	{ 0x1F57F3FD, 0, 0x8897810F, LES_Stub_LES_Test_ReadOutputParameters_0 },
+	{ 0x1F57F3FD, 1, 0x88953804, LES_Stub_LES_Test_ReadOutputParameters_1 },
+	{ 0x1F57F3FD, 2, 0x888781CD, LES_Stub_LES_Test_ReadOutputParameters_2 },
+	{ 0x1F57F3FD, 3, 0x888C13E2, LES_Stub_LES_Test_ReadOutputParameters_3 },
+	{ 0x221FADB2, 0, 0x000FFF43, LES_Stub_LES_Test_OutputParamMissing_0 },
+	{ 0x221FADB2, 1, 0x8897810F, LES_Stub_LES_Test_OutputParamMissing_1 },
+	{ 0x221FADB2, 2, 0x88953804, LES_Stub_LES_Test_OutputParamMissing_2 },
+	{ 0x2469F309, 0, 0x8897810F, LES_Stub_LES_Test_OutputNameHashIsWrong_0 },
+	{ 0x2A97636F, 0, 0x000FFF43, LES_Stub_LES_Test_InputNameDoesntExist_0 },
+	{ 0x2A97636F, 1, 0x8897810F, LES_Stub_LES_Test_InputNameDoesntExist_1 },
+	{ 0x3C8EDCEB, 0, 0x0DF58162, LES_Stub_LES_Test_ReferenceStructInputParam_0 },
+	{ 0x3F2043B0, 0, 0xF59F1D82, LES_Stub_LES_Test_DecodeInputArrayPOD_0 },
+	{ 0x3F2043B0, 1, 0xCCC79A05, LES_Stub_LES_Test_DecodeInputArrayPOD_1 },
+	{ 0x49583655, 0, 0x000FFF43, LES_Stub_LES_Test_OutputParamAlreadyUsed_0 },
+	{ 0x49583655, 1, 0x8897810F, LES_Stub_LES_Test_OutputParamAlreadyUsed_1 },
+	{ 0x49583655, 2, 0x88953804, LES_Stub_LES_Test_OutputParamAlreadyUsed_2 },
+	{ 0x4B9FF9CF, 0, 0x000FFF43, LES_Stub_LES_Test_DecodeInputOutputParameters_0 },
+	{ 0x4B9FF9CF, 1, 0x8897810F, LES_Stub_LES_Test_DecodeInputOutputParameters_1 },
+	{ 0x4B9FF9CF, 2, 0x000DB638, LES_Stub_LES_Test_DecodeInputOutputParameters_2 },
+	{ 0x4B9FF9CF, 3, 0x88953804, LES_Stub_LES_Test_DecodeInputOutputParameters_3 },
+	{ 0x4B9FF9CF, 4, 0x00000001, LES_Stub_LES_Test_DecodeInputOutputParameters_4 },
+	{ 0x4B9FF9CF, 5, 0x888781CD, LES_Stub_LES_Test_DecodeInputOutputParameters_5 },
+	{ 0x4B9FF9CF, 6, 0x00049216, LES_Stub_LES_Test_DecodeInputOutputParameters_6 },
+	{ 0x4B9FF9CF, 7, 0x888C13E2, LES_Stub_LES_Test_DecodeInputOutputParameters_7 },
+	{ 0x4B9FF9CF, 8, 0x8897810F, LES_Stub_LES_Test_DecodeInputOutputParameters_8 },
+	{ 0x4B9FF9CF, 9, 0x88953804, LES_Stub_LES_Test_DecodeInputOutputParameters_9 },
+	{ 0x4B9FF9CF, 10, 0x888781CD, LES_Stub_LES_Test_DecodeInputOutputParameters_10 },
+	{ 0x4EB63030, 0, 0xCFA0EE6C, LES_Stub_LES_Test_StructInputParam_0 },
+	{ 0x4EB63030, 1, 0x000FFF43, LES_Stub_LES_Test_StructInputParam_1 },
+	{ 0x4EB63030, 2, 0x7052EF94, LES_Stub_LES_Test_StructInputParam_2 },
+	{ 0x4EB63030, 3, 0x0BF4C0B8, LES_Stub_LES_Test_StructInputParam_3 },
+	{ 0x4EB63030, 4, 0x3175E390, LES_Stub_LES_Test_StructInputParam_4 },
+	{ 0x5262EDF2, 0, 0x000FFF43, LES_Stub_LES_Test_OutputWrongIndex_0 },
+	{ 0x5262EDF2, 1, 0x8897810F, LES_Stub_LES_Test_OutputWrongIndex_1 },
+	{ 0x5262EDF2, 2, 0x8897810F, LES_Stub_LES_Test_OutputWrongIndex_2 },
+	{ 0x5327677A, 0, 0x00000004, LES_Stub_LES_Test_OutputTypeHashIsWrong_0 },
+	{ 0x5641F8DA, 0, 0x00124850, LES_Stub_PyTestFunction1_0 },
+	{ 0x5641F8DA, 1, 0x00000001, LES_Stub_PyTestFunction1_1 },
+	{ 0x5641F8DA, 2, 0x8897810F, LES_Stub_PyTestFunction1_2 },
+	{ 0x5E930E7A, 0, 0x8897810F, LES_Stub_LES_Test_InputGlobalIndexIsWrong_0 },
+	{ 0x5E930E7A, 1, 0x000FFF43, LES_Stub_LES_Test_InputGlobalIndexIsWrong_1 },
+	{ 0x60F32D74, 0, 0xEDA15DCB, LES_Stub_LES_Test_ReferenceStructOutputParam_0 },
+	{ 0x622E01DD, 0, 0x000DB63C, LES_Stub_LES_Test_DecodeInputStructPODArray_0 },
+	{ 0x6A3BDEEA, 0, 0x00000004, LES_Stub_LES_Test_InputTypeStringIsWrong_0 },
+	{ 0x7445CD42, 0, 0x000FFF43, LES_Stub_LES_Test_InputParamAlreadyUsed_0 },
+	{ 0x7445CD42, 1, 0x000FFF43, LES_Stub_LES_Test_InputParamAlreadyUsed_1 },
+	{ 0x7445CD42, 2, 0x8897810F, LES_Stub_LES_Test_InputParamAlreadyUsed_2 },
+	{ 0x7DD3BDD8, 0, 0x000FFF43, LES_Stub_LES_Test_InputNameHashIsWrong_0 },
+	{ 0x8510B6A3, 0, 0x00000004, LES_Stub_LES_Test_OutputTypeStringIsWrong_0 },
+	{ 0x95AD8F27, 0, 0x000FFF43, LES_Stub_LES_Test_InputWrongIndex_0 },
+	{ 0x95AD8F27, 1, 0x000FFF43, LES_Stub_LES_Test_InputWrongIndex_1 },
+	{ 0x95AD8F27, 2, 0x8897810F, LES_Stub_LES_Test_InputWrongIndex_2 },
+	{ 0x964D4EF7, 0, 0x3EF5252D, LES_Stub_LES_Test_DecodeInputArraySTRUCTA_0 },
+	{ 0x964D4EF7, 1, 0xF1E3B20D, LES_Stub_LES_Test_DecodeInputArraySTRUCTA_1 },
+	{ 0x964D4EF8, 0, 0x1BA32BC1, LES_Stub_LES_Test_DecodeInputArraySTRUCTB_0 },
+	{ 0x964D4EF8, 1, 0x4650E295, LES_Stub_LES_Test_DecodeInputArraySTRUCTB_1 },
+	{ 0x9A9DB9AB, 0, 0x7ED2280C, LES_Stub_LES_Test_StructInputOutputParam_0 },
+	{ 0x9A9DB9AB, 1, 0xCFAA97CF, LES_Stub_LES_Test_StructInputOutputParam_1 },
+	{ 0xA68C9D7E, 0, 0x000FFF43, LES_Stub_LES_Test_OutputUsedAsInput_0 },
+	{ 0xA68C9D7E, 1, 0x8897810F, LES_Stub_LES_Test_OutputUsedAsInput_1 },
+	{ 0xAA36A1DE, 0, 0x8897810F, LES_Stub_LES_Test_OutputNameIDNotFound_0 },
+	{ 0xAC913249, 0, 0x00000004, LES_Stub_LES_Test_InputTypeHashIsWrong_0 },
+	{ 0xB159FFBA, 0, 0x00000003, LES_Stub_LES_Test_DecodeInputArrayReference_0 },
+	{ 0xB159FFBA, 1, 0x000DB63C, LES_Stub_LES_Test_DecodeInputArrayReference_1 },
+	{ 0xBD0F575F, 0, 0xCCC79A05, LES_Stub_LES_Test_DecodeOutputArrayPOD_0 },
+	{ 0xBD0F575F, 1, 0x03A3EE1A, LES_Stub_LES_Test_DecodeOutputArrayPOD_1 },
+	{ 0xC00B30C9, 0, 0x000FFF43, LES_Stub_LES_Test_TooManyInputParameters_0 },
+	{ 0xC00B30C9, 1, 0x000FFF43, LES_Stub_LES_Test_TooManyInputParameters_1 },
+	{ 0xC00B30C9, 2, 0x8897810F, LES_Stub_LES_Test_TooManyInputParameters_2 },
+	{ 0xC42F88CB, 0, 0x000FFF43, LES_Stub_LES_Test_ReferenceInputPODParam_0 },
+	{ 0xC8178E0D, 0, 0x00000001, LES_Stub_LES_Test_DecodeOutputParameters_0 },
+	{ 0xD12D98A0, 0, 0x8897810F, LES_Stub_LES_Test_OutputNameDoesntExist_0 },
+	{ 0xD2660EC3, 0, 0xB29CEA9C, LES_Stub_LES_Test_StructOutputParam_0 },
+	{ 0xD2660EC3, 1, 0x3175E390, LES_Stub_LES_Test_StructOutputParam_1 },
+	{ 0xD300F09C, 0, 0xD94D6FB8, LES_Stub_LES_Test_DecodeInputStructStructArrayReference_0 },
+	{ 0xD568290D, 0, 0x000FFF43, LES_Stub_jakeInit_0 },
+	{ 0xD568290D, 1, 0x000DB638, LES_Stub_jakeInit_1 },
+	{ 0xD568290D, 2, 0x888C13E2, LES_Stub_jakeInit_2 },
+	{ 0xD67C8DF1, 0, 0x000FFF43, LES_Stub_LES_Test_InputNameStringIsWrong_0 },
+	{ 0xDAAFC49F, 0, 0x000FFF43, LES_Stub_LES_Test_ReadInputOutputParameters_0 },
+	{ 0xDAAFC49F, 1, 0x8897810F, LES_Stub_LES_Test_ReadInputOutputParameters_1 },
+	{ 0xDAAFC49F, 2, 0x000DB638, LES_Stub_LES_Test_ReadInputOutputParameters_2 },
+	{ 0xDAAFC49F, 3, 0x88953804, LES_Stub_LES_Test_ReadInputOutputParameters_3 },
+	{ 0xDAAFC49F, 4, 0x00000001, LES_Stub_LES_Test_ReadInputOutputParameters_4 },
+	{ 0xDAAFC49F, 5, 0x888781CD, LES_Stub_LES_Test_ReadInputOutputParameters_5 },
+	{ 0xDAAFC49F, 6, 0x00049216, LES_Stub_LES_Test_ReadInputOutputParameters_6 },
+	{ 0xDAAFC49F, 7, 0x888C13E2, LES_Stub_LES_Test_ReadInputOutputParameters_7 },
+	{ 0xDAAFC49F, 8, 0x8897810F, LES_Stub_LES_Test_ReadInputOutputParameters_8 },
+	{ 0xDDD35940, 0, 0x00000001, LES_Stub_LES_Test_ReferenceOutputPODParam_0 },
+	{ 0xE3FEADA3, 0, 0x000FFF43, LES_Stub_LES_Test_InputNameIDNotFound_0 },
+	{ 0xE7202BF5, 0, 0x000DB638, LES_Stub_LES_Test_InputOutputMixture_0 },
+	{ 0xE7202BF5, 1, 0x8897810F, LES_Stub_LES_Test_InputOutputMixture_1 },
+	{ 0xE7202BF5, 2, 0x00000001, LES_Stub_LES_Test_InputOutputMixture_2 },
+	{ 0xE7202BF5, 3, 0x88953804, LES_Stub_LES_Test_InputOutputMixture_3 },
+	{ 0xEE552B25, 0, 0x000FFF43, LES_Stub_LES_Test_OutputGlobalIndexIsWrong_0 },
+	{ 0xEE552B25, 1, 0x8897810F, LES_Stub_LES_Test_OutputGlobalIndexIsWrong_1 },
+	{ 0xF15165AA, 0, 0x8897810F, LES_Stub_LES_Test_OutputNameStringIsWrong_0 },
+	{ 0xF5729336, 0, 0x000FFF43, LES_Stub_LES_Test_TooManyOutputParameters_0 },
+	{ 0xF5729336, 1, 0x8897810F, LES_Stub_LES_Test_TooManyOutputParameters_1 },
+	{ 0xF5729336, 2, 0x88953804, LES_Stub_LES_Test_TooManyOutputParameters_2 },
+	{ 0xF5B73E5A, 0, 0x6E8A49CB, LES_Stub_LES_Test_DecodeInputStructPODArrayReference_0 },
+	{ 0xFD4C0933, 0, 0x000DB648, LES_Stub_LES_Test_DecodeInputStructStructArray_0 },
+	{ 0x00000000, -1, 0x00000000, LES_NULL }
+};
+
+const int les_numParameterStubs = 123;
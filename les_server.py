@@ -11,12 +11,21 @@ import les_hash
 import les_definitionfile
 import les_logger
 import les_funcdata
+import les_compress
 
 packedUint16 = struct.Struct(">H")
 packedUint32 = struct.Struct(">I")
+packedInt32 = struct.Struct(">i")
 
 s_DecodeLogChannel = les_logger.CreateChannel("Decode", "", "decode_py.txt", les_logger.LES_LOGGERCHANNEL_FLAGS_FILE_OUTPUT)
 
+# Compressed payloads: the flag is set in payloadSize, the payload is the uncompressed size then the les_compress block
+LES_NETWORK_MESSAGE_COMPRESSED=0x80000000
+LES_NETWORK_MESSAGE_PAYLOAD_SIZE_MASK=0x7FFFFFFF
+LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE=4
+LES_NETWORK_COMPRESS_MIN_PAYLOAD_SIZE=1024
+LES_NETWORK_MAX_RECEIVE_SIZE=128*1024
+
 class LES_NetworkMessage():
 	def __init__(self):
 		self.m_type = -1
@@ -39,14 +48,44 @@ class LES_NetworkMessage():
 			self.m_valid = True
 		if messageDataLen > 8:
 			self.m_payload = messageData[8:messageDataLen]
+		if self.m_valid and (self.m_payloadSize & LES_NETWORK_MESSAGE_COMPRESSED):
+			return self.Decompress()
+		return self.m_valid
+
+	def Decompress(self):
+		self.m_valid = False
+		compressedData = self.m_payload
+		if (compressedData == None) or (len(compressedData) < LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE):
+			return False
+		payloadSize = packedUint32.unpack(compressedData[0:LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE])[0]
+		compressedSize = (self.m_payloadSize & LES_NETWORK_MESSAGE_PAYLOAD_SIZE_MASK) - LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE
+		compressedData = compressedData[LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE:LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE+compressedSize]
+		payload = les_compress.LES_DecompressBlock(compressedData, payloadSize)
+		if (payload == None) or (len(payload) != payloadSize):
+			return False
+		self.m_payloadSize = payloadSize
+		self.m_payload = payload
+		self.m_valid = True
 		return self.m_valid
 
-def LES_CreateNetworkMessage(typeValue, idValue, payload):
+# Size the client sends for a message : it pads the payload to 4 bytes (minimum 4 bytes) like LES_NetworkMessageSize
+def LES_NetworkMessageSentSize(payloadSize):
+	return 8 + max(4, (payloadSize + 3) & ~3)
+
+# Large payloads are compressed if compress is True and it makes them smaller
+def LES_CreateNetworkMessage(typeValue, idValue, payload, compress=False):
 	# Needs to do memory padding like the client does on its sending
 	payloadSize = 0
 	if payload != None:
 		payloadSize = len(payload)
 
+	if compress and (payloadSize >= LES_NETWORK_COMPRESS_MIN_PAYLOAD_SIZE) and (payloadSize <= LES_NETWORK_MAX_RECEIVE_SIZE - 8):
+		compressedData = les_compress.LES_CompressBlock(payload)
+		if (LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE + len(compressedData)) < payloadSize:
+			les_logger.Log("Compressed payload %d -> %d" % (payloadSize, LES_NETWORK_MESSAGE_COMPRESSED_HEADER_SIZE + len(compressedData)))
+			payload = packedUint32.pack(payloadSize) + compressedData
+			payloadSize = len(payload) | LES_NETWORK_MESSAGE_COMPRESSED
+
 	packetData = ""
 	packetData += packedUint16.pack(typeValue)
 	packetData += packedUint16.pack(idValue)
@@ -59,12 +98,31 @@ def LES_CreateNetworkMessage(typeValue, idValue, payload):
 LES_NETMESSAGE_RECV_ID_CONNECT=0x1
 LES_NETMESSAGE_RECV_ID_GETDEFINITIONFILE=0x3
 LES_NETMESSAGE_RECV_ID_FUNCTIONRPC=0x5
+LES_NETMESSAGE_RECV_ID_FUNCTIONRPC_BATCH=0x7
+LES_NETMESSAGE_RECV_ID_FUNCTIONRPC_DELTA=0x9
 LES_NETMESSAGE_RECV_ID_TEST=0xF1
 
 LES_NETMESSAGE_SEND_ID_CONNECT_RESPONSE=0x2
 LES_NETMESSAGE_SEND_ID_GETDEFINITIONFILE_RESPONSE=0x4
 LES_NETMESSAGE_SEND_ID_FUNCTIONRPC_RESPONSE=0x6
 LES_NETMESSAGE_SEND_ID_TEST_RESPONSE=0xF2
+LES_NETMESSAGE_SEND_ID_FUNCTIONRPC_RESULT=0x1000+LES_NETMESSAGE_RECV_ID_FUNCTIONRPC
+
+LES_RETURN_OK=1
+LES_RETURN_ERROR=-1
+
+# Connect: 16 character challenge then an optional byte order marker in the client byte order then optional encoding flags
+# Connect response: hash of the challenge then the parameter data byte order then the accepted encoding flags
+LES_CONNECT_CHALLENGE_SIZE=16
+LES_CONNECT_BYTEORDER_MARKER=0x01020304
+LES_CONNECT_BYTEORDER_BIG_ENDIAN=0
+LES_CONNECT_BYTEORDER_NATIVE_ENDIAN=1
+LES_CONNECT_ENCODING_VARINT=(1 << 0)
+LES_CONNECT_ENCODING_COMPRESSION=(1 << 1)
+
+# Delta data: parameterDataSize, a bitmap with a bit per changed parameter data byte, then the changed bytes
+LES_FUNCTIONRPC_BATCH_RECORD_DELTA=0x80000000
+LES_FUNCTIONRPC_DELTA_HEADER_SIZE=4
 
 s_enableDebugSleep = 0
 
@@ -86,10 +144,33 @@ class ThreadedTCPRequestHandler(SocketServer.BaseRequestHandler):
 
 	def LES_HandleConnectMessage(self, msgType, msgId, msgPayloadSize, msgPayload):
 		les_logger.Log("Connect: type:0x%X id:%d payloadSize:%d" % (msgType, msgId, msgPayloadSize))
-		les_logger.Log("Connect: payload:%s" % (msgPayload))
-		hashValue = les_hash.LES_GenerateHashCaseSensitive(msgPayload)
+		challenge = msgPayload[0:LES_CONNECT_CHALLENGE_SIZE]
+		les_logger.Log("Connect: payload:%s" % (challenge))
+		hashValue = les_hash.LES_GenerateHashCaseSensitive(challenge)
 		les_logger.Log("Connect: connectResponse:0x%X" % (hashValue))
 		payload = packedUint32.pack(hashValue)
+		# A connect starts a new delta history : the client sends keyframes after it
+		self.m_lastParameterData = {}
+		# Clients which send their byte order marker get native endian parameter data if it matches the server
+		self.m_parameterByteOrder = ">"
+		if len(msgPayload) >= LES_CONNECT_CHALLENGE_SIZE + 4:
+			byteOrder = LES_CONNECT_BYTEORDER_BIG_ENDIAN
+			marker = struct.unpack("=I", msgPayload[LES_CONNECT_CHALLENGE_SIZE:LES_CONNECT_CHALLENGE_SIZE+4])[0]
+			if marker == LES_CONNECT_BYTEORDER_MARKER:
+				byteOrder = LES_CONNECT_BYTEORDER_NATIVE_ENDIAN
+				self.m_parameterByteOrder = "="
+			les_logger.Log("Connect: byteOrder:%d" % (byteOrder))
+			payload += packedUint32.pack(byteOrder)
+		# Clients which send encoding flags get the ones the server supports
+		self.m_parameterVarint = False
+		self.m_sendCompression = False
+		if len(msgPayload) >= LES_CONNECT_CHALLENGE_SIZE + 8:
+			encodingFlags = packedUint32.unpack(msgPayload[LES_CONNECT_CHALLENGE_SIZE+4:LES_CONNECT_CHALLENGE_SIZE+8])[0]
+			encodingFlags &= (LES_CONNECT_ENCODING_VARINT | LES_CONNECT_ENCODING_COMPRESSION)
+			self.m_parameterVarint = (encodingFlags & LES_CONNECT_ENCODING_VARINT) != 0
+			self.m_sendCompression = (encodingFlags & LES_CONNECT_ENCODING_COMPRESSION) != 0
+			les_logger.Log("Connect: encodingFlags:0x%X" % (encodingFlags))
+			payload += packedUint32.pack(encodingFlags)
 		response = LES_CreateNetworkMessage(LES_NETMESSAGE_SEND_ID_CONNECT_RESPONSE, msgId, payload)
 		debugRandomSleep()
 		self.request.send(response)
@@ -102,7 +183,7 @@ class ThreadedTCPRequestHandler(SocketServer.BaseRequestHandler):
 		chunkFileData = self.s_definitionFile.makeData()
 		definitionFileData = chunkFileData.getData()
 		payload = definitionFileData
-		response = LES_CreateNetworkMessage(LES_NETMESSAGE_SEND_ID_GETDEFINITIONFILE_RESPONSE, msgId, payload)
+		response = LES_CreateNetworkMessage(LES_NETMESSAGE_SEND_ID_GETDEFINITIONFILE_RESPONSE, msgId, payload, self.m_sendCompression)
 		chunkFileData.close()
 		les_logger.Log("GetDefinitionFile: sending:%d" % (len(payload)))
 		debugRandomSleep()
@@ -113,15 +194,92 @@ class ThreadedTCPRequestHandler(SocketServer.BaseRequestHandler):
 		#les_logger.Log("FunctionRPC: payload:%s" % (msgPayload))
 		debugRandomSleep()
 		functionNameID = packedUint32.unpack(msgPayload[0:4])[0]
-		functionParameterData = les_funcdata.LES_FunctionParameterData(msgPayload[4:])
+		correlationID = packedUint32.unpack(msgPayload[4:8])[0]
+		self.LES_HandleFunctionRPC(msgId, correlationID, functionNameID, msgPayload[8:])
+
+	# Batch payload: numRecords then per record: functionNameID, correlationID, parameterDataSize, parameter data padded to 4 bytes
+	def LES_HandleFunctionRPCBatchMessage(self, msgType, msgId, msgPayloadSize, msgPayload):
+		les_logger.Log("FunctionRPCBatch: type:0x%X id:%d payloadSize:%d" % (msgType, msgId, msgPayloadSize))
+		debugRandomSleep()
+		numRecords = packedUint32.unpack(msgPayload[0:4])[0]
+		offset = 4
+		for i in range(numRecords):
+			if offset + 12 > len(msgPayload):
+				les_logger.Error("FunctionRPCBatch: id:%d record[%d] truncated offset:%d payloadSize:%d", msgId, i, offset, len(msgPayload))
+				return
+			functionNameID = packedUint32.unpack(msgPayload[offset+0:offset+4])[0]
+			correlationID = packedUint32.unpack(msgPayload[offset+4:offset+8])[0]
+			recordSizeField = packedUint32.unpack(msgPayload[offset+8:offset+12])[0]
+			recordDataSize = recordSizeField & ~LES_FUNCTIONRPC_BATCH_RECORD_DELTA
+			offset += 12
+			parameterData = msgPayload[offset:offset+recordDataSize]
+			offset += (recordDataSize + 3) & ~3
+			if recordSizeField & LES_FUNCTIONRPC_BATCH_RECORD_DELTA:
+				parameterData = self.LES_ApplyFunctionRPCDelta(msgId, functionNameID, parameterData)
+				if parameterData == None:
+					self.LES_SendFunctionRPCResult(msgId, correlationID, LES_RETURN_ERROR)
+					continue
+			self.LES_HandleFunctionRPC(msgId, correlationID, functionNameID, parameterData)
+
+	# Delta payload: functionNameID, correlationID then the delta data
+	def LES_HandleFunctionRPCDeltaMessage(self, msgType, msgId, msgPayloadSize, msgPayload):
+		les_logger.Log("FunctionRPCDelta: type:0x%X id:%d payloadSize:%d" % (msgType, msgId, msgPayloadSize))
+		debugRandomSleep()
+		functionNameID = packedUint32.unpack(msgPayload[0:4])[0]
+		correlationID = packedUint32.unpack(msgPayload[4:8])[0]
+		parameterData = self.LES_ApplyFunctionRPCDelta(msgId, functionNameID, msgPayload[8:])
+		if parameterData == None:
+			self.LES_SendFunctionRPCResult(msgId, correlationID, LES_RETURN_ERROR)
+			return
+		self.LES_HandleFunctionRPC(msgId, correlationID, functionNameID, parameterData)
+
+	# Returns the parameter data made from the last parameter data received for the function or None
+	def LES_ApplyFunctionRPCDelta(self, msgId, functionNameID, deltaData):
+		if functionNameID not in self.m_lastParameterData:
+			les_logger.Error("FunctionRPCDelta: id:%d nameID:%d no keyframe received", msgId, functionNameID)
+			return None
+		lastParameterData = self.m_lastParameterData[functionNameID]
+		parameterDataSize = packedUint32.unpack(deltaData[0:LES_FUNCTIONRPC_DELTA_HEADER_SIZE])[0]
+		if parameterDataSize != len(lastParameterData):
+			les_logger.Error("FunctionRPCDelta: id:%d nameID:%d parameterDataSize:%d doesn't match keyframe size:%d", 
+											msgId, functionNameID, parameterDataSize, len(lastParameterData))
+			return None
+		bitmapSize = (parameterDataSize + 7) >> 3
+		bitmap = deltaData[LES_FUNCTIONRPC_DELTA_HEADER_SIZE:LES_FUNCTIONRPC_DELTA_HEADER_SIZE+bitmapSize]
+		changedOffset = LES_FUNCTIONRPC_DELTA_HEADER_SIZE + bitmapSize
+		parameterData = list(lastParameterData)
+		for i in range(parameterDataSize):
+			if ord(bitmap[i >> 3]) & (1 << (i & 7)):
+				if changedOffset >= len(deltaData):
+					les_logger.Error("FunctionRPCDelta: id:%d nameID:%d delta data truncated", msgId, functionNameID)
+					return None
+				parameterData[i] = deltaData[changedOffset]
+				changedOffset += 1
+		return "".join(parameterData)
+
+	# Result payload: correlationID, result, outputDataSize, output parameter data in parameter order
+	def LES_SendFunctionRPCResult(self, msgId, correlationID, result, outputData=""):
+		payload = packedUint32.pack(correlationID) + packedInt32.pack(result) + packedUint32.pack(len(outputData)) + outputData
+		response = LES_CreateNetworkMessage(LES_NETMESSAGE_SEND_ID_FUNCTIONRPC_RESULT, msgId, payload, self.m_sendCompression)
+		self.request.send(response)
+
+	def LES_HandleFunctionRPC(self, msgId, correlationID, functionNameID, parameterData):
+		# Later deltas for the function are made against this parameter data
+		self.m_lastParameterData[functionNameID] = parameterData
+		functionParameterData = les_funcdata.LES_FunctionParameterData(parameterData, self.m_parameterByteOrder, self.m_parameterVarint)
 
 		stringTable = self.s_definitionFile.getStringTable()
 		typeData = self.s_definitionFile.getTypeData()
 		structData = self.s_definitionFile.getStructData()
 		functionData = self.s_definitionFile.getFunctionData()
 		functionName = stringTable.getString(functionNameID)
-		les_logger.Log("FunctionRPC: id:%d nameID:%d '%s'" % (msgId, functionNameID, functionName))
+		les_logger.Log("FunctionRPC: id:%d correlationID:%d nameID:%d '%s'" % (msgId, correlationID, functionNameID, functionName))
 		functionDefinition = functionData.getFunctionDefinition(functionName)
+		if functionDefinition == None:
+			les_logger.Error("FunctionRPC: id:%d nameID:%d function definition not found", msgId, functionNameID)
+			self.LES_SendFunctionRPCResult(msgId, correlationID, LES_RETURN_ERROR)
+			return
+
 		(retVal, paramDict) = functionDefinition.Decode(s_DecodeLogChannel, stringTable, typeData, structData, functionParameterData)
 		if retVal == les_funcdata.LES_RETURN_ERROR:
 			les_logger.Error("FunctionRPC: ERROR during Decode()")
@@ -259,26 +417,71 @@ class ThreadedTCPRequestHandler(SocketServer.BaseRequestHandler):
 			les_logger.Log("%s: output_2:%c output_value_2:%c", testFuncName, output_2, output_value_2);
 			les_logger.Log("%s: output_3:%f output_value_3:%f", testFuncName, output_3, output_value_3);
 
+		# Byte i of input_1 is (input_0 + (i >> 4)) & 0xFF : the whole array must have arrived in order
+		if (functionName == "LES_Test_LargeInput") and (retVal == les_funcdata.LES_RETURN_OK):
+			input_0 = int(paramDict['input_0'])
+			input_1 = functionParameterData.GetParameterBytes(1)
+			for i in range(len(input_1)):
+				if ord(input_1[i]) != ((input_0 + (i >> 4)) & 0xFF):
+					les_logger.Warning("%s: parameter data is wrong input_1[%d]:%d", functionName, i, ord(input_1[i]))
+					retVal = les_funcdata.LES_RETURN_ERROR
+					break
+
+		# The test server returns the output parameters with the values the client sent
+		outputData = ""
+		result = LES_RETURN_ERROR
+		if retVal == les_funcdata.LES_RETURN_OK:
+			result = LES_RETURN_OK
+			for i in range(functionDefinition.GetNumParameters()):
+				functionParameter = functionDefinition.GetParameterByIndex(i)
+				if functionParameter.m_mode == les_funcdata.LES_PARAM_MODE_OUTPUT:
+					outputData += functionParameterData.GetParameterBytes(i)
+		self.LES_SendFunctionRPCResult(msgId, correlationID, result, outputData)
+
 	def handle(self):
 		s_receivedMessageHandlers = {}
 		s_receivedMessageHandlers[LES_NETMESSAGE_RECV_ID_TEST] = self.LES_HandleTestMessage
 		s_receivedMessageHandlers[LES_NETMESSAGE_RECV_ID_CONNECT] = self.LES_HandleConnectMessage
 		s_receivedMessageHandlers[LES_NETMESSAGE_RECV_ID_GETDEFINITIONFILE] = self.LES_HandleGetDefinitionFileMessage
 		s_receivedMessageHandlers[LES_NETMESSAGE_RECV_ID_FUNCTIONRPC] = self.LES_HandleFunctionRPCMessage
+		s_receivedMessageHandlers[LES_NETMESSAGE_RECV_ID_FUNCTIONRPC_BATCH] = self.LES_HandleFunctionRPCBatchMessage
+		s_receivedMessageHandlers[LES_NETMESSAGE_RECV_ID_FUNCTIONRPC_DELTA] = self.LES_HandleFunctionRPCDeltaMessage
 
 		self.s_definitionFile = None
+		self.m_parameterByteOrder = ">"
+		self.m_parameterVarint = False
+		self.m_sendCompression = False
+		self.m_lastParameterData = {}
 		self.m_curThread = threading.currentThread()
 		self.m_threadName = self.m_curThread.getName()
 
+		# A recv() can return several messages or part of a message
+		receivedData = ""
 		while (1):
- 			receivedData = self.request.recv(100*1024)
-			receivedDataLen = len(receivedData)
-			if receivedDataLen == 0:
-				time.sleep(0.001)
+			if len(receivedData) < 8:
+				newData = self.request.recv(100*1024)
+				if len(newData) == 0:
+					time.sleep(0.001)
+					continue
+				receivedData += newData
 				continue
 
+			messagePayloadSize = packedUint32.unpack(receivedData[4:8])[0] & LES_NETWORK_MESSAGE_PAYLOAD_SIZE_MASK
+			messageSize = LES_NetworkMessageSentSize(messagePayloadSize)
+			if len(receivedData) < messageSize:
+				newData = self.request.recv(100*1024)
+				if len(newData) == 0:
+					time.sleep(0.001)
+					continue
+				receivedData += newData
+				continue
+
+			messageData = receivedData[0:8+messagePayloadSize]
+			receivedData = receivedData[messageSize:]
+			receivedDataLen = len(messageData)
+
 			receivedMessage = LES_NetworkMessage()
-			if receivedMessage.Decode(receivedData) == False:
+			if receivedMessage.Decode(messageData) == False:
 				les_logger.Warning("%s: Failed to decode message receivedDataLen:%d" % (self.m_threadName, receivedDataLen))
 				continue
 
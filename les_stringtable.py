@@ -62,10 +62,13 @@ class LES_StringTable():
 		return None
 
 	def getHash(self, index):
-		if index < len(self.hashes):
+		if index < len(self.__m_stringTableEntries__):
 			return self.__m_stringTableEntries__[index].hashValue
 		return -1
 
+	def getNumStrings(self):
+		return len(self.__m_strings__)
+
 	def getStringID(self, string):
 		index = -1
 		try:
@@ -8,6 +8,8 @@
 #include "les_stringentry.h"
 #include "les_structdata.h"
 #include "les_type.h"
+#include "les_hashindex.h"
+#include "les_hashdata.h"
 
 static const LES_StructDefinition** les_structDefinitionArray = LES_NULL;
 static int les_numStructDefinitions = 0;
@@ -15,9 +17,20 @@ static int les_numStructDefinitions = 0;
 static const LES_StructData* les_pStructData = LES_NULL;
 static int les_structDataNumStructDefinitions = 0;
 
+/* Perfect hash of the definition file struct data : NULL if the definition file doesn't have one */
+static const LES_HashTable* les_pStructDataHashTable = LES_NULL;
+
+/* Struct definition IDs by name hash : the internal list and the definition file struct data if it isn't perfect hashed */
+static LES_HashIndex les_structDefinitionIndex;
+
+extern int LES_Type_SetTrivialFlags(const LES_TypeEntry* const typeEntryPtr, const LES_uint32 trivialFlags);
+
 void LES_DebugOutputStructDefinition(LES_LoggerChannel* const pLogChannel, 
 																		 const LES_StructDefinition* const pStructDefinition, const int i);
 
+extern void LES_Type_SetStructDefinition(const LES_StructDefinition* const structDefinitionPtr);
+extern void LES_Function_BumpDefinitionGeneration(void);
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Internal Static functions
@@ -26,26 +39,17 @@ void LES_DebugOutputStructDefinition(LES_LoggerChannel* const pLogChannel,
 
 static int LES_GetStructDefinitionIndex(const LES_Hash nameHash)
 {
-	if (les_pStructData)
+	if (les_pStructDataHashTable)
 	{
-		const int index = les_pStructData->GetStructDefinitionIndex(nameHash);
-		if (index >= 0)
+		const int index = les_pStructDataHashTable->Find(nameHash);
+		const int nameID = les_pStructData->GetStructDefinition(index)->GetNameID();
+		if (LES_GetStringEntryForID(nameID)->m_hash == nameHash)
 		{
 			return index;
 		}
 	}
-
-	/* This is horribly slow - need hash lookup table */
-	for (int i = 0; i < les_numStructDefinitions; i++)
-	{
-		const LES_StructDefinition* const structDefinitionPtr = les_structDefinitionArray[i];
-		const LES_StringEntry* const structNameStringEntryPtr = LES_GetStringEntryForID(structDefinitionPtr->GetNameID());
-		if (structNameStringEntryPtr->m_hash == nameHash)
-		{
-			return i + les_structDataNumStructDefinitions;
-		}
-	}
-	return -1;
+	int slot;
+	return les_structDefinitionIndex.Find(nameHash, &slot);
 }
 
 static const LES_StructDefinition* LES_GetStructDefinitionForID(const int id)
@@ -65,6 +69,71 @@ static const LES_StructDefinition* LES_GetStructDefinitionForID(const int id)
 	return pStructDefinition;
 }
 
+/* 
+ * The wire layout of a struct is its members without the alignment padding : it is the memory layout if
+ * every member is a POD, an inline array of PODs or a trivially serialisable struct, there is no padding
+ * and the members fill the struct. Nested structs must already have their flags computed.
+*/
+static LES_uint32 LES_StructComputeTrivialFlags(const LES_StructDefinition* const structDefinitionPtr, 
+																								const LES_TypeEntry* const structTypeEntryPtr)
+{
+	LES_uint32 trivialFlags = LES_TYPE_TRIVIAL_NATIVE | LES_TYPE_TRIVIAL;
+	int totalMemberSize = 0;
+	const int numMembers = structDefinitionPtr->GetNumMembers();
+	for (int i = 0; i < numMembers; i++)
+	{
+		const LES_StructMember* const structMember = structDefinitionPtr->GetMemberByIndex(i);
+		if (structMember->m_alignmentPadding != 0)
+		{
+			return 0;
+		}
+		const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntryForStringID(structMember->m_typeID);
+		if (memberTypeEntryPtr == LES_NULL)
+		{
+			return 0;
+		}
+		if (memberTypeEntryPtr->m_flags & (LES_TYPE_POINTER | LES_TYPE_REFERENCE | LES_TYPE_VARIABLE_SIZE))
+		{
+			return 0;
+		}
+		const LES_TypeEntry* const rootTypeEntryPtr = memberTypeEntryPtr->GetRootType();
+		if (rootTypeEntryPtr == LES_NULL)
+		{
+			return 0;
+		}
+		const LES_uint32 rootFlags = rootTypeEntryPtr->m_flags;
+		if (rootFlags & LES_TYPE_STRUCT)
+		{
+			trivialFlags &= rootTypeEntryPtr->GetTrivialFlags();
+		}
+		else if ((rootFlags & LES_TYPE_POD) == 0)
+		{
+			return 0;
+		}
+		else if (rootFlags & LES_TYPE_ENDIANSWAP)
+		{
+			trivialFlags &= ~(LES_uint32)LES_TYPE_TRIVIAL;
+		}
+		totalMemberSize += structMember->m_dataSize;
+	}
+	if (totalMemberSize != (int)structTypeEntryPtr->m_dataSize)
+	{
+		return 0;
+	}
+	return trivialFlags & (LES_TYPE_TRIVIAL_NATIVE | LES_TYPE_TRIVIAL);
+}
+
+static int LES_StructSetTrivialFlags(const LES_StructDefinition* const structDefinitionPtr)
+{
+	const LES_TypeEntry* const structTypeEntryPtr = LES_GetTypeEntryForStringID(structDefinitionPtr->GetNameID());
+	if (structTypeEntryPtr == LES_NULL)
+	{
+		return 0;
+	}
+	const LES_uint32 trivialFlags = LES_StructComputeTrivialFlags(structDefinitionPtr, structTypeEntryPtr);
+	return (LES_Type_SetTrivialFlags(structTypeEntryPtr, trivialFlags) == 1) ? 1 : 0;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // External Public functions
@@ -134,6 +203,8 @@ void LES_StructInit()
 {
 	les_structDefinitionArray = new const LES_StructDefinition*[1024];
 	les_numStructDefinitions = 0;
+	les_structDefinitionIndex.Clear();
+	les_structDefinitionIndex.Reserve(1024);
 }
 
 void LES_StructShutdown()
@@ -146,6 +217,7 @@ void LES_StructShutdown()
 		free(memoryPtr);
 	}
 	delete[] les_structDefinitionArray;
+	les_structDefinitionIndex.Free();
 }
 
 int LES_AddStructDefinition(const char* const name, const LES_StructDefinition* const structDefinitionPtr, 
@@ -179,16 +251,15 @@ int LES_AddStructDefinition(const char* const name, const LES_StructDefinition*
 		index = les_numStructDefinitions;
 		les_structDefinitionArray[index] = structDefinitionPtr;
 		les_numStructDefinitions++;
+		index += les_structDataNumStructDefinitions;
+		les_structDefinitionIndex.Add(nameHash, index);
+		LES_Function_BumpDefinitionGeneration();
+		LES_Type_SetStructDefinition(structDefinitionPtr);
+		LES_StructSetTrivialFlags(structDefinitionPtr);
 	}
 	else
 	{
-		int i = index;
-		if (les_pStructData)
-		{
-			i = les_pStructData->GetStructDefinitionIndex(nameHash);
-		}
-		const LES_StructDefinition* const pStructDefinition = les_pStructData ? 
-																	les_pStructData->GetStructDefinition(i) : LES_GetStructDefinitionForID(index);
+		const LES_StructDefinition* const pStructDefinition = LES_GetStructDefinitionForID(index);
 		if (pStructDefinition->GetNameID() != structDefinitionPtr->GetNameID())
 		{
 			LES_WARNING("LES_AddStructDefinition '%s' hash 0x%X already in list and nameID doesn't match Existing:%d New:%d",
@@ -325,10 +396,58 @@ void LES_DebugOutputStructDefinition(LES_LoggerChannel* const pLogChannel, const
 	}
 }
 
-void LES_Struct_SetStructDataPtr(const LES_StructData* const pStructData)
+/* Called by LES_AddType when a struct type entry is added after its struct definition */
+void LES_Struct_SetTrivialFlags(const LES_StructDefinition* const structDefinitionPtr)
+{
+	LES_StructSetTrivialFlags(structDefinitionPtr);
+}
+
+void LES_Struct_SetStructDataPtr(const LES_StructData* const pStructData, const LES_HashTable* const pHashTable)
 {
 	les_pStructData = pStructData;
 	const int numStructDefintiions = pStructData->GetNumStructDefinitions();
 	les_structDataNumStructDefinitions = numStructDefintiions;
+	les_pStructDataHashTable = pHashTable;
+	LES_Function_BumpDefinitionGeneration();
+
+	/* The internal struct definition IDs are after the struct data */
+	les_structDefinitionIndex.Clear();
+	if (pHashTable == LES_NULL)
+	{
+		les_structDefinitionIndex.Reserve(numStructDefintiions + les_numStructDefinitions);
+		for (int i = 0; i < numStructDefintiions; i++)
+		{
+			const int nameID = pStructData->GetStructDefinition(i)->GetNameID();
+			les_structDefinitionIndex.Add(LES_GetStringEntryForID(nameID)->m_hash, i);
+		}
+	}
+	for (int i = 0; i < les_numStructDefinitions; i++)
+	{
+		const int nameID = les_structDefinitionArray[i]->GetNameID();
+		les_structDefinitionIndex.Add(LES_GetStringEntryForID(nameID)->m_hash, i + numStructDefintiions);
+	}
+
+	for (int i = 0; i < numStructDefintiions; i++)
+	{
+		LES_Type_SetStructDefinition(pStructData->GetStructDefinition(i));
+	}
+	for (int i = 0; i < les_numStructDefinitions; i++)
+	{
+		LES_Type_SetStructDefinition(les_structDefinitionArray[i]);
+	}
+
+	/* Nested structs can be defined after the structs which use them : repeat until nothing changes */
+	for (int pass = 0; pass < numStructDefintiions; pass++)
+	{
+		int numChanged = 0;
+		for (int i = 0; i < numStructDefintiions; i++)
+		{
+			numChanged += LES_StructSetTrivialFlags(pStructData->GetStructDefinition(i));
+		}
+		if (numChanged == 0)
+		{
+			break;
+		}
+	}
 }
 
@@ -209,6 +209,12 @@ class LES_StructData():
 			return None
 		return self.__m_structDefinitions__[index]
 
+	def getNumStructDefinitions(self):
+		return len(self.__m_structDefinitions__)
+
+	def getStructDefinitionByIndex(self, index):
+		return self.__m_structDefinitions__[index]
+
 	def write(self, binFile):
 		basePosition = binFile.getIndex()
 		# LES_StructData
@@ -474,10 +480,19 @@ def ComputeAlignment(typeEntry, stringTable, typeData, structData):
 #	les_logger.Log("Compute Alignment Type 0x%X alignment:%d", typeEntry.m_hash, alignment)
 	return alignment
 
-def ComputeDataStorageSize(typeEntry, stringTable, typeData, structData):
+# minimum is the size when every variable sized type is empty : otherwise it is the maximum size
+def ComputeDataStorageSize(typeEntry, stringTable, typeData, structData, minimum=False):
 	this = typeEntry
 	flags = typeEntry.m_flags
 	numElements = typeEntry.m_numElements
+
+	# The count is always written : the maximum number of items follow it
+	countSize = 0
+	if flags & les_typedata.LES_TYPE_VARIABLE_SIZE:
+		if minimum:
+			return les_typedata.LES_TYPE_COUNT_SIZE
+		countSize = les_typedata.LES_TYPE_COUNT_SIZE
+
 	typeEntry = typeEntry.GetRootType(stringTable, typeData)
 	flags = typeEntry.m_flags
 
@@ -494,7 +509,7 @@ def ComputeDataStorageSize(typeEntry, stringTable, typeData, structData):
 			memberTypeID = structMember.m_typeID
 			memberTypeString = stringTable.getString(memberTypeID)
 			memberTypeEntry = typeData.getTypeData(memberTypeString)
-			dataSize = ComputeDataStorageSize(memberTypeEntry, stringTable, typeData, structData)
+			dataSize = ComputeDataStorageSize(memberTypeEntry, stringTable, typeData, structData, minimum)
 			if dataSize == -1:
 				return -1
 			totalDataSize += dataSize
@@ -502,14 +517,14 @@ def ComputeDataStorageSize(typeEntry, stringTable, typeData, structData):
 		if numElements > 1:
 #			les_logger.Log("Struct Type:0x%X Size:%d NumELements:%d", typeEntry.m_hash, totalDataSize, numElements)
 			totalDataSize *= numElements
-		return totalDataSize
+		return countSize + totalDataSize
 
 	dataSize = typeEntry.m_dataSize
 	if numElements > 1:
 #		les_logger.Log("POD 0x%X Type:0x%X Size:%d NumELements:%d", this.m_hash, typeEntry.m_hash, dataSize, numElements)
 		dataSize *= numElements
 
-	return dataSize
+	return countSize + dataSize
 
 def StructComputeAlignmentPadding(totalMemberSize, memberDataSize):
 	memberAlignmentSizeMinus1 = memberDataSize - 1
@@ -0,0 +1,313 @@
+#!/usr/bin/python
+
+import sys
+import ctypes
+
+import les_hash
+import les_definitionfile
+import les_typedata
+import les_logger
+
+# Generates les_parameterstubdata.cpp : one straight-line serialiser per function parameter
+# Each stub is the unrolled form of the plan LES_CreateFunctionPlan compiles for the parameter
+# Struct layouts are inlined into the parameter stubs so contiguous member copies merge into a single memcpy
+# The layout hash of the ops is stored with the stub : the client only uses a stub if its own plan has the same hash
+
+# Must match les_parameterplan.h & les_parameterplan.cpp
+LES_PLAN_OP_COPY 		= 0
+LES_PLAN_OP_SWAP16 	= 1
+LES_PLAN_OP_SWAP32 	= 2
+LES_PLAN_OP_SWAP64 	= 3
+LES_PLAN_OP_DEREF 	= 4
+LES_PLAN_OP_POP 		= 5
+LES_PLAN_OP_INT16 	= 6
+LES_PLAN_OP_INT32 	= 7
+LES_PLAN_OP_INT64 	= 8
+
+LES_PLAN_MAX_DEPTH = 16
+LES_PLAN_MAX_NUM_OPS = 4096
+
+# Must match les_parameter.h : large copies are recorded as references by the plan instead of being copied
+LES_PARAMETER_REFERENCE_MIN_SIZE = 4096
+
+class LES_PlanCompileState():
+	def __init__(self):
+		self.m_ops = []
+		self.m_depth = 0
+
+def ComputeLayoutHash(ops):
+	# Same as LES_ComputePlanLayoutHash : hash = 387*hash + value
+	hashValue = 0
+	for op in ops:
+		for value in op:
+			hashValue = ctypes.c_uint32((hashValue * 387) + value).value
+	return hashValue
+
+def MakeIdentifier(string):
+	identifier = ""
+	for c in string:
+		if c.isalnum():
+			identifier += c
+		else:
+			identifier += "_"
+	return identifier
+
+class LES_StubGenerator():
+	def __init__(self, stringTable, typeData, structData, functionData):
+		self.__m_stringTable__ = stringTable
+		self.__m_typeData__ = typeData
+		self.__m_structData__ = structData
+		self.__m_functionData__ = functionData
+		self.__m_stubs__ = []
+		self.__m_stubNames__ = []
+
+	def getTypeEntry(self, typeID):
+		typeName = self.__m_stringTable__.getString(typeID)
+		if typeName == None:
+			return None
+		return self.__m_typeData__.getTypeData(typeName)
+
+	# Mirrors LES_PlanAddOp
+	def addOp(self, state, opcode, offset, size):
+		# Merge contiguous copies into a single copy and contiguous swaps of the same width into an array swap
+		canMerge = opcode in (LES_PLAN_OP_COPY, LES_PLAN_OP_SWAP16, LES_PLAN_OP_SWAP32, LES_PLAN_OP_SWAP64,
+													LES_PLAN_OP_INT16, LES_PLAN_OP_INT32, LES_PLAN_OP_INT64)
+		if canMerge and (len(state.m_ops) > 0):
+			lastOp = state.m_ops[-1]
+			if (lastOp[0] == opcode) and ((lastOp[1] + lastOp[2]) == offset):
+				state.m_ops[-1] = (opcode, lastOp[1], lastOp[2] + size)
+				return True
+		if len(state.m_ops) >= LES_PLAN_MAX_NUM_OPS:
+			return False
+		if opcode == LES_PLAN_OP_DEREF:
+			if state.m_depth >= LES_PLAN_MAX_DEPTH:
+				return False
+			state.m_depth += 1
+		elif opcode == LES_PLAN_OP_POP:
+			state.m_depth -= 1
+		state.m_ops.append((opcode, offset, size))
+		return True
+
+	# Mirrors LES_PlanCompileItem
+	def compileItem(self, state, inputTypeEntry, offset):
+		typeEntry = inputTypeEntry.GetRootType(self.__m_stringTable__, self.__m_typeData__)
+		if typeEntry == None:
+			return False
+		typeFlags = typeEntry.m_flags
+		typeDataSize = typeEntry.m_dataSize
+
+		if typeFlags & les_typedata.LES_TYPE_STRUCT:
+			structDefinition = self.__m_structData__.getStructDefinitionByHash(typeEntry.m_hash)
+			if structDefinition == None:
+				return False
+			memberOffset = offset
+			for i in range(structDefinition.GetNumMembers()):
+				structMember = structDefinition.GetMemberByIndex(i)
+				memberTypeEntry = self.getTypeEntry(structMember.m_typeID)
+				if memberTypeEntry == None:
+					return False
+				memberOffset += structMember.m_alignmentPadding
+
+				memberFlags = memberTypeEntry.m_flags
+				isArray = (memberFlags & les_typedata.LES_TYPE_ARRAY) != 0
+				isPointer = (memberFlags & les_typedata.LES_TYPE_POINTER) != 0
+				isReference = (memberFlags & les_typedata.LES_TYPE_REFERENCE) != 0
+				# struct members which are pointers, references or reference arrays are really pointers to the data
+				deferencePtr = ((not isArray) and (isPointer or isReference)) or (isArray and isReference)
+				if deferencePtr:
+					if self.addOp(state, LES_PLAN_OP_DEREF, memberOffset, 0) == False:
+						return False
+					if self.compileInternal(state, memberTypeEntry, 0, True) == False:
+						return False
+					if self.addOp(state, LES_PLAN_OP_POP, 0, 0) == False:
+						return False
+				else:
+					# Arrays inside a struct are stored inline : no dereference
+					if self.compileInternal(state, memberTypeEntry, memberOffset, False) == False:
+						return False
+				memberOffset += structMember.m_dataSize
+			return True
+
+		if typeFlags & les_typedata.LES_TYPE_POD:
+			opcode = LES_PLAN_OP_COPY
+			if typeFlags & les_typedata.LES_TYPE_ENDIANSWAP:
+				if typeDataSize == 2:
+					opcode = LES_PLAN_OP_SWAP16
+				elif typeDataSize == 4:
+					opcode = LES_PLAN_OP_SWAP32
+				elif typeDataSize == 8:
+					opcode = LES_PLAN_OP_SWAP64
+				else:
+					return False
+				# Integer swaps are written as varints when varint parameter data was negotiated
+				if typeFlags & les_typedata.LES_TYPE_INTEGER:
+					opcode += (LES_PLAN_OP_INT16 - LES_PLAN_OP_SWAP16)
+			return self.addOp(state, opcode, offset, typeDataSize)
+
+		return True
+
+	# Mirrors LES_PlanCompileInternal
+	def compileInternal(self, state, inputTypeEntry, offset, derefArray):
+		inputTypeFlags = inputTypeEntry.m_flags
+		if inputTypeFlags & les_typedata.LES_TYPE_VARIABLE_SIZE:
+			# Variable sized data : use the non-plan path
+			return False
+		if (inputTypeFlags & les_typedata.LES_TYPE_ARRAY) == 0:
+			return self.compileItem(state, inputTypeEntry, offset)
+
+		rootTypeEntry = inputTypeEntry.GetRootType(self.__m_stringTable__, self.__m_typeData__)
+		if rootTypeEntry == None:
+			return False
+		numElements = inputTypeEntry.m_numElements
+		elementSize = rootTypeEntry.m_dataSize
+
+		dereference = derefArray and ((inputTypeFlags & les_typedata.LES_TYPE_REFERENCE) == 0)
+		elementOffset = offset
+		if dereference:
+			if self.addOp(state, LES_PLAN_OP_DEREF, offset, 0) == False:
+				return False
+			elementOffset = 0
+		for element in range(numElements):
+			if self.compileItem(state, inputTypeEntry, elementOffset) == False:
+				return False
+			elementOffset += elementSize
+		if dereference:
+			if self.addOp(state, LES_PLAN_OP_POP, 0, 0) == False:
+				return False
+		return True
+
+	# Mirrors LES_PlanCompileParameter
+	def compileParameter(self, functionParameter):
+		typeEntry = self.getTypeEntry(functionParameter.m_typeID)
+		if typeEntry == None:
+			return None
+		state = LES_PlanCompileState()
+		if typeEntry.m_flags & les_typedata.LES_TYPE_POINTER:
+			if self.addOp(state, LES_PLAN_OP_DEREF, 0, 0) == False:
+				return None
+		if self.compileInternal(state, typeEntry, 0, True) == False:
+			return None
+		return state.m_ops
+
+	def makeStubName(self, functionName, parameterIndex):
+		stubName = "LES_Stub_" + MakeIdentifier(functionName) + "_" + str(parameterIndex)
+		uniqueStubName = stubName
+		count = 0
+		while uniqueStubName in self.__m_stubNames__:
+			count += 1
+			uniqueStubName = stubName + "_" + str(count)
+		self.__m_stubNames__.append(uniqueStubName)
+		return uniqueStubName
+
+	def generateStubCode(self, stubName, functionName, parameterName, typeName, ops):
+		lines = []
+		lines.append("/* '%s' parameter:'%s' type:'%s' */" % (functionName, parameterName, typeName))
+		lines.append("static int %s(char* const writeBufferPtr, const void* const parameterDataPtr)" % (stubName))
+		lines.append("{")
+		lines.append("\tconst char* const base0 = (const char*)parameterDataPtr;")
+		# Stubs are only used for fixed width parameter data : integer ops are plain swaps
+		swapWidths = { LES_PLAN_OP_SWAP16:2, LES_PLAN_OP_SWAP32:4, LES_PLAN_OP_SWAP64:8,
+									 LES_PLAN_OP_INT16:2, LES_PLAN_OP_INT32:4, LES_PLAN_OP_INT64:8 }
+		baseStack = []
+		base = "base0"
+		numBases = 1
+		numBytesWritten = 0
+		for op in ops:
+			opcode = op[0]
+			offset = op[1]
+			size = op[2]
+			dst = "writeBufferPtr + %d" % (numBytesWritten)
+			src = "%s + %d" % (base, offset)
+			if opcode == LES_PLAN_OP_COPY:
+				lines.append("\tmemcpy(%s, %s, %d);" % (dst, src, size))
+				numBytesWritten += size
+			elif opcode in swapWidths:
+				width = swapWidths[opcode]
+				if size == width:
+					lines.append("\ttoBigEndian%d(%s, %s);" % (width * 8, dst, src))
+				else:
+					lines.append("\ttoBigEndianArray%d(%s, %s, %d);" % (width * 8, dst, src, size / width))
+				numBytesWritten += size
+			elif opcode == LES_PLAN_OP_DEREF:
+				baseStack.append(base)
+				base = "base%d" % (numBases)
+				numBases += 1
+				lines.append("\tconst char* const %s = *(const char* const*)(%s);" % (base, src))
+				lines.append("\tif (%s == LES_NULL)" % (base))
+				lines.append("\t{")
+				lines.append("\t\treturn -1;")
+				lines.append("\t}")
+			elif opcode == LES_PLAN_OP_POP:
+				base = baseStack.pop()
+		lines.append("\treturn %d;" % (numBytesWritten))
+		lines.append("}")
+		lines.append("")
+		return lines
+
+	def generate(self):
+		functionData = self.__m_functionData__
+		for f in range(functionData.getNumFunctionDefinitions()):
+			functionDefinition = functionData.getFunctionDefinitionByIndex(f)
+			functionName = functionData.getFunctionDefinitionNameByIndex(f)
+			functionNameHash = les_hash.LES_GenerateHashCaseSensitive(functionName)
+			for p in range(functionDefinition.GetNumParameters()):
+				functionParameter = functionDefinition.GetParameterByIndex(p)
+				ops = self.compileParameter(functionParameter)
+				# Parameters which don't compile or have nothing to write use the non-stub path
+				if (ops == None) or (len(ops) == 0):
+					continue
+				# Parameters with large copies use the plan which sends them without a copy
+				if len([op for op in ops if (op[0] == LES_PLAN_OP_COPY) and (op[2] >= LES_PARAMETER_REFERENCE_MIN_SIZE)]) > 0:
+					continue
+				parameterName = self.__m_stringTable__.getString(functionParameter.m_nameID)
+				typeName = self.__m_stringTable__.getString(functionParameter.m_typeID)
+				stubName = self.makeStubName(functionName, p)
+				code = self.generateStubCode(stubName, functionName, parameterName, typeName, ops)
+				self.__m_stubs__.append((functionNameHash, p, ComputeLayoutHash(ops), stubName, code))
+		# Sorted by function name hash then parameter index for LES_FindParameterStub
+		self.__m_stubs__.sort(key=lambda stub: (stub[0], stub[1]))
+
+	def write(self, fname):
+		lines = []
+		lines.append("/* Generated by les_stubgen.py from the data XML files : DO NOT EDIT */")
+		lines.append("")
+		lines.append("#include <memory.h>")
+		lines.append("")
+		lines.append("#include \"les_base.h\"")
+		lines.append("#include \"les_endianswap.h\"")
+		lines.append("#include \"les_parameterstub.h\"")
+		lines.append("")
+		for stub in self.__m_stubs__:
+			lines.extend(stub[4])
+		lines.append("extern const LES_ParameterStub les_parameterStubs[];")
+		lines.append("extern const int les_numParameterStubs;")
+		lines.append("")
+		lines.append("const LES_ParameterStub les_parameterStubs[] = ")
+		lines.append("{")
+		for stub in self.__m_stubs__:
+			lines.append("\t{ 0x%08X, %d, 0x%08X, %s }," % (stub[0], stub[1], stub[2], stub[3]))
+		lines.append("\t{ 0x00000000, -1, 0x00000000, LES_NULL }")
+		lines.append("};")
+		lines.append("")
+		lines.append("const int les_numParameterStubs = %d;" % (len(self.__m_stubs__)))
+		fh = open(fname, "w")
+		fh.write("\n".join(lines))
+		fh.write("\n")
+		fh.close()
+		return len(self.__m_stubs__)
+
+def runTest():
+	les_logger.Init()
+	outputFileName = "les_parameterstubdata.cpp"
+	if len(sys.argv) > 1:
+		outputFileName = sys.argv[1]
+	definitionFile = les_definitionfile.LES_DefinitionFile()
+	definitionFile.create()
+	this = LES_StubGenerator(definitionFile.getStringTable(), definitionFile.getTypeData(),
+													 definitionFile.getStructData(), definitionFile.getFunctionData())
+	this.generate()
+	numStubs = this.write(outputFileName)
+	les_logger.Log("Generated %d parameter stubs '%s'", numStubs, outputFileName)
+
+if __name__ == '__main__':
+	runTest()
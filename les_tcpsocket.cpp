@@ -5,6 +5,7 @@
 #include <errno.h>
 #include <arpa/inet.h>
 #include <sys/select.h>
+#include <sys/uio.h>
 #endif // #if LES_PLATFORM_LINUX
 
 #if LES_PLATFORM_WINDOWS == 1
@@ -17,6 +18,10 @@
 
 #define LES_NETWORK_INVALID_SOCKET (-1)
 
+// Set by the main thread before it sends, read by the network thread
+static volatile int les_maxSegmentsWriteSize = 0;
+static volatile int les_numSegmentsWrites = 0;
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Internal Static functions
@@ -164,6 +169,110 @@ int LES_TCPSocket::Send(const char* const pSendData, const int sendDataSize)
 	return bytesSent;
 }
 
+int LES_TCPSocket::SendSegments(const char* const* const ppSegmentData, const int* const pSegmentSizes, const int numSegments)
+{
+	if (numSegments > LES_TCPSOCKET_MAX_NUM_SEGMENTS)
+	{
+		LES_ERROR("LES_TCPSocket::SendSegments too many segments:%d max:%d", numSegments, LES_TCPSOCKET_MAX_NUM_SEGMENTS);
+		return -1;
+	}
+	const int socketHandle = m_socketHandle;
+	int totalBytesSent = 0;
+#if LES_PLATFORM_LINUX == 1
+	struct iovec segments[LES_TCPSOCKET_MAX_NUM_SEGMENTS];
+	for (int i = 0; i < numSegments; i++)
+	{
+		segments[i].iov_base = (void*)ppSegmentData[i];
+		segments[i].iov_len = (size_t)pSegmentSizes[i];
+	}
+	// writev can stop part way through a segment : carry on from there until everything has been sent
+	int segment = 0;
+	while (segment < numSegments)
+	{
+		int numWriteSegments = numSegments - segment;
+		size_t lastWriteSegmentSize = 0;
+		const size_t maxWriteSize = (size_t)les_maxSegmentsWriteSize;
+		if (maxWriteSize > 0)
+		{
+			// Cut the last segment written short : the next write carries on from part way through it
+			size_t numWriteBytes = 0;
+			numWriteSegments = 0;
+			while (((segment + numWriteSegments) < numSegments) && (numWriteBytes < maxWriteSize))
+			{
+				numWriteBytes += segments[segment + numWriteSegments].iov_len;
+				numWriteSegments++;
+			}
+			lastWriteSegmentSize = segments[segment + numWriteSegments - 1].iov_len;
+			if (numWriteBytes > maxWriteSize)
+			{
+				segments[segment + numWriteSegments - 1].iov_len -= numWriteBytes - maxWriteSize;
+			}
+		}
+		const ssize_t bytesSent = writev(socketHandle, segments + segment, numWriteSegments);
+		les_numSegmentsWrites++;
+		if (maxWriteSize > 0)
+		{
+			segments[segment + numWriteSegments - 1].iov_len = lastWriteSegmentSize;
+		}
+		if (bytesSent == -1)
+		{
+			if (LES_GetLastError() == EINTR)
+			{
+				continue;
+			}
+			LES_ERROR("LES_TCPSocket::SendSegments Error sending data errno:0x%X",  LES_GetLastError());
+			return -1;
+		}
+		totalBytesSent += (int)bytesSent;
+		size_t numBytesLeft = (size_t)bytesSent;
+		while ((segment < numSegments) && (numBytesLeft >= segments[segment].iov_len))
+		{
+			numBytesLeft -= segments[segment].iov_len;
+			segment++;
+		}
+		if (segment < numSegments)
+		{
+			segments[segment].iov_base = (char*)segments[segment].iov_base + numBytesLeft;
+			segments[segment].iov_len -= numBytesLeft;
+		}
+	}
+#endif // #if LES_PLATFORM_LINUX == 1
+#if LES_PLATFORM_WINDOWS == 1
+	for (int i = 0; i < numSegments; i++)
+	{
+		int segmentBytesSent = 0;
+		while (segmentBytesSent < pSegmentSizes[i])
+		{
+			int numWriteBytes = pSegmentSizes[i] - segmentBytesSent;
+			if ((les_maxSegmentsWriteSize > 0) && (numWriteBytes > les_maxSegmentsWriteSize))
+			{
+				numWriteBytes = les_maxSegmentsWriteSize;
+			}
+			const int bytesSent = send(socketHandle, ppSegmentData[i] + segmentBytesSent, numWriteBytes, 0);
+			les_numSegmentsWrites++;
+			if (bytesSent == -1)
+			{
+				LES_ERROR("LES_TCPSocket::SendSegments Error sending data errno:0x%X",  LES_GetLastError());
+				return -1;
+			}
+			segmentBytesSent += bytesSent;
+		}
+		totalBytesSent += segmentBytesSent;
+	}
+#endif // #if LES_PLATFORM_WINDOWS == 1
+	return totalBytesSent;
+}
+
+void LES_TCPSocket::SetMaxSegmentsWriteSize(const int maxWriteSize)
+{
+	les_maxSegmentsWriteSize = maxWriteSize;
+}
+
+int LES_TCPSocket::GetNumSegmentsWrites(void)
+{
+	return les_numSegmentsWrites;
+}
+
 int LES_TCPSocket::Recv(char* const pReceiveBuffer, const int bufferSize, int* const pNumBytesReceived)
 {
 	const int socketHandle = m_socketHandle;
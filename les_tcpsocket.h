@@ -5,6 +5,8 @@
 #define LES_NETWORK_RECEIVE_NO_DATA (-1)
 #define LES_NETWORK_RECEIVE_OK (0)
 
+#define LES_TCPSOCKET_MAX_NUM_SEGMENTS (32)
+
 class LES_TCPSocket
 {
 public:
@@ -13,12 +15,18 @@ public:
 	int Create(void);
 	int Connect(const char* const ip, const short port);
 	int Send(const char* const pSendData, const int sendDataSize);
+	/* Sends the segments in order as one stream of bytes : returns the number of bytes sent or -1 */
+	int SendSegments(const char* const* const ppSegmentData, const int* const pSegmentSizes, const int numSegments);
 	int Recv(char* const pReceiveBuffer, const int bufferSize, int* const pNumBytesReceived);
 	void Close(void);
 
 	int IsValid(void) const;
 
 	static int InitSystem(void);
+	/* Test only : each write of SendSegments sends at most maxWriteSize bytes (0 is no limit) to split the segments */
+	static void SetMaxSegmentsWriteSize(const int maxWriteSize);
+	/* The number of writes SendSegments has made */
+	static int GetNumSegmentsWrites(void);
 private:
 	LES_TCPSocket& operator =(LES_TCPSocket& other);
 	LES_TCPSocket(LES_TCPSocket& other);
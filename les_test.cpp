@@ -7,15 +7,34 @@
 #include "les_test_macros.h"
 #include "les_function.h"
 #include "les_function_macros.h"
+#include "les_function_call.h"
 #include "les_stringentry.h"
 #include "les_parameter.h"
 #include "les_struct.h"
+#include "les_parameterpool.h"
+#include "les_networkmessage.h"
+#include "les_parameterstub.h"
+#include "les_completionqueue.h"
+#include "les_coreengine.h"
+#include "les_parameterplan.h"
+#include "les_endianswap.h"
+#include "les_varint.h"
+#include "les_compress.h"
+#include "les_decode.h"
+#include "les_hashindex.h"
+#include "les_hashdata.h"
+#include "les_definitionfile.h"
+#include "les_typedata.h"
+#include "les_time.h"
+#include "les_tcpsocket.h"
+#include "les_network.h"
 
 #define LES_TEST_DEBUG 0
 
 extern int LES_AddStringEntry(const char* const str);
 extern int LES_AddType(const char* const name, const unsigned int dataSize, const unsigned int flags, 
 											 const char* const aliasedName, const int numElements);
+extern void LES_Function_BumpDefinitionGeneration(void);
 
 static LES_LoggerChannel* s_pDecodeLogChannel = LES_NULL;
 
@@ -320,6 +339,41 @@ static void LES_Test_InputOutputMixture(unsigned short input_0, unsigned int* ou
 	LES_FUNCTION_END();
 }
 
+static void LES_Test_InputOutputMixtureAsync(unsigned short input_0, unsigned int* output_0, unsigned char input_1, 
+																						 unsigned short* output_1, LES_FunctionRPCHandle& rpcHandle)
+{
+	LES_FUNCTION_START(LES_Test_InputOutputMixture, void);
+	LES_FUNCTION_ADD_INPUT(unsigned short, input_0);
+	LES_FUNCTION_ADD_OUTPUT(unsigned int*, output_0);
+	LES_FUNCTION_ADD_INPUT(unsigned char, input_1);
+	LES_FUNCTION_ADD_OUTPUT(unsigned short*, output_1);
+	LES_FUNCTION_END_ASYNC(rpcHandle);
+}
+
+static void LES_Test_LargeInputAsync(int input_0, const char* input_1, LES_FunctionRPCHandle& rpcHandle)
+{
+	LES_FUNCTION_START(LES_Test_LargeInput, void);
+	LES_FUNCTION_ADD_INPUT(int, input_0);
+	LES_FUNCTION_ADD_INPUT(char[8192], input_1);
+	LES_FUNCTION_END_ASYNC_NOCOPY(rpcHandle);
+}
+
+static void LES_Test_LargeInputCopyAsync(int input_0, const char* input_1, LES_FunctionRPCHandle& rpcHandle)
+{
+	LES_FUNCTION_START(LES_Test_LargeInput, void);
+	LES_FUNCTION_ADD_INPUT(int, input_0);
+	LES_FUNCTION_ADD_INPUT(char[8192], input_1);
+	LES_FUNCTION_END_ASYNC(rpcHandle);
+}
+
+static void LES_Test_LargeInput(int input_0, const char* input_1)
+{
+	LES_FUNCTION_START(LES_Test_LargeInput, void);
+	LES_FUNCTION_ADD_INPUT(int, input_0);
+	LES_FUNCTION_ADD_INPUT(char[8192], input_1);
+	LES_FUNCTION_END_NOCOPY();
+}
+
 static void LES_Test_InputParamUsedAsOutput(unsigned int input_0, unsigned short output_0)
 {
 	LES_Logger::SetFatal(LES_Logger::CHANNEL_FATAL_ERROR, false);
@@ -871,6 +925,12 @@ struct TestStruct12
 	TestStruct11 (&m_testStruct11)[1];
 };
 
+struct TestStruct16
+{
+	LES_String m_name;
+	LES_DynamicArray<int> m_int;
+};
+
 static void LES_Test_StructInputParam(TestStruct2 input_0, int input_1, TestStruct1 input_2, TestStruct3 input_3, TestStruct4* input_4)
 {
 	const char* const testFuncName = "LES_Test_StructInputParam";
@@ -1094,164 +1154,1990 @@ static void LES_Test_DecodeInputArraySTRUCTA(TestStruct2 input_0[2], TestStruct1
 														 sizeof(char)+ sizeof(short)+ sizeof(int)) +
 												1 * (sizeof(long long int)+sizeof(char)+sizeof(int)+sizeof(short)+sizeof(float));
 
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeInputArraySTRUCTB(TestStruct1 input_0[2], TestStruct2 input_1[1])
+{
+	const char* const testFuncName = "LES_Test_DecodeInputArraySTRUCTB";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+	LES_FUNCTION_START(LES_Test_DecodeInputArraySTRUCTB, void);
+	LES_FUNCTION_ADD_INPUT(TestStruct1[2], input_0);
+	LES_FUNCTION_ADD_INPUT(TestStruct2[1], input_1);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	const int realParameterDataSize = 0 +
+												2 * (sizeof(long long int)+sizeof(char)+sizeof(int)+sizeof(short)+sizeof(float)) +
+												1 * (sizeof(float)+
+														 sizeof(long long int)+sizeof(char)+sizeof(int)+sizeof(short)+sizeof(float)+
+														 sizeof(char)+ sizeof(short)+ sizeof(int));
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeOutputArraySTRUCT(TestStruct3 output_0[2], TestStruct4 output_1[1])
+{
+	const char* const testFuncName = "LES_Test_DecodeOutputArraySTRUCT";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+	LES_FUNCTION_START(LES_Test_DecodeOutputArraySTRUCT, void);
+	LES_FUNCTION_ADD_OUTPUT(TestStruct3[2], output_0);
+	LES_FUNCTION_ADD_OUTPUT(TestStruct4[1], output_1);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	const int realParameterDataSize = 0 +
+												2 * (sizeof(short) + sizeof(float) + sizeof(int) + sizeof(char)) +
+											 	1 * (sizeof(float) + sizeof(int) + sizeof(char) + sizeof(short) + sizeof(short) +
+															(sizeof(short) + sizeof(float) + sizeof(int) + sizeof(char))) +
+												0;
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeInputArrayReference(char (&input_0)[3], short (&input_1)[3])
+{
+	const char* const testFuncName = "LES_Test_DecodeInputArrayReference";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+	LES_FUNCTION_START(LES_Test_DecodeInputArrayReference, void);
+	LES_FUNCTION_ADD_INPUT(char&[3], input_0);
+	LES_FUNCTION_ADD_INPUT(short&[3], input_1);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	const int realParameterDataSize = sizeof(char) * 3 + sizeof(short) * 3;
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeOutputArrayReference(short (&output_0)[3], int (&output_1)[3])
+{
+	const char* const testFuncName = "LES_Test_DecodeOutputArrayReference";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+	LES_FUNCTION_START(LES_Test_DecodeOutputArrayReference, void);
+	LES_FUNCTION_ADD_OUTPUT(short&[3], output_0);
+	LES_FUNCTION_ADD_OUTPUT(int&[3], output_1);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	const int realParameterDataSize = sizeof(short) * 3 + sizeof(int) * 3;
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeOutputArrayReferenceAsync(short (&output_0)[3], int (&output_1)[3], LES_FunctionRPCHandle& rpcHandle)
+{
+	LES_FUNCTION_START(LES_Test_DecodeOutputArrayReference, void);
+	LES_FUNCTION_ADD_OUTPUT(short&[3], output_0);
+	LES_FUNCTION_ADD_OUTPUT(int&[3], output_1);
+	LES_FUNCTION_END_ASYNC(rpcHandle);
+}
+
+static void LES_Test_DecodeInputStructPODArray(TestStruct9 input_0)
+{
+	const char* const testFuncName = "LES_Test_DecodeInputStructPODArray";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+	LES_FUNCTION_START(LES_Test_DecodeInputStructPODArray, void);
+	LES_FUNCTION_ADD_INPUT(TestStruct9, input_0);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	const int realParameterDataSize = 3 * sizeof(short);
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeInputStructStructArray(TestStruct10 input_0)
+{
+	const char* const testFuncName = "LES_Test_DecodeInputStructStructArray";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+#if 0
+	LES_LOG("m_short[0] = %p", &(input_0.m_short[0]));
+	LES_LOG("m_short[1] = %p", &(input_0.m_short[1]));
+	LES_LOG("m_short[2] = %p", &(input_0.m_short[2]));
+	LES_LOG("m_testStruct9[0] = %p", &(input_0.m_testStruct9[0]));
+	LES_LOG("m_testStruct9[0].m_short[0] = %p", &(input_0.m_testStruct9[0].m_short[0]));
+	LES_LOG("m_testStruct9[0].m_short[1] = %p", &(input_0.m_testStruct9[0].m_short[1]));
+	LES_LOG("m_testStruct9[0].m_short[2] = %p", &(input_0.m_testStruct9[0].m_short[2]));
+	LES_LOG("m_testStruct9[1] = %p", &(input_0.m_testStruct9[1]));
+	LES_LOG("m_testStruct9[1].m_short[0] = %p", &(input_0.m_testStruct9[1].m_short[0]));
+	LES_LOG("m_testStruct9[1].m_short[1] = %p", &(input_0.m_testStruct9[1].m_short[1]));
+	LES_LOG("m_testStruct9[1].m_short[2] = %p", &(input_0.m_testStruct9[1].m_short[2]));
+#endif // #if 0
+	LES_FUNCTION_START(LES_Test_DecodeInputStructStructArray, void);
+	LES_FUNCTION_ADD_INPUT(TestStruct10, input_0);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	const int realParameterDataSize = 3 * sizeof(short) +
+																		2 * (sizeof(short) * 3);
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeInputStructPODArrayReference(TestStruct11 input_0)
+{
+	const char* const testFuncName = "LES_Test_DecodeInputStructPODArrayReference";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+	LES_FUNCTION_START(LES_Test_DecodeInputStructPODArrayReference, void);
+	LES_FUNCTION_ADD_INPUT(TestStruct11, input_0);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	const int realParameterDataSize = 3 * sizeof(short) + 2 * sizeof(int) + 5 * sizeof(char);
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeInputStructStructArrayReference(TestStruct12 input_0)
+{
+	const char* const testFuncName = "LES_Test_DecodeInputStructStructArrayReference";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+	LES_FUNCTION_START(LES_Test_DecodeInputStructStructArrayReference, void);
+	LES_FUNCTION_ADD_INPUT(TestStruct12, input_0);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	const int realParameterDataSize = 3 * sizeof(short) +
+																		2 * (3 * sizeof(short)) +
+																		1 * (3 * sizeof(short) + 2 * sizeof(int) + 5 * sizeof(char));
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeInputVariableSize(LES_String input_0, LES_DynamicArray<short> input_1, TestStruct16 input_2)
+{
+	const char* const testFuncName = "LES_Test_DecodeInputVariableSize";
+	LES_FunctionParameterData* parameterData = LES_NULL;
+
+	LES_FUNCTION_START(LES_Test_DecodeInputVariableSize, void);
+	LES_FUNCTION_ADD_INPUT(LES_String, input_0);
+	LES_FUNCTION_ADD_INPUT(LES_DynamicArray<short>, input_1);
+	LES_FUNCTION_ADD_INPUT(TestStruct16, input_2);
+	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
+	LES_FUNCTION_END();
+
+	/* The parameter data is allocated for the maximum sizes */
+	const int realParameterDataSize = (LES_TYPE_COUNT_SIZE + 16 * sizeof(char)) +
+																		(LES_TYPE_COUNT_SIZE + 8 * sizeof(short)) +
+																		(LES_TYPE_COUNT_SIZE + 16 * sizeof(char)) + (LES_TYPE_COUNT_SIZE + 4 * sizeof(int));
+
+	/* Only the real data is written */
+	const int numBytesWritten = (LES_TYPE_COUNT_SIZE + (int)strlen(input_0)) +
+															(LES_TYPE_COUNT_SIZE + input_1.m_numElements * (int)sizeof(short)) +
+															(LES_TYPE_COUNT_SIZE + (int)strlen(input_2.m_name)) + 
+															(LES_TYPE_COUNT_SIZE + input_2.m_int.m_numElements * (int)sizeof(int));
+	if (parameterData && (parameterData->GetNumBytesWritten() != numBytesWritten))
+	{
+		LES_FATAL_ERROR("%s: numBytesWritten is wrong Code:%d Should be:%d", testFuncName, 
+										parameterData->GetNumBytesWritten(), numBytesWritten);
+		return;
+	}
+
+	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
+	return;
+}
+
+static void LES_Test_DecodeInputVariableSizeAsync(LES_String input_0, LES_DynamicArray<short> input_1, TestStruct16 input_2, 
+																								 LES_FunctionRPCHandle& rpcHandle)
+{
+	LES_FUNCTION_START(LES_Test_DecodeInputVariableSize, void);
+	LES_FUNCTION_ADD_INPUT(LES_String, input_0);
+	LES_FUNCTION_ADD_INPUT(LES_DynamicArray<short>, input_1);
+	LES_FUNCTION_ADD_INPUT(TestStruct16, input_2);
+	LES_FUNCTION_END_ASYNC(rpcHandle);
+}
+
+static void LES_Test_CompileTimeHash(void)
+{
+	/* Known values from les_hash.py */
+	const LES_Hash realHash1 = 1863425725U;
+	const LES_Hash realHash2 = 3756861831U;
+	const LES_Hash realHash3 = 8686429U;
+	if (LES_HASH_LITERAL("jake") != realHash1)
+	{
+		LES_FATAL_ERROR("LES_Test_CompileTimeHash 'jake' 0x%X != 0x%X", LES_HASH_LITERAL("jake"), realHash1);
+	}
+	if (LES_HASH_LITERAL("rowan") != realHash2)
+	{
+		LES_FATAL_ERROR("LES_Test_CompileTimeHash 'rowan' 0x%X != 0x%X", LES_HASH_LITERAL("rowan"), realHash2);
+	}
+	if (LES_HASH_LITERAL("Jake") != realHash3)
+	{
+		LES_FATAL_ERROR("LES_Test_CompileTimeHash 'Jake' 0x%X != 0x%X", LES_HASH_LITERAL("Jake"), realHash3);
+	}
+
+	/* Must match the runtime hash */
+	const char* const testStrings[] = { "", "jake", "rowan", "Jake", "unsigned int", "long long int", "TestStruct12", 
+																			"LES_Test_DecodeInputStructStructArrayReference" };
+	const LES_Hash compileTimeHashes[] = { LES_HASH_LITERAL(""), LES_HASH_LITERAL("jake"), LES_HASH_LITERAL("rowan"), 
+																				 LES_HASH_LITERAL("Jake"), LES_HASH_LITERAL("unsigned int"), 
+																				 LES_HASH_LITERAL("long long int"), LES_HASH_LITERAL("TestStruct12"),
+																				 LES_HASH_LITERAL("LES_Test_DecodeInputStructStructArrayReference") };
+	const int numTests = (int)(sizeof(testStrings)/sizeof(testStrings[0]));
+	for (int i = 0; i < numTests; i++)
+	{
+		const LES_Hash runTimeHash = LES_GenerateHashCaseSensitive(testStrings[i]);
+		if (compileTimeHashes[i] != runTimeHash)
+		{
+			LES_FATAL_ERROR("LES_Test_CompileTimeHash '%s' compile-time 0x%X != runtime 0x%X", 
+											testStrings[i], compileTimeHashes[i], runTimeHash);
+		}
+	}
+}
+
+#if LES_COMPILETIME_HASH
+
+LES_TYPE_TRAITS_STRUCT(TestStruct1)
+
+static void LES_Test_TypeTraits(void)
+{
+	/* Compile-time type names used by LES_Call must match the runtime hash of the type string */
+	const char* const testStrings[] = { "int", "unsigned short", "long long int", "float*", "char&", "short[3]", "int&[12]", 
+																			"TestStruct1", "TestStruct1*", "TestStruct1&", "TestStruct1[2]" };
+	const LES_Hash compileTimeHashes[] = { LES_CallArgTraits<int>::TYPE_HASH, 
+																				 LES_CallArgTraits<unsigned short>::TYPE_HASH,
+																				 LES_CallArgTraits<long long int>::TYPE_HASH,
+																				 LES_CallArgTraits<const float*>::TYPE_HASH,
+																				 LES_CallArgTraits< LES_ReferenceArg<char> >::TYPE_HASH,
+																				 LES_CallArgTraits<short[3]>::TYPE_HASH,
+																				 LES_CallArgTraits< LES_OutputArg< LES_ReferenceArg<int[12]> > >::TYPE_HASH,
+																				 LES_CallArgTraits<TestStruct1>::TYPE_HASH,
+																				 LES_CallArgTraits<TestStruct1*>::TYPE_HASH,
+																				 LES_CallArgTraits< LES_ReferenceArg<TestStruct1> >::TYPE_HASH,
+																				 LES_CallArgTraits<TestStruct1[2]>::TYPE_HASH };
+	const int numTests = (int)(sizeof(testStrings)/sizeof(testStrings[0]));
+	for (int i = 0; i < numTests; i++)
+	{
+		const LES_Hash runTimeHash = LES_GenerateHashCaseSensitive(testStrings[i]);
+		if (compileTimeHashes[i] != runTimeHash)
+		{
+			LES_FATAL_ERROR("LES_Test_TypeTraits '%s' compile-time 0x%X != runtime 0x%X", 
+											testStrings[i], compileTimeHashes[i], runTimeHash);
+		}
+	}
+	if (LES_CallNumInputs<int, LES_OutputArg<int*>, short, LES_OutputArg<char[3]> >::value != 2)
+	{
+		LES_FATAL_ERROR("LES_Test_TypeTraits LES_CallNumInputs %d != 2", 
+										LES_CallNumInputs<int, LES_OutputArg<int*>, short, LES_OutputArg<char[3]> >::value);
+	}
+}
+
+template <typename ARG> static void LES_Test_CallStore(const char* const typeName, const ARG& arg)
+{
+	/* The straight-line store must write the same bytes as LES_FunctionParameterData::Write */
+	const void* storage = LES_NULL;
+	const void* const data = LES_CallArgTraits<ARG>::GetDataPtr(arg, &storage);
+	LES_FunctionParameterData* const parameterData = LES_ParameterPoolAlloc(8);
+	parameterData->Write(LES_GetStringEntry(typeName), data, LES_TYPE_INPUT);
+	char storeData[8];
+	const int numBytes = LES_CallArgTraits<ARG>::STORE(storeData, data);
+	if ((numBytes != parameterData->GetNumBytesWritten()) || (memcmp(storeData, parameterData->GetBufferPtr(), (size_t)numBytes) != 0))
+	{
+		LES_FATAL_ERROR("LES_Test_CallStore type:'%s' store doesn't match Write numBytes:%d expected:%d", 
+										typeName, numBytes, parameterData->GetNumBytesWritten());
+	}
+	LES_ParameterPoolFree(parameterData);
+}
+
+static void LES_Test_Call(void)
+{
+	int intValue = -123456;
+	unsigned int uintValue = 0x12345678;
+	/* The straight-line stores are only used when the negotiated parameter data is big endian fixed width */
+	if ((LES_IsParameterDataNativeEndian() == false) && (LES_IsParameterDataVarint() == false))
+	{
+		LES_Test_CallStore("char", 'Z');
+		LES_Test_CallStore("short", (short)-1234);
+		LES_Test_CallStore("int", intValue);
+		LES_Test_CallStore("float", 76.1232f);
+		LES_Test_CallStore("long long int", (long long int)-1234567890123LL);
+		LES_Test_CallStore("unsigned int*", &uintValue);
+		LES_Test_CallStore("int&", LES_Ref(intValue));
+	}
+
+	/* The second run of each call-site is trusted : the POD parameters use the straight-line stores */
+	for (int i = 0; i < 2; i++)
+	{
+		LES_CALL(LES_Test_ReturnTypeHashIsWrong, void);
+
+		unsigned short input_0 = 16;
+		unsigned int output_0 = 0xFFFF;
+		unsigned char input_1 = 'A';
+		unsigned short output_1 = 42;
+		LES_CALL(LES_Test_InputOutputMixture, void, input_0, LES_Out(&output_0), input_1, LES_Out(&output_1));
+
+		char ref_output_0 = 'R';
+		LES_CALL(LES_Test_ReferenceOutputPODParam, void, LES_Out(LES_Ref(ref_output_0)));
+
+		char array_input_0[3] = { 'A', 'B', 'C' };
+		short array_input_1[3] = { 2731, 2732, 2733 };
+		LES_CALL(LES_Test_DecodeInputArrayPOD, void, array_input_0, array_input_1);
+
+		short ref_output_array_0[3] = { 1, 2, 3 };
+		int ref_output_array_1[3] = { 4, 5, 6 };
+		LES_CALL(LES_Test_DecodeOutputArrayReference, void, LES_Out(LES_Ref(ref_output_array_0)), 
+						 LES_Out(LES_Ref(ref_output_array_1)));
+	}
+	LES_LOG("LES_Test_Call: success if no error output");
+}
+
+#endif // #if LES_COMPILETIME_HASH
+
+static void LES_Test_ParameterDataInPlaceMessage(void)
+{
+	const int parameterDataSizes[] = { 0, 1, 4, 13, 4096, 100000 };
+	const int numTests = (int)(sizeof(parameterDataSizes)/sizeof(parameterDataSizes[0]));
+	for (int i = 0; i < numTests; i++)
+	{
+		const int parameterDataSize = parameterDataSizes[i];
+		LES_ParameterPoolStats startStats;
+		LES_ParameterPoolGetStats(&startStats);
+
+		LES_FunctionParameterData* const parameterData = LES_ParameterPoolAlloc(parameterDataSize);
+		const LES_NetworkMessage* const message = (const LES_NetworkMessage*)parameterData->GetMessagePtr();
+		const char* const payloadParameterData = (const char*)(message->m_payload) + LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE;
+		if (payloadParameterData != parameterData->GetBufferPtr())
+		{
+			LES_FATAL_ERROR("LES_Test_ParameterDataInPlaceMessage size:%d buffer %p != message payload parameter data %p", 
+											parameterDataSize, parameterData->GetBufferPtr(), payloadParameterData);
+		}
+		const int messageSize = LES_NetworkMessageSize(parameterDataSize + LES_FUNCTIONPARAMETERDATA_PAYLOAD_HEADER_SIZE);
+		if (messageSize > LES_FUNCTIONPARAMETERDATA_MESSAGE_SIZE(parameterDataSize))
+		{
+			LES_FATAL_ERROR("LES_Test_ParameterDataInPlaceMessage size:%d messageSize:%d > allocated:%d", 
+											parameterDataSize, messageSize, LES_FUNCTIONPARAMETERDATA_MESSAGE_SIZE(parameterDataSize));
+		}
+
+		/* A block in flight stays in use until every owner has released it */
+		LES_ParameterPoolAddRef(parameterData);
+		LES_ParameterPoolFree(parameterData);
+		LES_ParameterPoolStats stats;
+		LES_ParameterPoolGetStats(&stats);
+		if (stats.m_numInUse != startStats.m_numInUse + 1)
+		{
+			LES_FATAL_ERROR("LES_Test_ParameterDataInPlaceMessage size:%d released while still referenced numInUse:%d expected:%d", 
+											parameterDataSize, stats.m_numInUse, startStats.m_numInUse + 1);
+		}
+		LES_ParameterPoolFree(parameterData);
+		LES_ParameterPoolGetStats(&stats);
+		if (stats.m_numInUse != startStats.m_numInUse)
+		{
+			LES_FATAL_ERROR("LES_Test_ParameterDataInPlaceMessage size:%d not released numInUse:%d expected:%d", 
+											parameterDataSize, stats.m_numInUse, startStats.m_numInUse);
+		}
+	}
+}
+
+static void LES_Test_ParameterPool(void)
+{
+	LES_ParameterPoolStats startStats;
+	LES_ParameterPoolGetStats(&startStats);
+
+	/* Each size class : the first block is a miss, a freed block is reused by the next alloc of the same class */
+	LES_FunctionParameterData* blocks[LES_PARAMETERPOOL_NUM_SIZE_CLASSES + 1];
+	int numBlocks = 0;
+	for (int sizeClass = 0; sizeClass < LES_PARAMETERPOOL_NUM_SIZE_CLASSES; sizeClass++)
+	{
+		/* The largest parameter data which fits the block : small classes are smaller than the message header */
+		const int parameterDataSize = (LES_PARAMETERPOOL_MIN_BLOCK_SIZE << sizeClass) - LES_FUNCTIONPARAMETERDATA_MESSAGE_SIZE(0);
+		if (parameterDataSize < 0)
+		{
+			continue;
+		}
+		LES_ParameterPoolStats classStartStats;
+		LES_ParameterPoolGetSizeClassStats(sizeClass, &classStartStats);
+		LES_FunctionParameterData* const parameterData = LES_ParameterPoolAlloc(parameterDataSize);
+		LES_ParameterPoolFree(parameterData);
+		LES_FunctionParameterData* const reusedParameterData = LES_ParameterPoolAlloc(parameterDataSize);
+		LES_ParameterPoolStats classStats;
+		LES_ParameterPoolGetSizeClassStats(sizeClass, &classStats);
+		if (reusedParameterData != parameterData)
+		{
+			LES_FATAL_ERROR("LES_Test_ParameterPool sizeClass:%d size:%d freed block wasn't reused", sizeClass, parameterDataSize);
+		}
+		if ((classStats.m_numAllocs != classStartStats.m_numAllocs + 2) || (classStats.m_numInUse != classStartStats.m_numInUse + 1) ||
+				(classStats.m_numMisses > classStartStats.m_numMisses + 1))
+		{
+			LES_FATAL_ERROR("LES_Test_ParameterPool sizeClass:%d size:%d numAllocs:%d numMisses:%d numInUse:%d expected:%d %d %d", 
+											sizeClass, parameterDataSize, classStats.m_numAllocs, classStats.m_numMisses, classStats.m_numInUse,
+											classStartStats.m_numAllocs + 2, classStartStats.m_numMisses + 1, classStartStats.m_numInUse + 1);
+		}
+		blocks[numBlocks] = reusedParameterData;
+		numBlocks++;
+	}
+
+	/* Too big for the pool : every alloc is a heap allocation */
+	const int oversizeParameterDataSize = (LES_PARAMETERPOOL_MIN_BLOCK_SIZE << (LES_PARAMETERPOOL_NUM_SIZE_CLASSES - 1)) + 1;
+	LES_ParameterPoolStats oversizeStartStats;
+	LES_ParameterPoolGetSizeClassStats(-1, &oversizeStartStats);
+	LES_ParameterPoolFree(LES_ParameterPoolAlloc(oversizeParameterDataSize));
+	blocks[numBlocks] = LES_ParameterPoolAlloc(oversizeParameterDataSize);
+	numBlocks++;
+	LES_ParameterPoolStats oversizeStats;
+	LES_ParameterPoolGetSizeClassStats(-1, &oversizeStats);
+	if ((oversizeStats.m_numAllocs != oversizeStartStats.m_numAllocs + 2) || 
+			(oversizeStats.m_numMisses != oversizeStartStats.m_numMisses + 2) ||
+			(oversizeStats.m_numInUse != oversizeStartStats.m_numInUse + 1))
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterPool oversize numAllocs:%d numMisses:%d numInUse:%d expected:%d %d %d", 
+										oversizeStats.m_numAllocs, oversizeStats.m_numMisses, oversizeStats.m_numInUse,
+										oversizeStartStats.m_numAllocs + 2, oversizeStartStats.m_numMisses + 2, oversizeStartStats.m_numInUse + 1);
+	}
+
+	/* The peak is the most blocks in use at once over every size class : it stays after the blocks are freed */
+	const int expectedNumInUse = startStats.m_numInUse + numBlocks;
+	const int expectedHighWaterMark = (expectedNumInUse > startStats.m_highWaterMark) ? expectedNumInUse : startStats.m_highWaterMark;
+	LES_ParameterPoolStats stats;
+	LES_ParameterPoolGetStats(&stats);
+	if ((stats.m_numInUse != expectedNumInUse) || (stats.m_highWaterMark != expectedHighWaterMark))
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterPool numInUse:%d highWaterMark:%d expected:%d %d", 
+										stats.m_numInUse, stats.m_highWaterMark, expectedNumInUse, expectedHighWaterMark);
+	}
+	for (int i = 0; i < numBlocks; i++)
+	{
+		LES_ParameterPoolFree(blocks[i]);
+	}
+	LES_ParameterPoolGetStats(&stats);
+	if ((stats.m_numInUse != startStats.m_numInUse) || (stats.m_highWaterMark != expectedHighWaterMark))
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterPool after free numInUse:%d highWaterMark:%d expected:%d %d", 
+										stats.m_numInUse, stats.m_highWaterMark, startStats.m_numInUse, expectedHighWaterMark);
+	}
+	if (LES_ParameterPoolGetSizeClassStats(LES_PARAMETERPOOL_NUM_SIZE_CLASSES, &stats) != LES_RETURN_ERROR)
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterPool sizeClass:%d stats found", LES_PARAMETERPOOL_NUM_SIZE_CLASSES);
+	}
+}
+
+static void LES_Test_ParameterStubs(void)
+{
+	/* Generated stub for 'LES_Test_ReferenceInputStructParam' input_0 'TestStruct1&' */
+	const LES_Hash functionNameHash = LES_GenerateHashCaseSensitive("LES_Test_ReferenceInputStructParam");
+	if (LES_FindParameterStub(functionNameHash, 1) != LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterStubs found a stub for a parameter which doesn't exist");
+	}
+	const LES_ParameterStub* const parameterStub = LES_FindParameterStub(functionNameHash, 0);
+	if (parameterStub == LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterStubs 'LES_Test_ReferenceInputStructParam' stub not found");
+		return;
+	}
+
+	TestStruct1 input_0;
+	input_0.m_longlong = -100048;
+	input_0.m_char = 'A';
+	input_0.m_int = 65;
+	input_0.m_short = -123;
+	input_0.m_float = 666.987f;
+
+	char expected[19];
+	toBigEndian64(expected + 0, (const char*)&input_0.m_longlong);
+	memcpy(expected + 8, &input_0.m_char, 1);
+	toBigEndian32(expected + 9, (const char*)&input_0.m_int);
+	toBigEndian16(expected + 13, (const char*)&input_0.m_short);
+	toBigEndian32(expected + 15, (const char*)&input_0.m_float);
+
+	char buffer[64];
+	const int numBytesWritten = parameterStub->m_stub(buffer, &input_0);
+	if (numBytesWritten != (int)sizeof(expected))
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterStubs numBytesWritten:%d expected:%d", numBytesWritten, (int)sizeof(expected));
+		return;
+	}
+	if (memcmp(buffer, expected, sizeof(expected)) != 0)
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterStubs 'LES_Test_ReferenceInputStructParam' stub data doesn't match");
+	}
+}
+
+typedef void LES_TestEndianSwapFunction(char* const pOutData, const char* const pInData);
+typedef void LES_TestEndianSwapArrayFunction(char* const pOutData, const char* const pInData, const int numElements);
+
+/* The array conversion must match the per element one and mustn't write past the end of the output */
+static void LES_Test_EndianSwapArray(const char* const testName, LES_TestEndianSwapArrayFunction* const arrayFunction, 
+																		 LES_TestEndianSwapFunction* const elementFunction, const int elementSize)
+{
+	const int maxNumElements = 70;
+	char input[8*70+8];
+	for (int i = 0; i < (int)sizeof(input); i++)
+	{
+		input[i] = (char)((i * 7) + 1);
+	}
+	char output[8*70+8+1];
+	char expected[8*70];
+	for (int numElements = 0; numElements < maxNumElements; numElements++)
+	{
+		/* Every input alignment & an unaligned output : the vector loops have unaligned heads and tails */
+		for (int offset = 0; offset < 8; offset++)
+		{
+			const char* const inData = input + offset;
+			char* const outData = output + (offset & 1);
+			const int numBytes = numElements * elementSize;
+			memset(output, 0x5A, sizeof(output));
+			arrayFunction(outData, inData, numElements);
+			for (int i = 0; i < numElements; i++)
+			{
+				elementFunction(expected + (i * elementSize), inData + (i * elementSize));
+			}
+			if ((memcmp(outData, expected, (size_t)numBytes) != 0) || (outData[numBytes] != 0x5A))
+			{
+				LES_FATAL_ERROR("LES_Test_EndianSwapArrays %s %s numElements:%d offset:%d doesn't match", 
+												LES_EndianSwapGetKernelName(), testName, numElements, offset);
+				return;
+			}
+		}
+	}
+}
+
+static void LES_Test_EndianSwapArrays(void)
+{
+	/* Each kernel the build & CPU support : scalar always is */
+	const char* const kernelNames[] = { "scalar", "SSSE3", "AVX2" };
+	for (int k = 0; k < 3; k++)
+	{
+		if (LES_EndianSwapSetKernel(kernelNames[k]) != LES_RETURN_OK)
+		{
+			if (k == 0)
+			{
+				LES_FATAL_ERROR("LES_Test_EndianSwapArrays scalar kernel can't be selected");
+			}
+			continue;
+		}
+		LES_Test_EndianSwapArray("toBigEndianArray16", toBigEndianArray16, toBigEndian16, 2);
+		LES_Test_EndianSwapArray("toBigEndianArray32", toBigEndianArray32, toBigEndian32, 4);
+		LES_Test_EndianSwapArray("toBigEndianArray64", toBigEndianArray64, toBigEndian64, 8);
+		LES_Test_EndianSwapArray("fromBigEndianArray16", fromBigEndianArray16, fromBigEndian16, 2);
+		LES_Test_EndianSwapArray("fromBigEndianArray32", fromBigEndianArray32, fromBigEndian32, 4);
+		LES_Test_EndianSwapArray("fromBigEndianArray64", fromBigEndianArray64, fromBigEndian64, 8);
+	}
+	LES_EndianSwapInit();
+}
+
+static void LES_Test_ReadPlan(void)
+{
+	/* Output parameters are written back by reading the parameter plan : read back what the plan wrote */
+	const LES_FunctionDefinition* const functionDefinitionPtr = LES_GetFunctionDefinition("LES_Test_ReferenceInputStructParam");
+	const LES_FunctionPlan* const functionPlan = functionDefinitionPtr ? LES_GetFunctionPlan(functionDefinitionPtr) : LES_NULL;
+	const LES_ParameterPlanEntry* const parameterPlan = functionPlan ? functionPlan->GetParameterPlan(0) : LES_NULL;
+	if (parameterPlan == LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_ReadPlan 'LES_Test_ReferenceInputStructParam' parameter plan not found");
+		return;
+	}
+	const LES_ParameterPlanOp* const ops = functionPlan->GetOps(parameterPlan);
+	const int numOps = parameterPlan->m_numOps;
+
+	TestStruct1 input_0;
+	input_0.m_longlong = -100048;
+	input_0.m_char = 'A';
+	input_0.m_int = 65;
+	input_0.m_short = -123;
+	input_0.m_float = 666.987f;
+
+	char buffer[19];
+	toBigEndian64(buffer + 0, (const char*)&input_0.m_longlong);
+	memcpy(buffer + 8, &input_0.m_char, 1);
+	toBigEndian32(buffer + 9, (const char*)&input_0.m_int);
+	toBigEndian16(buffer + 13, (const char*)&input_0.m_short);
+	toBigEndian32(buffer + 15, (const char*)&input_0.m_float);
+
+	TestStruct1 output_0;
+	memset(&output_0, 0, sizeof(output_0));
+	/* The byte order negotiated with the server must not change what the test reads */
+	const bool nativeEndian = LES_IsParameterDataNativeEndian();
+	LES_SetParameterDataNativeEndian(false);
+	const int numBytesRead = LES_ReadPlan(ops, numOps, buffer, (int)sizeof(buffer), &output_0);
+	LES_SetParameterDataNativeEndian(nativeEndian);
+	if (numBytesRead != (int)sizeof(buffer))
+	{
+		LES_FATAL_ERROR("LES_Test_ReadPlan numBytesRead:%d expected:%d", numBytesRead, (int)sizeof(buffer));
+		return;
+	}
+	if ((output_0.m_longlong != input_0.m_longlong) || (output_0.m_char != input_0.m_char) || 
+			(output_0.m_int != input_0.m_int) || (output_0.m_short != input_0.m_short) || 
+			(fabsf(output_0.m_float - input_0.m_float) > 1.0e-6f))
+	{
+		LES_FATAL_ERROR("LES_Test_ReadPlan 'LES_Test_ReferenceInputStructParam' read data doesn't match");
+	}
+
+	/* Native endian parameter data has the same layout without the endian swaps */
+	memcpy(buffer + 0, &input_0.m_longlong, 8);
+	memcpy(buffer + 8, &input_0.m_char, 1);
+	memcpy(buffer + 9, &input_0.m_int, 4);
+	memcpy(buffer + 13, &input_0.m_short, 2);
+	memcpy(buffer + 15, &input_0.m_float, 4);
+	memset(&output_0, 0, sizeof(output_0));
+	LES_SetParameterDataNativeEndian(true);
+	const int numNativeBytesRead = LES_ReadPlan(ops, numOps, buffer, (int)sizeof(buffer), &output_0);
+	LES_SetParameterDataNativeEndian(nativeEndian);
+	if ((numNativeBytesRead != (int)sizeof(buffer)) || 
+			(output_0.m_longlong != input_0.m_longlong) || (output_0.m_char != input_0.m_char) || 
+			(output_0.m_int != input_0.m_int) || (output_0.m_short != input_0.m_short) || 
+			(fabsf(output_0.m_float - input_0.m_float) > 1.0e-6f))
+	{
+		LES_FATAL_ERROR("LES_Test_ReadPlan 'LES_Test_ReferenceInputStructParam' native endian read data doesn't match");
+	}
+}
+
+static void LES_Test_Varint(void)
+{
+	/* Zig-zag keeps small negative numbers small : the size includes the continuation bytes */
+	const LES_int64 testValues[] = { 0, -1, 1, -64, 64, 32767, -32768, 0x7FFFFFFF, -100048, 0x7FFFFFFFFFFFFFFFLL };
+	const int testSizes[] = { 1, 1, 1, 1, 2, 3, 3, 5, 3, 10 };
+	const int numTests = (int)(sizeof(testValues)/sizeof(testValues[0]));
+	for (int i = 0; i < numTests; i++)
+	{
+		char buffer[LES_VARINT_MAX_SIZE(8)];
+		const int numBytesWritten = LES_WriteVarint(buffer, (const char*)&testValues[i], 8);
+		LES_int64 value = 0;
+		const int numBytesRead = LES_ReadVarint((char*)&value, 8, buffer, numBytesWritten);
+		if ((numBytesWritten != testSizes[i]) || (numBytesRead != numBytesWritten) || (value != testValues[i]))
+		{
+			LES_FATAL_ERROR("LES_Test_Varint value:%lld numBytesWritten:%d expected:%d numBytesRead:%d", 
+											testValues[i], numBytesWritten, testSizes[i], numBytesRead);
+		}
+	}
+	/* Values which don't fit the width and truncated varints are errors */
+	const LES_int32 bigValue = 70000;
+	char buffer[LES_VARINT_MAX_SIZE(4)];
+	const int numBigBytesWritten = LES_WriteVarint(buffer, (const char*)&bigValue, 4);
+	LES_int16 smallValue = 0;
+	if (LES_ReadVarint((char*)&smallValue, 2, buffer, numBigBytesWritten) != -1)
+	{
+		LES_FATAL_ERROR("LES_Test_Varint read of 70000 into 2 bytes succeeded");
+	}
+	LES_int32 truncatedValue = 0;
+	if (LES_ReadVarint((char*)&truncatedValue, 4, buffer, numBigBytesWritten - 1) != -1)
+	{
+		LES_FATAL_ERROR("LES_Test_Varint read of a truncated varint succeeded");
+	}
+
+	/* The integer members of a struct are varints, the others are unchanged : write it with the plan and read it back */
+	const LES_FunctionDefinition* const functionDefinitionPtr = LES_GetFunctionDefinition("LES_Test_ReferenceInputStructParam");
+	const LES_FunctionPlan* const functionPlan = functionDefinitionPtr ? LES_GetFunctionPlan(functionDefinitionPtr) : LES_NULL;
+	const LES_ParameterPlanEntry* const parameterPlan = functionPlan ? functionPlan->GetParameterPlan(0) : LES_NULL;
+	if (parameterPlan == LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_Varint 'LES_Test_ReferenceInputStructParam' parameter plan not found");
+		return;
+	}
+	const LES_ParameterPlanOp* const ops = functionPlan->GetOps(parameterPlan);
+	const int numOps = parameterPlan->m_numOps;
+
+	TestStruct1 input_0;
+	input_0.m_longlong = -100048;
+	input_0.m_char = 'A';
+	input_0.m_int = 65;
+	input_0.m_short = -123;
+	input_0.m_float = 666.987f;
+
+	// The parameter data owns the message memory
+	char* const message = new char[LES_FUNCTIONPARAMETERDATA_MESSAGE_HEADER_SIZE + LES_VARINT_MAX_SIZE(8) + 1 + 
+																 LES_VARINT_MAX_SIZE(4) + LES_VARINT_MAX_SIZE(2) + 4];
+	char* const itemMessage = new char[LES_FUNCTIONPARAMETERDATA_MESSAGE_HEADER_SIZE + LES_VARINT_MAX_SIZE(8) + 1 + 
+																		 LES_VARINT_MAX_SIZE(4) + LES_VARINT_MAX_SIZE(2) + 4];
+	LES_FunctionParameterData parameterData(message);
+	LES_FunctionParameterData itemParameterData(itemMessage);
+	const bool varint = LES_IsParameterDataVarint();
+	LES_SetParameterDataVarint(true);
+	const int retError = parameterData.WritePlan(ops, numOps, &input_0);
+	const int retItemError = itemParameterData.Write(LES_GetStringEntry("TestStruct1"), &input_0, LES_TYPE_INPUT);
+	TestStruct1 output_0;
+	memset(&output_0, 0, sizeof(output_0));
+	const int numBytesWritten = parameterData.GetNumBytesWritten();
+	const int numBytesRead = LES_ReadPlan(ops, numOps, parameterData.GetBufferPtr(), numBytesWritten, &output_0);
+	LES_SetParameterDataVarint(varint);
+	/* longlong:3 char:1 int:2 short:2 float:4 */
+	if ((retError != LES_RETURN_OK) || (numBytesWritten != 12) || (numBytesRead != numBytesWritten) || 
+			(output_0.m_longlong != input_0.m_longlong) || (output_0.m_char != input_0.m_char) || 
+			(output_0.m_int != input_0.m_int) || (output_0.m_short != input_0.m_short) || 
+			(fabsf(output_0.m_float - input_0.m_float) > 1.0e-6f))
+	{
+		LES_FATAL_ERROR("LES_Test_Varint 'LES_Test_ReferenceInputStructParam' varint data doesn't match numBytesWritten:%d numBytesRead:%d", 
+										numBytesWritten, numBytesRead);
+	}
+	/* The non-plan path writes the same varints */
+	if ((retItemError != LES_RETURN_OK) || (itemParameterData.GetNumBytesWritten() != numBytesWritten) || 
+			(memcmp(itemParameterData.GetBufferPtr(), parameterData.GetBufferPtr(), (size_t)numBytesWritten) != 0))
+	{
+		LES_FATAL_ERROR("LES_Test_Varint 'TestStruct1' varint write doesn't match the plan numBytesWritten:%d expected:%d", 
+										itemParameterData.GetNumBytesWritten(), numBytesWritten);
+	}
+}
+
+static void LES_Test_TrivialStructs(void)
+{
+	/* Structs whose memory layout is the wire layout are flagged when the definition is loaded */
+	const char* const testStructNames[] = { "TestStruct9", "TestStruct10", "TestStruct1", "TestStruct5" };
+	const LES_uint32 testStructFlags[] = { LES_TYPE_TRIVIAL_NATIVE, LES_TYPE_TRIVIAL_NATIVE, 0, 0 };
+	const int numTests = (int)(sizeof(testStructNames)/sizeof(testStructNames[0]));
+	for (int i = 0; i < numTests; i++)
+	{
+		const LES_TypeEntry* const typeEntryPtr = LES_GetTypeEntry(LES_GetStringEntry(testStructNames[i]));
+		if (typeEntryPtr == LES_NULL)
+		{
+			LES_FATAL_ERROR("LES_Test_TrivialStructs '%s' type not found", testStructNames[i]);
+			continue;
+		}
+		const LES_uint32 trivialFlags = typeEntryPtr->GetTrivialFlags();
+		if (trivialFlags != testStructFlags[i])
+		{
+			LES_FATAL_ERROR("LES_Test_TrivialStructs '%s' trivial flags:0x%X expected:0x%X", 
+											testStructNames[i], trivialFlags, testStructFlags[i]);
+		}
+	}
+
+	/* Native endian parameter data is then a copy of the struct memory */
+	TestStruct10 input_0;
+	for (int i = 0; i < 3; i++)
+	{
+		input_0.m_short[i] = (short)(i - 7);
+		input_0.m_testStruct9[0].m_short[i] = (short)(i * 300);
+		input_0.m_testStruct9[1].m_short[i] = (short)(i * -1000);
+	}
+	// The parameter data owns the message memory
+	char* const message = new char[LES_FUNCTIONPARAMETERDATA_MESSAGE_HEADER_SIZE + sizeof(TestStruct10)];
+	LES_FunctionParameterData parameterData(message);
+	const bool nativeEndian = LES_IsParameterDataNativeEndian();
+	LES_SetParameterDataNativeEndian(true);
+	const int retError = parameterData.Write(LES_GetStringEntry("TestStruct10"), &input_0, LES_TYPE_INPUT);
+	LES_SetParameterDataNativeEndian(nativeEndian);
+	if ((retError != LES_RETURN_OK) || (parameterData.GetNumBytesWritten() != (int)sizeof(TestStruct10)) || 
+			(memcmp(parameterData.GetBufferPtr(), &input_0, sizeof(TestStruct10)) != 0))
+	{
+		LES_FATAL_ERROR("LES_Test_TrivialStructs 'TestStruct10' native endian write doesn't match the struct memory");
+	}
+}
+
+static void LES_Test_ParameterReferences(void)
+{
+	/* A large char array is recorded as a reference to the input : resolving it must match writing it without references */
+	const int numChars = 8192;
+	char* const input_1 = new char[numChars];
+	for (int i = 0; i < numChars; i++)
+	{
+		input_1[i] = (char)((i * 7) + (i >> 8));
+	}
+	const int input_0 = 0x12345678;
+	const int input_2 = -987654;
+	const LES_StringEntry* const charArrayStringEntry = LES_GetStringEntry("char[8192]");
+	const LES_StringEntry* const intStringEntry = LES_GetStringEntry("int");
+	const int parameterDataSize = 4 + numChars + 4;
+
+	// The parameter data owns the message memory
+	char* const message = new char[LES_FUNCTIONPARAMETERDATA_MESSAGE_SIZE(parameterDataSize)];
+	LES_FunctionParameterData parameterData(message);
+	parameterData.Write(intStringEntry, &input_0, LES_TYPE_INPUT);
+	parameterData.Write(charArrayStringEntry, &input_1, LES_TYPE_INPUT);
+	parameterData.Write(intStringEntry, &input_2, LES_TYPE_INPUT);
+	if ((parameterData.GetNumReferences() != 1) || (parameterData.GetNumBytesWritten() != parameterDataSize))
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterReferences numReferences:%d expected:1 numBytesWritten:%d expected:%d", 
+										parameterData.GetNumReferences(), parameterData.GetNumBytesWritten(), parameterDataSize);
+	}
+	else
+	{
+		const LES_NetworkSendReference* const reference = parameterData.GetReferences();
+		if ((reference->m_offset != (LES_FUNCTIONPARAMETERDATA_MESSAGE_HEADER_SIZE + 4)) || (reference->m_size != numChars) || 
+				(reference->m_data != input_1))
+		{
+			LES_FATAL_ERROR("LES_Test_ParameterReferences reference offset:%d size:%d data:%p expected offset:%d size:%d data:%p", 
+											reference->m_offset, reference->m_size, reference->m_data, 
+											LES_FUNCTIONPARAMETERDATA_MESSAGE_HEADER_SIZE + 4, numChars, input_1);
+		}
+	}
+	parameterData.ResolveReferences();
+
+	char* const expected = new char[parameterDataSize];
+	if (LES_IsParameterDataNativeEndian())
+	{
+		memcpy(expected, &input_0, 4);
+		memcpy(expected + 4 + numChars, &input_2, 4);
+	}
+	else
+	{
+		toBigEndian32(expected, (const char*)&input_0);
+		toBigEndian32(expected + 4 + numChars, (const char*)&input_2);
+	}
+	memcpy(expected + 4, input_1, (size_t)numChars);
+	if ((parameterData.GetNumReferences() != 0) || (parameterData.GetNumBytesWritten() != parameterDataSize) || 
+			(memcmp(parameterData.GetBufferPtr(), expected, (size_t)parameterDataSize) != 0))
+	{
+		LES_FATAL_ERROR("LES_Test_ParameterReferences resolved data doesn't match numReferences:%d numBytesWritten:%d expected:%d", 
+										parameterData.GetNumReferences(), parameterData.GetNumBytesWritten(), parameterDataSize);
+	}
+	delete[] expected;
+	delete[] input_1;
+}
+
+/* Reads which need more bytes than were written fail instead of reading past the end of the data */
+static void LES_Test_ReadTruncated(void)
+{
+	if (LES_IsParameterDataVarint())
+	{
+		/* The counts are written as ints : that is only the layout of a count with fixed width integers */
+		LES_LOG("LES_Test_ReadTruncated: skipped : varint parameter data");
+		return;
+	}
+	const LES_StringEntry* const intStringEntry = LES_GetStringEntry("int");
+	const LES_StringEntry* const shortStringEntry = LES_GetStringEntry("short");
+	const LES_StringEntry* const charStringEntry = LES_GetStringEntry("char");
+	const LES_StringEntry* const stringStringEntry = LES_GetStringEntry("LES_String");
+	const LES_StringEntry* const dynamicArrayStringEntry = LES_GetStringEntry("LES_DynamicArray<short>");
+	LES_FunctionParameterData* const parameterData = LES_ParameterPoolAlloc(64);
+
+	LES_uint32 count = 0;
+	if (parameterData->ReadCount(&count) != LES_RETURN_ERROR)
+	{
+		LES_FATAL_ERROR("LES_Test_ReadTruncated ReadCount with nothing written didn't fail");
+	}
+
+	/* A string count of 3 with 1 character */
+	const int count_3 = 3;
+	const char value_a = 'a';
+	parameterData->Write(intStringEntry, &count_3, LES_TYPE_INPUT);
+	parameterData->Write(charStringEntry, &value_a, LES_TYPE_INPUT);
+	char str[17];
+	if (parameterData->Read(stringStringEntry, str) != LES_RETURN_ERROR)
+	{
+		LES_FATAL_ERROR("LES_Test_ReadTruncated string count:3 with 1 character didn't fail");
+	}
+
+	/* A dynamic array count of 2 with 1 element */
+	parameterData->Reset();
+	const int count_2 = 2;
+	const short value_0 = 1234;
+	parameterData->Write(intStringEntry, &count_2, LES_TYPE_INPUT);
+	parameterData->Write(shortStringEntry, &value_0, LES_TYPE_INPUT);
+	short elements[8];
+	LES_DynamicArray<short> dynamicArray;
+	dynamicArray.m_data = elements;
+	dynamicArray.m_numElements = 0;
+	if (parameterData->Read(dynamicArrayStringEntry, &dynamicArray) != LES_RETURN_ERROR)
+	{
+		LES_FATAL_ERROR("LES_Test_ReadTruncated dynamic array count:2 with 1 element didn't fail");
+	}
+
+	/* A short read as an int */
+	parameterData->Reset();
+	parameterData->Write(shortStringEntry, &value_0, LES_TYPE_INPUT);
+	int value_int = 0;
+	if (parameterData->Read(intStringEntry, &value_int) != LES_RETURN_ERROR)
+	{
+		LES_FATAL_ERROR("LES_Test_ReadTruncated short read as an int didn't fail");
+	}
+
+	/* The whole dynamic array is read */
+	parameterData->Reset();
+	const int count_1 = 1;
+	parameterData->Write(intStringEntry, &count_1, LES_TYPE_INPUT);
+	parameterData->Write(shortStringEntry, &value_0, LES_TYPE_INPUT);
+	if ((parameterData->Read(dynamicArrayStringEntry, &dynamicArray) != LES_RETURN_OK) || 
+			(dynamicArray.m_numElements != 1) || (elements[0] != value_0) || (parameterData->GetNumBytesToRead() != 0))
+	{
+		LES_FATAL_ERROR("LES_Test_ReadTruncated dynamic array count:1 numElements:%d element:%d numBytesToRead:%d", 
+										dynamicArray.m_numElements, elements[0], parameterData->GetNumBytesToRead());
+	}
+	LES_ParameterPoolFree(parameterData);
+}
+
+/* Checks the items reported while decoding 'LES_Test_DecodeInputVariableSize' */
+class LES_TestDecodeVisitor : public LES_DecodeVisitor
+{
+public:
+	LES_TestDecodeVisitor(void) : m_numFunctions(0), m_numParameters(0), m_numAggregates(0), m_numStrings(0), m_numValues(0), m_numErrors(0) {}
+
+	virtual void Function(const char* const functionName, const int numParameters)
+	{
+		m_numFunctions++;
+		m_numParameters = numParameters;
+		if (strcmp(functionName, "LES_Test_DecodeInputVariableSize") != 0)
+		{
+			m_numErrors++;
+		}
+	}
+	virtual void Aggregate(const LES_DecodePath* const path, const char* const typeName)
+	{
+		/* input_1, input_2, input_2.m_int */
+		const char* const expectedParents[] = { "", "", "input_2" };
+		const char* const expectedNames[] = { "input_1", "input_2", "m_int" };
+		const char* const expectedTypeNames[] = { "LES_DynamicArray<short>", "TestStruct16", "LES_DynamicArray<int>" };
+		if ((m_numAggregates >= 3) || (strcmp(path->m_parent, expectedParents[m_numAggregates]) != 0) || 
+				(strcmp(path->m_name, expectedNames[m_numAggregates]) != 0) || 
+				(strcmp(typeName, expectedTypeNames[m_numAggregates]) != 0))
+		{
+			m_numErrors++;
+		}
+		m_numAggregates++;
+	}
+	virtual void String(const LES_DecodePath* const path, const char* const, const char* const value, const int valueLength)
+	{
+		/* input_0, input_2.m_name */
+		const char* const expectedParents[] = { "", "input_2" };
+		const char* const expectedValues[] = { "hello", "bob" };
+		if ((m_numStrings >= 2) || (strcmp(path->m_parent, expectedParents[m_numStrings]) != 0) || 
+				(valueLength != (int)strlen(expectedValues[m_numStrings])) || 
+				(memcmp(value, expectedValues[m_numStrings], (size_t)valueLength) != 0))
+		{
+			m_numErrors++;
+		}
+		m_numStrings++;
+	}
+	virtual void Value(const LES_DecodePath* const path, const char* const typeName, const LES_DecodeValue* const value)
+	{
+		/* input_1[0..2] */
+		if ((path->m_parameterIndex != 1) || (path->m_elementIndex != m_numValues) || (strcmp(typeName, "short") != 0) || 
+				(value->m_valueType != LES_DECODE_VALUE_INT16) || (value->m_int16 != (short)(2731 + m_numValues)))
+		{
+			m_numErrors++;
+		}
+		m_numValues++;
+	}
+
+	int m_numFunctions;
+	int m_numParameters;
+	int m_numAggregates;
+	int m_numStrings;
+	int m_numValues;
+	int m_numErrors;
+};
+
+static void LES_Test_DecodeVisitor(void)
+{
+	const LES_FunctionDefinition* const functionDefinitionPtr = LES_GetFunctionDefinition("LES_Test_DecodeInputVariableSize");
+	if (functionDefinitionPtr == LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_DecodeVisitor 'LES_Test_DecodeInputVariableSize' function definition not found");
+		return;
+	}
+	short input_1_data[3] = { 2731, 2732, 2733 };
+	const LES_String input_0 = "hello";
+	const LES_DynamicArray<short> input_1 = { input_1_data, 3 };
+	const TestStruct16 input_2 = { "bob", { LES_NULL, 0 } };
+
+	// The parameter data owns the message memory
+	char* const message = new char[LES_FUNCTIONPARAMETERDATA_MESSAGE_SIZE(functionDefinitionPtr->GetParameterDataSize())];
+	LES_FunctionParameterData parameterData(message);
+	parameterData.Write(LES_GetStringEntry("LES_String"), &input_0, LES_TYPE_INPUT);
+	parameterData.Write(LES_GetStringEntry("LES_DynamicArray<short>"), &input_1, LES_TYPE_INPUT);
+	parameterData.Write(LES_GetStringEntry("TestStruct16"), &input_2, LES_TYPE_INPUT);
+
+	LES_TestDecodeVisitor visitor;
+	const int retError = functionDefinitionPtr->Decode(&visitor, &parameterData);
+	if ((retError != LES_RETURN_OK) || (visitor.m_numFunctions != 1) || (visitor.m_numParameters != 3) || 
+			(visitor.m_numAggregates != 3) || (visitor.m_numStrings != 2) || (visitor.m_numValues != 3) || (visitor.m_numErrors != 0))
+	{
+		LES_FATAL_ERROR("LES_Test_DecodeVisitor decode doesn't match numAggregates:%d numStrings:%d numValues:%d numErrors:%d", 
+										visitor.m_numAggregates, visitor.m_numStrings, visitor.m_numValues, visitor.m_numErrors);
+	}
+	/* The layout is created once for each function */
+	if ((LES_GetFunctionDecodeLayout(functionDefinitionPtr) == LES_NULL) || 
+			(LES_GetFunctionDecodeLayout(functionDefinitionPtr) != LES_GetFunctionDecodeLayout(functionDefinitionPtr)))
+	{
+		LES_FATAL_ERROR("LES_Test_DecodeVisitor decode layout isn't cached");
+	}
+}
+
+static void LES_Test_HashIndex(void)
+{
+	/* Grows from empty : hashes 0..numValues*3 step 3 plus numCollisions values which all have the same hash */
+	const int numValues = 1000;
+	const int numCollisions = 5;
+	const LES_Hash collisionHash = 0x12345;
+	LES_HashIndex hashIndex;
+	for (int i = 0; i < numValues; i++)
+	{
+		hashIndex.Add((LES_Hash)(i * 3), i);
+		if (i < numCollisions)
+		{
+			hashIndex.Add(collisionHash, numValues + i);
+		}
+	}
+	if (hashIndex.GetNumEntries() != (numValues + numCollisions))
+	{
+		LES_FATAL_ERROR("LES_Test_HashIndex numEntries:%d expected:%d", hashIndex.GetNumEntries(), numValues + numCollisions);
+	}
+	int slot;
+	for (int i = 0; i < numValues; i++)
+	{
+		const int value = hashIndex.Find((LES_Hash)(i * 3), &slot);
+		if ((value != i) || (hashIndex.FindNext((LES_Hash)(i * 3), &slot) != -1))
+		{
+			LES_FATAL_ERROR("LES_Test_HashIndex hash:0x%X value:%d expected:%d", i * 3, value, i);
+		}
+		if (hashIndex.Find((LES_Hash)((i * 3) + 1), &slot) != -1)
+		{
+			LES_FATAL_ERROR("LES_Test_HashIndex hash:0x%X found but wasn't added", (i * 3) + 1);
+		}
+	}
+	int collisionMask = 0;
+	for (int value = hashIndex.Find(collisionHash, &slot); value >= 0; value = hashIndex.FindNext(collisionHash, &slot))
+	{
+		collisionMask |= 1 << (value - numValues);
+	}
+	if (collisionMask != ((1 << numCollisions) - 1))
+	{
+		LES_FATAL_ERROR("LES_Test_HashIndex collision values found mask:0x%X expected:0x%X", collisionMask, (1 << numCollisions) - 1);
+	}
+
+	/* The string entries are found through the index */
+	const char* const testStrings[] = { "int", "TestStruct16", "LES_Test_DecodeInputVariableSize", "input_0" };
+	const int numTests = (int)(sizeof(testStrings)/sizeof(testStrings[0]));
+	for (int i = 0; i < numTests; i++)
+	{
+		const LES_StringEntry* const pStringEntry = LES_GetStringEntry(testStrings[i]);
+		const LES_Hash hash = LES_GenerateHashCaseSensitive(testStrings[i]);
+		if ((pStringEntry == LES_NULL) || (strcmp(pStringEntry->m_str, testStrings[i]) != 0) || (pStringEntry->m_hash != hash) || 
+				(LES_GetStringEntryByHash(hash) != pStringEntry))
+		{
+			LES_FATAL_ERROR("LES_Test_HashIndex string entry '%s' not found", testStrings[i]);
+		}
+	}
+	if (LES_GetStringEntry("LES_Test_HashIndex_StringNotAdded") != LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_HashIndex string entry which wasn't added was found");
+	}
+}
+
+static void LES_Test_WriteBigInt32(char* const buffer, int* const pOffset, const LES_int32 value)
+{
+	const LES_int32 bigValue = toBigEndian32(value);
+	memcpy(buffer + *pOffset, &bigValue, sizeof(bigValue));
+	*pOffset += (int)sizeof(bigValue);
+}
+
+/* 
+ * Definition file of the types, empty string, struct & function chunks and the hash data chunk if pTypeHashTable isn't NULL
+ * pTypeHashTable is the type data's LES_HashTable : the other tables aren't hashed (numEntries 0)
+ * Returns the size of the file, *pHashDataOffset is the start of the hash data chunk
+*/
+static int LES_Test_MakeDefinitionFile(char* const buffer, const LES_Hash* const typeHashes, const int numTypes, 
+																			 const LES_int32* const pTypeHashTable, const int numHashTableValues, 
+																			 int* const pHashDataOffset)
+{
+	const int numChunks = pTypeHashTable ? 5 : 4;
+	int offset = 0;
+	memcpy(buffer, "LESD", 4);
+	offset += 4;
+	LES_Test_WriteBigInt32(buffer, &offset, numChunks);
+	int chunkOffsetsOffset = offset;
+	offset += numChunks * 4;
+
+	/* String, type, struct & function data : numEntries & settled then the type entries */
+	for (int chunk = 0; chunk < 4; chunk++)
+	{
+		const int numEntries = (chunk == 1) ? numTypes : 0;
+		LES_Test_WriteBigInt32(buffer, &chunkOffsetsOffset, offset);
+		LES_Test_WriteBigInt32(buffer, &offset, numEntries);
+		LES_Test_WriteBigInt32(buffer, &offset, 0);
+		for (int i = 0; i < numEntries; i++)
+		{
+			/* m_hash, m_dataSize, m_flags, m_aliasedTypeID, m_numElements */
+			LES_Test_WriteBigInt32(buffer, &offset, (LES_int32)typeHashes[i]);
+			LES_Test_WriteBigInt32(buffer, &offset, 4);
+			LES_Test_WriteBigInt32(buffer, &offset, 0);
+			LES_Test_WriteBigInt32(buffer, &offset, i);
+			LES_Test_WriteBigInt32(buffer, &offset, 1);
+		}
+	}
+
+	*pHashDataOffset = offset;
+	if (pTypeHashTable == LES_NULL)
+	{
+		return offset;
+	}
+	LES_Test_WriteBigInt32(buffer, &chunkOffsetsOffset, offset);
+	LES_Test_WriteBigInt32(buffer, &offset, LES_HASHDATA_NUMTABLES);
+	LES_Test_WriteBigInt32(buffer, &offset, 0);
+	int tableOffset = 8 + (LES_HASHDATA_NUMTABLES * 4);
+	for (int t = 0; t < LES_HASHDATA_NUMTABLES; t++)
+	{
+		LES_Test_WriteBigInt32(buffer, &offset, tableOffset);
+		tableOffset += (t == LES_HASHDATA_TYPEDATA) ? (numHashTableValues * 4) : 8;
+	}
+	for (int t = 0; t < LES_HASHDATA_NUMTABLES; t++)
+	{
+		if (t == LES_HASHDATA_TYPEDATA)
+		{
+			for (int i = 0; i < numHashTableValues; i++)
+			{
+				LES_Test_WriteBigInt32(buffer, &offset, pTypeHashTable[i]);
+			}
+			continue;
+		}
+		LES_Test_WriteBigInt32(buffer, &offset, 0);
+		LES_Test_WriteBigInt32(buffer, &offset, 0);
+	}
+	return offset;
+}
+
+/* Loads a copy of the file with the big endian value at valueOffset changed (if valueOffset >= 0) : Settle must reject it */
+static void LES_Test_HashDataInvalid(const char* const step, const char* const buffer, const int dataSize, 
+																		 const int valueOffset, const LES_int32 value)
+{
+	char invalidBuffer[256];
+	memcpy(invalidBuffer, buffer, (size_t)dataSize);
+	if (valueOffset >= 0)
+	{
+		int offset = valueOffset;
+		LES_Test_WriteBigInt32(invalidBuffer, &offset, value);
+	}
+	LES_DefinitionFile definitionFile;
+	if (definitionFile.Load(invalidBuffer, dataSize) == LES_RETURN_OK)
+	{
+		LES_FATAL_ERROR("LES_Test_HashData %s was loaded", step);
+	}
+}
+
+static void LES_Test_HashData(void)
+{
+	const char* const typeNames[] = { "alpha", "beta", "gamma" };
+	const int numTypes = 3;
+	LES_Hash hashes[numTypes];
+	for (int i = 0; i < numTypes; i++)
+	{
+		hashes[i] = LES_GenerateHashCaseSensitive(typeNames[i]);
+	}
+	char buffer[256];
+	int hashDataOffset;
+
+	/* Files without the hash data chunk are found at runtime */
+	int dataSize = LES_Test_MakeDefinitionFile(buffer, hashes, numTypes, LES_NULL, 0, &hashDataOffset);
+	{
+		LES_DefinitionFile definitionFile;
+		if ((definitionFile.Load(buffer, dataSize) != LES_RETURN_OK) || (definitionFile.GetHashData() != LES_NULL))
+		{
+			LES_FATAL_ERROR("LES_Test_HashData without the hash data chunk");
+		}
+	}
+
+	/* A chunk which isn't hashed has a table with numEntries 0 */
+	const LES_int32 notHashed[2] = { 0, 0 };
+	dataSize = LES_Test_MakeDefinitionFile(buffer, hashes, numTypes, notHashed, 2, &hashDataOffset);
+	{
+		LES_DefinitionFile definitionFile;
+		if (definitionFile.Load(buffer, dataSize) != LES_RETURN_OK)
+		{
+			LES_FATAL_ERROR("LES_Test_HashData not hashed load failed");
+			return;
+		}
+		const LES_HashData* const pHashData = definitionFile.GetHashData();
+		if ((pHashData == LES_NULL) || (pHashData->GetHashTable(LES_HASHDATA_TYPEDATA, numTypes) != LES_NULL) || 
+				(pHashData->GetHashTable(LES_HASHDATA_STRINGTABLE, 0) != LES_NULL))
+		{
+			LES_FATAL_ERROR("LES_Test_HashData not hashed table was returned");
+		}
+	}
+
+	/* One bucket : the seed is found like les_hashdata.py, identity entry indexes give the slot of each hash */
+	LES_int32 typeHashTable[3 + numTypes] = { numTypes, 1, 0 };
+	int slots[numTypes];
+	bool found = false;
+	for (LES_int32 seed = 1; (seed < 1000) && (found == false); seed++)
+	{
+		typeHashTable[2] = seed;
+		for (int i = 0; i < numTypes; i++)
+		{
+			typeHashTable[3 + i] = i;
+		}
+		dataSize = LES_Test_MakeDefinitionFile(buffer, hashes, numTypes, typeHashTable, 3 + numTypes, &hashDataOffset);
+		LES_DefinitionFile definitionFile;
+		if (definitionFile.Load(buffer, dataSize) != LES_RETURN_OK)
+		{
+			LES_FATAL_ERROR("LES_Test_HashData seed:%d load failed", seed);
+			return;
+		}
+		const LES_HashTable* const pHashTable = definitionFile.GetHashData()->GetHashTable(LES_HASHDATA_TYPEDATA, numTypes);
+		for (int i = 0; i < numTypes; i++)
+		{
+			slots[i] = pHashTable->Find(hashes[i]);
+		}
+		found = (slots[0] != slots[1]) && (slots[0] != slots[2]) && (slots[1] != slots[2]);
+	}
+	if (found == false)
+	{
+		LES_FATAL_ERROR("LES_Test_HashData no seed found");
+		return;
+	}
+	for (int i = 0; i < numTypes; i++)
+	{
+		typeHashTable[3 + slots[i]] = i;
+	}
+	dataSize = LES_Test_MakeDefinitionFile(buffer, hashes, numTypes, typeHashTable, 3 + numTypes, &hashDataOffset);
+	{
+		LES_DefinitionFile definitionFile;
+		if (definitionFile.Load(buffer, dataSize) != LES_RETURN_OK)
+		{
+			LES_FATAL_ERROR("LES_Test_HashData hashed load failed");
+			return;
+		}
+		const LES_TypeData* const pTypeData = definitionFile.GetTypeData();
+		const LES_HashData* const pHashData = definitionFile.GetHashData();
+		const LES_HashTable* const pHashTable = pHashData->GetHashTable(LES_HASHDATA_TYPEDATA, pTypeData->GetNumTypes());
+		for (int i = 0; i < numTypes; i++)
+		{
+			const int index = pHashTable ? pHashTable->Find(hashes[i]) : -1;
+			if ((index != i) || (pTypeData->GetTypeEntry(index)->m_hash != hashes[i]))
+			{
+				LES_FATAL_ERROR("LES_Test_HashData '%s' index:%d expected:%d", typeNames[i], index, i);
+			}
+		}
+		/* Any hash gives a candidate in the chunk : the caller compares its hash */
+		const LES_Hash notFoundHash = LES_GenerateHashCaseSensitive("delta");
+		const int index = pHashTable ? pHashTable->Find(notFoundHash) : -1;
+		if ((index < 0) || (index >= numTypes) || (pTypeData->GetTypeEntry(index)->m_hash == notFoundHash))
+		{
+			LES_FATAL_ERROR("LES_Test_HashData 'delta' index:%d", index);
+		}
+		if ((pHashData->GetHashTable(LES_HASHDATA_TYPEDATA, numTypes + 1) != LES_NULL) || 
+				(pHashData->GetHashTable(LES_HASHDATA_NUMTABLES, 0) != LES_NULL))
+		{
+			LES_FATAL_ERROR("LES_Test_HashData table returned for the wrong numEntries or table");
+		}
+	}
+
+	/* Counts, offsets & entry indexes outside the chunk */
+	const int tableOffsetsOffset = hashDataOffset + 8;
+	const int typeTableOffset = tableOffsetsOffset + (LES_HASHDATA_NUMTABLES * 4) + 8;
+	LES_Test_HashDataInvalid("numTables", buffer, dataSize, hashDataOffset, 1000);
+	LES_Test_HashDataInvalid("table offset in the header", buffer, dataSize, tableOffsetsOffset, 4);
+	LES_Test_HashDataInvalid("table offset after the chunk", buffer, dataSize, tableOffsetsOffset + 12, 1000);
+	LES_Test_HashDataInvalid("numBuckets", buffer, dataSize, typeTableOffset + 4, 1000);
+	LES_Test_HashDataInvalid("no buckets", buffer, dataSize, typeTableOffset + 4, 0);
+	LES_Test_HashDataInvalid("entry index", buffer, dataSize, typeTableOffset + 12, numTypes);
+	LES_Test_HashDataInvalid("truncated chunk", buffer, dataSize - 4, -1, 0);
+}
+
+static void LES_Test_DefinitionIndexes(void)
+{
+	/* Types, structs & functions are found by hash and their entries have the hash they were added with */
+	const char* const typeNames[] = { "int", "float", "TestStruct16", "LES_DynamicArray<short>" };
+	const int numTypes = (int)(sizeof(typeNames)/sizeof(typeNames[0]));
+	for (int i = 0; i < numTypes; i++)
+	{
+		const LES_StringEntry* const pStringEntry = LES_GetStringEntry(typeNames[i]);
+		const LES_TypeEntry* const pTypeEntry = pStringEntry ? LES_GetTypeEntry(pStringEntry) : LES_NULL;
+		if ((pTypeEntry == LES_NULL) || (pTypeEntry->m_hash != pStringEntry->m_hash))
+		{
+			LES_FATAL_ERROR("LES_Test_DefinitionIndexes type '%s' not found", typeNames[i]);
+		}
+	}
+	if (LES_GetTypeEntry(LES_GetStringEntry("input_0")) != LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_DefinitionIndexes type 'input_0' found but it isn't a type");
+	}
+
+	const LES_StructDefinition* const pStructDefinition = LES_GetStructDefinition(LES_GenerateHashCaseSensitive("TestStruct16"));
+	if ((pStructDefinition == LES_NULL) || (strcmp(LES_GetStringEntryForID(pStructDefinition->GetNameID())->m_str, "TestStruct16") != 0))
+	{
+		LES_FATAL_ERROR("LES_Test_DefinitionIndexes struct 'TestStruct16' not found");
+	}
+	if (LES_GetStructDefinition(LES_GenerateHashCaseSensitive("int")) != LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_DefinitionIndexes struct 'int' found but it isn't a struct");
+	}
+
+	const char* const functionName = "LES_Test_DecodeInputVariableSize";
+	const LES_FunctionDefinition* const pFunctionDefinition = LES_GetFunctionDefinition(functionName);
+	if ((pFunctionDefinition == LES_NULL) || 
+			(strcmp(LES_GetStringEntryForID(pFunctionDefinition->GetNameID())->m_str, functionName) != 0))
+	{
+		LES_FATAL_ERROR("LES_Test_DefinitionIndexes function '%s' not found", functionName);
+	}
+	/* The plan is found by the function name ID */
+	if (LES_GetFunctionPlan(pFunctionDefinition) == LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_DefinitionIndexes function '%s' plan not found", functionName);
+	}
+	if (LES_GetFunctionDefinition("TestStruct16") != LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_DefinitionIndexes function 'TestStruct16' found but it isn't a function");
+	}
+}
+
+static void LES_Test_ResolvedTypes(void)
+{
+	/* The resolved root types & struct definitions match the hash lookups */
+	const char* const typeNames[] = { "TestStruct1", "TestStruct1*", "TestStruct1&", "TestStruct1[2]" };
+	const int numTypes = (int)(sizeof(typeNames)/sizeof(typeNames[0]));
+	const LES_TypeEntry* const pRootTypeEntry = LES_GetTypeEntry(LES_GetStringEntry("TestStruct1"));
+	const LES_StructDefinition* const pStructDefinition = LES_GetStructDefinition(LES_GenerateHashCaseSensitive("TestStruct1"));
+	if ((pRootTypeEntry == LES_NULL) || (pStructDefinition == LES_NULL))
+	{
+		LES_FATAL_ERROR("LES_Test_ResolvedTypes type or struct 'TestStruct1' not found");
+		return;
+	}
+	for (int i = 0; i < numTypes; i++)
+	{
+		const LES_TypeEntry* const pTypeEntry = LES_GetTypeEntry(LES_GetStringEntry(typeNames[i]));
+		if (pTypeEntry == LES_NULL)
+		{
+			LES_FATAL_ERROR("LES_Test_ResolvedTypes type '%s' not found", typeNames[i]);
+			continue;
+		}
+		if (pTypeEntry->GetRootType() != pRootTypeEntry)
+		{
+			LES_FATAL_ERROR("LES_Test_ResolvedTypes type '%s' root type doesn't match", typeNames[i]);
+		}
+		if (pTypeEntry->GetStructDefinition() != pStructDefinition)
+		{
+			LES_FATAL_ERROR("LES_Test_ResolvedTypes type '%s' struct definition doesn't match", typeNames[i]);
+		}
+	}
+	if (LES_GetTypeEntry(LES_GetStringEntry("int"))->GetStructDefinition() != LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_ResolvedTypes type 'int' has a struct definition");
+	}
+
+	/* Member types are found by string ID : member names aren't types */
+	const int numMembers = pStructDefinition->GetNumMembers();
+	for (int i = 0; i < numMembers; i++)
+	{
+		const LES_StructMember* const pStructMember = pStructDefinition->GetMemberByIndex(i);
+		const LES_TypeEntry* const pMemberTypeEntry = LES_GetTypeEntryForStringID(pStructMember->m_typeID);
+		if ((pMemberTypeEntry == LES_NULL) || (pMemberTypeEntry != LES_GetTypeEntry(LES_GetStringEntryForID(pStructMember->m_typeID))))
+		{
+			LES_FATAL_ERROR("LES_Test_ResolvedTypes member[%d] type:%d doesn't match", i, pStructMember->m_typeID);
+		}
+		if (LES_GetTypeEntryForStringID(pStructMember->m_nameID) != LES_NULL)
+		{
+			LES_FATAL_ERROR("LES_Test_ResolvedTypes member[%d] name:%d found as a type", i, pStructMember->m_nameID);
+		}
+	}
+	if (LES_GetTypeEntryForStringID(-1) != LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_ResolvedTypes string ID -1 found as a type");
+	}
+}
+
+static void LES_Test_TypeCache(void)
+{
+	/* The sizes & alignment are cached after the first call : the cached values must match */
+	const LES_TypeEntry* const pTypeEntry = LES_GetTypeEntry(LES_GetStringEntry("TestStruct2"));
+	if (pTypeEntry == LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_TypeCache type 'TestStruct2' not found");
+		return;
+	}
+	for (int i = 0; i < 2; i++)
+	{
+		const int dataStorageSize = pTypeEntry->ComputeDataStorageSize();
+		if (dataStorageSize != 30)
+		{
+			LES_FATAL_ERROR("LES_Test_TypeCache[%d] 'TestStruct2' dataStorageSize:%d expected:30", i, dataStorageSize);
+		}
+		const int minDataStorageSize = pTypeEntry->ComputeMinDataStorageSize();
+		if (minDataStorageSize != 30)
+		{
+			LES_FATAL_ERROR("LES_Test_TypeCache[%d] 'TestStruct2' minDataStorageSize:%d expected:30", i, minDataStorageSize);
+		}
+		const int alignment = pTypeEntry->ComputeAlignment();
+		if (alignment != 8)
+		{
+			LES_FATAL_ERROR("LES_Test_TypeCache[%d] 'TestStruct2' alignment:%d expected:8", i, alignment);
+		}
+	}
+
+	const char* const typeNames[] = { "int", "TestStruct2", "TestStruct1*", "TestStruct5" };
+	const int expectedContainsPointers[] = { 0, 0, 1, 1 };
+	const int numTypes = (int)(sizeof(typeNames)/sizeof(typeNames[0]));
+	for (int i = 0; i < numTypes; i++)
+	{
+		const LES_TypeEntry* const pContainsTypeEntry = LES_GetTypeEntry(LES_GetStringEntry(typeNames[i]));
+		const int containsPointers = pContainsTypeEntry ? pContainsTypeEntry->ContainsPointers() : -1;
+		if (containsPointers != expectedContainsPointers[i])
+		{
+			LES_FATAL_ERROR("LES_Test_TypeCache type '%s' containsPointers:%d expected:%d", 
+											typeNames[i], containsPointers, expectedContainsPointers[i]);
+		}
+	}
+}
+
+static void LES_Test_PlanGeneration(void)
+{
+	const LES_FunctionDefinition* const functionDefinitionPtr = LES_GetFunctionDefinition("LES_Test_DecodeInputVariableSize");
+	if (functionDefinitionPtr == LES_NULL)
+	{
+		LES_FATAL_ERROR("LES_Test_PlanGeneration 'LES_Test_DecodeInputVariableSize' function definition not found");
+		return;
+	}
+	const LES_FunctionPlan* const functionPlan = LES_GetFunctionPlan(functionDefinitionPtr);
+	if ((functionPlan == LES_NULL) || (LES_GetFunctionDecodeLayout(functionDefinitionPtr) == LES_NULL))
+	{
+		LES_FATAL_ERROR("LES_Test_PlanGeneration 'LES_Test_DecodeInputVariableSize' plan or decode layout not found");
+		return;
+	}
+	/* Parameters without a plan have -1 ops */
+	LES_int32 numOps[3];
+	for (int i = 0; i < 3; i++)
+	{
+		const LES_ParameterPlanEntry* const parameterPlan = functionPlan->GetParameterPlan(i);
+		numOps[i] = parameterPlan ? parameterPlan->m_numOps : -1;
+	}
+
+	/* Adding a type which already exists doesn't change the definitions */
+	const int generation = LES_GetFunctionDefinitionGeneration();
+	if ((LES_AddType("int", sizeof(int), LES_TYPE_INPUT|LES_TYPE_POD|LES_TYPE_ENDIANSWAP|LES_TYPE_INTEGER, "int", 0) == LES_RETURN_ERROR) || 
+			(LES_GetFunctionDefinitionGeneration() != generation))
+	{
+		LES_FATAL_ERROR("LES_Test_PlanGeneration re-adding 'int' changed the definition generation");
+	}
+
+	/* A new generation rebuilds the plans & decode layouts on their next use */
+	LES_Function_BumpDefinitionGeneration();
+	const LES_FunctionPlan* const newFunctionPlan = LES_GetFunctionPlan(functionDefinitionPtr);
+	if ((newFunctionPlan == LES_NULL) || (LES_GetFunctionDecodeLayout(functionDefinitionPtr) == LES_NULL))
+	{
+		LES_FATAL_ERROR("LES_Test_PlanGeneration 'LES_Test_DecodeInputVariableSize' plan or decode layout not rebuilt");
+		return;
+	}
+	for (int i = 0; i < 3; i++)
+	{
+		const LES_ParameterPlanEntry* const parameterPlan = newFunctionPlan->GetParameterPlan(i);
+		const LES_int32 newNumOps = parameterPlan ? parameterPlan->m_numOps : -1;
+		if (newNumOps != numOps[i])
+		{
+			LES_FATAL_ERROR("LES_Test_PlanGeneration parameter[%d] rebuilt plan numOps:%d expected:%d", i, newNumOps, numOps[i]);
+		}
+	}
+	if (LES_GetFunctionPlan(functionDefinitionPtr) != newFunctionPlan)
+	{
+		LES_FATAL_ERROR("LES_Test_PlanGeneration rebuilt plan isn't cached");
+	}
+}
+
+static void LES_Test_CompletionQueue(void)
+{
+	LES_CompletionQueue<int, 4> completionQueue;
+	int value = -1;
+	if (completionQueue.Pop(&value))
+	{
+		LES_FATAL_ERROR("LES_Test_CompletionQueue Pop from an empty queue succeeded");
+	}
+	/* Run the indexes around the ring several times */
+	int nextPushValue = 0;
+	int nextPopValue = 0;
+	for (int loop = 0; loop < 5; loop++)
+	{
+		while (completionQueue.Push(&nextPushValue) == LES_RETURN_OK)
+		{
+			nextPushValue++;
+		}
+		if (completionQueue.GetNumItems() != 4)
+		{
+			LES_FATAL_ERROR("LES_Test_CompletionQueue full queue numItems:%d expected:4", completionQueue.GetNumItems());
+		}
+		const int numToPop = (loop & 1) ? 4 : 3;
+		for (int i = 0; i < numToPop; i++)
+		{
+			if ((completionQueue.Pop(&value) == false) || (value != nextPopValue))
+			{
+				LES_FATAL_ERROR("LES_Test_CompletionQueue loop:%d Pop value:%d expected:%d", loop, value, nextPopValue);
+			}
+			nextPopValue++;
+		}
+	}
+	/* Results can't be polled for handles which were never returned */
+	if (LES_CoreEnginePollFunctionRPC(LES_FUNCTIONRPC_INVALID_HANDLE, LES_NULL) != LES_FUNCTIONRPC_INVALID)
+	{
+		LES_FATAL_ERROR("LES_Test_CompletionQueue invalid handle isn't LES_FUNCTIONRPC_INVALID");
+	}
+	if (LES_CoreEnginePollFunctionRPC(0x12345678, LES_NULL) != LES_FUNCTIONRPC_INVALID)
+	{
+		LES_FATAL_ERROR("LES_Test_CompletionQueue unknown handle isn't LES_FUNCTIONRPC_INVALID");
+	}
+}
+
+static void LES_Test_Compress(void)
+{
+	/* Repeated text compresses, random bytes don't : both must decompress to the input */
+	const int inSize = 4096;
+	char* const inData = new char[inSize];
+	char* const compressedData = new char[LES_COMPRESS_MAX_SIZE(inSize)];
+	char* const outData = new char[inSize];
+	for (int test = 0; test < 2; test++)
+	{
+		LES_uint32 random = 0x12345678;
+		for (int i = 0; i < inSize; i++)
+		{
+			random = (random * 1103515245) + 12345;
+			inData[i] = (test == 0) ? "LES_FunctionParameterData"[i % 25] : (char)(random >> 24);
+		}
+		const int compressedSize = LES_CompressBlock(compressedData, LES_COMPRESS_MAX_SIZE(inSize), inData, inSize);
+		const int outSize = LES_DecompressBlock(outData, inSize, compressedData, compressedSize);
+		if ((compressedSize < 0) || ((test == 0) && (compressedSize >= (inSize / 10))) || 
+				(outSize != inSize) || (memcmp(outData, inData, (size_t)inSize) != 0))
+		{
+			LES_FATAL_ERROR("LES_Test_Compress test:%d compressedSize:%d outSize:%d doesn't match", test, compressedSize, outSize);
+		}
+		/* Output which doesn't fit is an error */
+		if (LES_DecompressBlock(outData, inSize - 1, compressedData, compressedSize) != -1)
+		{
+			LES_FATAL_ERROR("LES_Test_Compress test:%d decompress into too small a buffer succeeded", test);
+		}
+	}
+	/* Random data doesn't fit in less than its size */
+	if (LES_CompressBlock(compressedData, inSize - 1, inData, inSize) != -1)
+	{
+		LES_FATAL_ERROR("LES_Test_Compress compress of random data into a smaller buffer succeeded");
+	}
+	delete[] inData;
+	delete[] compressedData;
+	delete[] outData;
+}
+
+static void LES_Test_Batch(void)
+{
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_LOG("LES_Test_Batch: skipped : not connected to a server");
+		return;
+	}
+	const int numCalls = 4;
+	unsigned int output_0[numCalls];
+	unsigned short output_1[numCalls];
+	LES_FunctionRPCHandle rpcHandles[numCalls];
+	LES_ParameterPoolStats startStats;
+	LES_ParameterPoolGetStats(&startStats);
+
+	LES_CoreEngineSetFunctionRPCBatchSize(1024);
+	for (int i = 0; i < numCalls; i++)
+	{
+		output_0[i] = 0x12340000u + (unsigned int)i;
+		output_1[i] = (unsigned short)(0x5670 + i);
+		LES_Test_InputOutputMixtureAsync((unsigned short)(100 + i), &output_0[i], (unsigned char)i, &output_1[i], rpcHandles[i]);
+		if (rpcHandles[i] == LES_FUNCTIONRPC_INVALID_HANDLE)
+		{
+			LES_FATAL_ERROR("LES_Test_Batch call:%d invalid handle", i);
+			return;
+		}
+	}
+	/* The records are sent from the parameter blocks : each one is kept until the batch has been sent */
+	LES_ParameterPoolStats batchedStats;
+	LES_ParameterPoolGetStats(&batchedStats);
+	if (batchedStats.m_numInUse != (startStats.m_numInUse + numCalls))
+	{
+		LES_FATAL_ERROR("LES_Test_Batch numInUse:%d expected:%d", batchedStats.m_numInUse, startStats.m_numInUse + numCalls);
+	}
+	/* Nothing has been sent until the next tick : the server echoes the outputs which were sent */
+	for (int i = 0; i < numCalls; i++)
+	{
+		if (LES_CoreEnginePollFunctionRPC(rpcHandles[i], LES_NULL) != LES_FUNCTIONRPC_PENDING)
+		{
+			LES_FATAL_ERROR("LES_Test_Batch call:%d isn't pending before the batch has been sent", i);
+		}
+		output_0[i] = 0;
+		output_1[i] = 0;
+	}
+	for (int i = 0; i < numCalls; i++)
+	{
+		LES_int32 result = LES_RETURN_ERROR;
+		const int state = LES_CoreEngineWaitFunctionRPC(rpcHandles[i], 5.0f, &result);
+		if ((state != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+		{
+			LES_FATAL_ERROR("LES_Test_Batch call:%d state:%d result:%d", i, state, result);
+		}
+		if ((output_0[i] != (0x12340000u + (unsigned int)i)) || (output_1[i] != (unsigned short)(0x5670 + i)))
+		{
+			LES_FATAL_ERROR("LES_Test_Batch call:%d outputs 0x%X 0x%X weren't written back", i, output_0[i], output_1[i]);
+		}
+	}
+	LES_CoreEngineSetFunctionRPCBatchSize(LES_COREENGINE_DEFAULT_RPC_BATCH_SIZE);
+
+	/* Once sent the batch releases the parameter blocks : the call-site keeps its last one */
+	/* Blocks of earlier RPCs can be released at the same time : only the most in use is known */
+	const int maxNumInUse = batchedStats.m_numInUse - (numCalls - 1);
+	const float startTime = LES_GetElapsedTimeInSeconds();
+	LES_ParameterPoolStats sentStats;
+	LES_ParameterPoolGetStats(&sentStats);
+	while ((sentStats.m_numInUse > maxNumInUse) && ((LES_GetElapsedTimeInSeconds() - startTime) < 5.0f))
+	{
+		LES_CoreEngineTick();
+		LES_Sleep(0.001f);
+		LES_ParameterPoolGetStats(&sentStats);
+	}
+	if (sentStats.m_numInUse > maxNumInUse)
+	{
+		LES_FATAL_ERROR("LES_Test_Batch sent numInUse:%d expected at most:%d", sentStats.m_numInUse, maxNumInUse);
+	}
+	LES_LOG("LES_Test_Batch: success if no error output");
+}
+
+static void LES_Test_AsyncResult(void)
+{
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_LOG("LES_Test_AsyncResult: skipped : not connected to a server");
+		return;
+	}
+	unsigned int output_0 = 1;
+	unsigned short output_1 = 2;
+	LES_FunctionRPCHandle pollHandle;
+	LES_Test_InputOutputMixtureAsync(3, &output_0, 4, &output_1, pollHandle);
+	/* The call isn't sent until the next tick : a wait which times out straight away doesn't tick */
+	if (LES_CoreEngineWaitFunctionRPC(pollHandle, 0.0f, LES_NULL) != LES_FUNCTIONRPC_PENDING)
+	{
+		LES_FATAL_ERROR("LES_Test_AsyncResult call isn't pending before it has been sent");
+	}
+	LES_int32 result = LES_RETURN_ERROR;
+	int state = LES_CoreEnginePollFunctionRPC(pollHandle, &result);
+	const float startTime = LES_GetElapsedTimeInSeconds();
+	while ((state == LES_FUNCTIONRPC_PENDING) && ((LES_GetElapsedTimeInSeconds() - startTime) < 5.0f))
+	{
+		LES_CoreEngineTick();
+		LES_Sleep(0.001f);
+		state = LES_CoreEnginePollFunctionRPC(pollHandle, &result);
+	}
+	if ((state != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+	{
+		LES_FATAL_ERROR("LES_Test_AsyncResult Poll state:%d result:%d", state, result);
+	}
+	/* A complete call stays complete until its pending entry is reused */
+	result = LES_RETURN_ERROR;
+	if ((LES_CoreEnginePollFunctionRPC(pollHandle, &result) != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+	{
+		LES_FATAL_ERROR("LES_Test_AsyncResult Poll again result:%d", result);
+	}
+
+	LES_FunctionRPCHandle waitHandle;
+	LES_Test_InputOutputMixtureAsync(5, &output_0, 6, &output_1, waitHandle);
+	if (waitHandle == pollHandle)
+	{
+		LES_FATAL_ERROR("LES_Test_AsyncResult handles aren't unique 0x%X", waitHandle);
+	}
+	result = LES_RETURN_ERROR;
+	state = LES_CoreEngineWaitFunctionRPC(waitHandle, 5.0f, &result);
+	if ((state != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+	{
+		LES_FATAL_ERROR("LES_Test_AsyncResult Wait state:%d result:%d", state, result);
+	}
+	LES_LOG("LES_Test_AsyncResult: success if no error output");
 }
 
-static void LES_Test_DecodeInputArraySTRUCTB(TestStruct1 input_0[2], TestStruct2 input_1[1])
+/* Byte i of the array is (start + (i >> 4)) : the server checks it against input_0, the runs of 16 bytes compress */
+static void LES_Test_FillLargeInput(char* const input_1, const int numChars, const int start)
 {
-	const char* const testFuncName = "LES_Test_DecodeInputArraySTRUCTB";
-	LES_FunctionParameterData* parameterData = LES_NULL;
-
-	LES_FUNCTION_START(LES_Test_DecodeInputArraySTRUCTB, void);
-	LES_FUNCTION_ADD_INPUT(TestStruct1[2], input_0);
-	LES_FUNCTION_ADD_INPUT(TestStruct2[1], input_1);
-	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
-	LES_FUNCTION_END();
-
-	const int realParameterDataSize = 0 +
-												2 * (sizeof(long long int)+sizeof(char)+sizeof(int)+sizeof(short)+sizeof(float)) +
-												1 * (sizeof(float)+
-														 sizeof(long long int)+sizeof(char)+sizeof(int)+sizeof(short)+sizeof(float)+
-														 sizeof(char)+ sizeof(short)+ sizeof(int));
-
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+	for (int i = 0; i < numChars; i++)
+	{
+		input_1[i] = (char)(start + (i >> 4));
+	}
 }
 
-static void LES_Test_DecodeOutputArraySTRUCT(TestStruct3 output_0[2], TestStruct4 output_1[1])
+static void LES_Test_SendSegments(void)
 {
-	const char* const testFuncName = "LES_Test_DecodeOutputArraySTRUCT";
-	LES_FunctionParameterData* parameterData = LES_NULL;
-
-	LES_FUNCTION_START(LES_Test_DecodeOutputArraySTRUCT, void);
-	LES_FUNCTION_ADD_OUTPUT(TestStruct3[2], output_0);
-	LES_FUNCTION_ADD_OUTPUT(TestStruct4[1], output_1);
-	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
-	LES_FUNCTION_END();
-
-	const int realParameterDataSize = 0 +
-												2 * (sizeof(short) + sizeof(float) + sizeof(int) + sizeof(char)) +
-											 	1 * (sizeof(float) + sizeof(int) + sizeof(char) + sizeof(short) + sizeof(short) +
-															(sizeof(short) + sizeof(float) + sizeof(int) + sizeof(char))) +
-												0;
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_LOG("LES_Test_SendSegments: skipped : not connected to a server");
+		return;
+	}
+	const int numChars = 8192;
+	char* const input_1 = new char[numChars];
+	int input_0 = 0x35;
+	LES_Test_FillLargeInput(input_1, numChars, input_0);
+
+	/* Each write sends at most maxWriteSize bytes : the message memory and the array are split part way through */
+	const int maxWriteSize = 1000;
+	int numWritesStart = LES_TCPSocket::GetNumSegmentsWrites();
+	LES_TCPSocket::SetMaxSegmentsWriteSize(maxWriteSize);
+	LES_FunctionRPCHandle rpcHandle;
+	LES_Test_LargeInputAsync(input_0, input_1, rpcHandle);
+	LES_int32 result = LES_RETURN_ERROR;
+	const int state = LES_CoreEngineWaitFunctionRPC(rpcHandle, 5.0f, &result);
+	LES_TCPSocket::SetMaxSegmentsWriteSize(0);
+	if ((state != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+	{
+		LES_FATAL_ERROR("LES_Test_SendSegments NOCOPY async state:%d result:%d", state, result);
+	}
+	int numWrites = LES_TCPSocket::GetNumSegmentsWrites() - numWritesStart;
+	if (numWrites <= (numChars / maxWriteSize))
+	{
+		LES_FATAL_ERROR("LES_Test_SendSegments NOCOPY async numWrites:%d expected more than:%d", numWrites, numChars / maxWriteSize);
+	}
 
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+	/* The call has completed when LES_FUNCTION_END_NOCOPY returns : the input memory can be changed straight away */
+	input_0 = 0x47;
+	LES_Test_FillLargeInput(input_1, numChars, input_0);
+	numWritesStart = LES_TCPSocket::GetNumSegmentsWrites();
+	LES_Test_LargeInput(input_0, input_1);
+	numWrites = LES_TCPSocket::GetNumSegmentsWrites() - numWritesStart;
+	memset(input_1, 0, (size_t)numChars);
+	if (numWrites != 1)
+	{
+		LES_FATAL_ERROR("LES_Test_SendSegments NOCOPY numWrites:%d expected:1", numWrites);
+	}
+	delete[] input_1;
+	LES_LOG("LES_Test_SendSegments: success if no error output");
 }
 
-static void LES_Test_DecodeInputArrayReference(char (&input_0)[3], short (&input_1)[3])
+static void LES_Test_SendCompression(void)
 {
-	const char* const testFuncName = "LES_Test_DecodeInputArrayReference";
-	LES_FunctionParameterData* parameterData = LES_NULL;
-
-	LES_FUNCTION_START(LES_Test_DecodeInputArrayReference, void);
-	LES_FUNCTION_ADD_INPUT(char&[3], input_0);
-	LES_FUNCTION_ADD_INPUT(short&[3], input_1);
-	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
-	LES_FUNCTION_END();
-
-	const int realParameterDataSize = sizeof(char) * 3 + sizeof(short) * 3;
-
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_LOG("LES_Test_SendCompression: skipped : not connected to a server");
+		return;
+	}
+	if (LES_NetworkGetSendCompression() == false)
+	{
+		LES_LOG("LES_Test_SendCompression: skipped : compression wasn't negotiated");
+		return;
+	}
+	const int numChars = 8192;
+	char* const input_1 = new char[numChars];
+	const int input_0 = 0x29;
+	LES_Test_FillLargeInput(input_1, numChars, input_0);
+
+	/* The array is copied into the parameter data : the network thread compresses it and the server decompresses it */
+	const int numCompressedStart = LES_NetworkGetNumCompressedSends();
+	LES_FunctionRPCHandle rpcHandle;
+	LES_Test_LargeInputCopyAsync(input_0, input_1, rpcHandle);
+	memset(input_1, 0, (size_t)numChars);
+	LES_int32 result = LES_RETURN_ERROR;
+	const int state = LES_CoreEngineWaitFunctionRPC(rpcHandle, 5.0f, &result);
+	if ((state != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+	{
+		LES_FATAL_ERROR("LES_Test_SendCompression state:%d result:%d", state, result);
+	}
+	const int numCompressed = LES_NetworkGetNumCompressedSends() - numCompressedStart;
+	if (numCompressed != 1)
+	{
+		LES_FATAL_ERROR("LES_Test_SendCompression numCompressed:%d expected:1", numCompressed);
+	}
+	delete[] input_1;
+	LES_LOG("LES_Test_SendCompression: success if no error output");
 }
 
-static void LES_Test_DecodeOutputArrayReference(short (&output_0)[3], int (&output_1)[3])
+static void LES_Test_RPCOutputs(void)
 {
-	const char* const testFuncName = "LES_Test_DecodeOutputArrayReference";
-	LES_FunctionParameterData* parameterData = LES_NULL;
-
-	LES_FUNCTION_START(LES_Test_DecodeOutputArrayReference, void);
-	LES_FUNCTION_ADD_OUTPUT(short&[3], output_0);
-	LES_FUNCTION_ADD_OUTPUT(int&[3], output_1);
-	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
-	LES_FUNCTION_END();
-
-	const int realParameterDataSize = sizeof(short) * 3 + sizeof(int) * 3;
-
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_LOG("LES_Test_RPCOutputs: skipped : not connected to a server");
+		return;
+	}
+	/* The test server echoes the output values which were sent : the caller's memory is cleared after the call */
+	LES_FunctionRPCHandle rpcHandles[2];
+	unsigned int output_0 = 0xDEADBEEF;
+	unsigned short output_1 = 0xCAFE;
+	LES_Test_InputOutputMixtureAsync(12, &output_0, 34, &output_1, rpcHandles[0]);
+	output_0 = 0;
+	output_1 = 0;
+
+	short arrayOutput_0[3] = { -1234, 5678, -32000 };
+	int arrayOutput_1[3] = { 0x12345678, -2, 0x7FFFFFFF };
+	LES_Test_DecodeOutputArrayReferenceAsync(arrayOutput_0, arrayOutput_1, rpcHandles[1]);
+	memset(arrayOutput_0, 0, sizeof(arrayOutput_0));
+	memset(arrayOutput_1, 0, sizeof(arrayOutput_1));
+
+	for (int i = 0; i < 2; i++)
+	{
+		LES_int32 result = LES_RETURN_ERROR;
+		const int state = LES_CoreEngineWaitFunctionRPC(rpcHandles[i], 5.0f, &result);
+		if ((state != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+		{
+			LES_FATAL_ERROR("LES_Test_RPCOutputs call:%d state:%d result:%d", i, state, result);
+		}
+	}
+	if ((output_0 != 0xDEADBEEF) || (output_1 != 0xCAFE))
+	{
+		LES_FATAL_ERROR("LES_Test_RPCOutputs pointer outputs 0x%X 0x%X expected 0xDEADBEEF 0xCAFE", output_0, output_1);
+	}
+	if ((arrayOutput_0[0] != -1234) || (arrayOutput_0[1] != 5678) || (arrayOutput_0[2] != -32000) ||
+			(arrayOutput_1[0] != 0x12345678) || (arrayOutput_1[1] != -2) || (arrayOutput_1[2] != 0x7FFFFFFF))
+	{
+		LES_FATAL_ERROR("LES_Test_RPCOutputs array outputs weren't written back %d %d %d 0x%X %d 0x%X", 
+										arrayOutput_0[0], arrayOutput_0[1], arrayOutput_0[2], arrayOutput_1[0], arrayOutput_1[1], arrayOutput_1[2]);
+	}
+	LES_LOG("LES_Test_RPCOutputs: success if no error output");
 }
 
-static void LES_Test_DecodeInputStructPODArray(TestStruct9 input_0)
+static void LES_Test_WaitForServerReady(const char* const testName)
 {
-	const char* const testFuncName = "LES_Test_DecodeInputStructPODArray";
-	LES_FunctionParameterData* parameterData = LES_NULL;
-
-	LES_FUNCTION_START(LES_Test_DecodeInputStructPODArray, void);
-	LES_FUNCTION_ADD_INPUT(TestStruct9, input_0);
-	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
-	LES_FUNCTION_END();
-
-	const int realParameterDataSize = 3 * sizeof(short);
-
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+	const float startTime = LES_GetElapsedTimeInSeconds();
+	while ((LES_CoreEngineGetState() != LES_STATE_READY) && ((LES_GetElapsedTimeInSeconds() - startTime) < 5.0f))
+	{
+		LES_CoreEngineTick();
+		LES_Sleep(0.001f);
+	}
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_FATAL_ERROR("%s not ready after reconnect state:%d", testName, LES_CoreEngineGetState());
+	}
 }
 
-static void LES_Test_DecodeInputStructStructArray(TestStruct10 input_0)
+static void LES_Test_DeltaCall(const char* const step, const char* const input_0, const int expectedNumKeyframes, 
+															 const int expectedNumDeltas)
 {
-	const char* const testFuncName = "LES_Test_DecodeInputStructStructArray";
-	LES_FunctionParameterData* parameterData = LES_NULL;
-
-#if 0
-	LES_LOG("m_short[0] = %p", &(input_0.m_short[0]));
-	LES_LOG("m_short[1] = %p", &(input_0.m_short[1]));
-	LES_LOG("m_short[2] = %p", &(input_0.m_short[2]));
-	LES_LOG("m_testStruct9[0] = %p", &(input_0.m_testStruct9[0]));
-	LES_LOG("m_testStruct9[0].m_short[0] = %p", &(input_0.m_testStruct9[0].m_short[0]));
-	LES_LOG("m_testStruct9[0].m_short[1] = %p", &(input_0.m_testStruct9[0].m_short[1]));
-	LES_LOG("m_testStruct9[0].m_short[2] = %p", &(input_0.m_testStruct9[0].m_short[2]));
-	LES_LOG("m_testStruct9[1] = %p", &(input_0.m_testStruct9[1]));
-	LES_LOG("m_testStruct9[1].m_short[0] = %p", &(input_0.m_testStruct9[1].m_short[0]));
-	LES_LOG("m_testStruct9[1].m_short[1] = %p", &(input_0.m_testStruct9[1].m_short[1]));
-	LES_LOG("m_testStruct9[1].m_short[2] = %p", &(input_0.m_testStruct9[1].m_short[2]));
-#endif // #if 0
-	LES_FUNCTION_START(LES_Test_DecodeInputStructStructArray, void);
-	LES_FUNCTION_ADD_INPUT(TestStruct10, input_0);
-	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
-	LES_FUNCTION_END();
-
-	const int realParameterDataSize = 3 * sizeof(short) +
-																		2 * (sizeof(short) * 3);
-
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+	short jake[3] = { 2731, 2732, 2733 };
+	LES_DynamicArray<short> input_1 = { jake, 3 };
+	TestStruct16 input_2 = { "bob", { LES_NULL, 0 } };
+	LES_FunctionRPCHandle rpcHandle;
+	LES_Test_DecodeInputVariableSizeAsync(input_0, input_1, input_2, rpcHandle);
+
+	/* The server only decodes the call if it has made the same parameter data from the delta */
+	LES_int32 result = LES_RETURN_ERROR;
+	const int state = LES_CoreEngineWaitFunctionRPC(rpcHandle, 5.0f, &result);
+	if ((state != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+	{
+		LES_FATAL_ERROR("LES_Test_Delta %s state:%d result:%d", step, state, result);
+	}
+	int numKeyframes = 0;
+	int numDeltas = 0;
+	LES_CoreEngineGetFunctionRPCDeltaStats("LES_Test_DecodeInputVariableSize", &numKeyframes, &numDeltas);
+	if ((numKeyframes != expectedNumKeyframes) || (numDeltas != expectedNumDeltas))
+	{
+		LES_FATAL_ERROR("LES_Test_Delta %s numKeyframes:%d expected:%d numDeltas:%d expected:%d", 
+										step, numKeyframes, expectedNumKeyframes, numDeltas, expectedNumDeltas);
+	}
 }
 
-static void LES_Test_DecodeInputStructPODArrayReference(TestStruct11 input_0)
+static void LES_Test_Delta(void)
 {
-	const char* const testFuncName = "LES_Test_DecodeInputStructPODArrayReference";
-	LES_FunctionParameterData* parameterData = LES_NULL;
-
-	LES_FUNCTION_START(LES_Test_DecodeInputStructPODArrayReference, void);
-	LES_FUNCTION_ADD_INPUT(TestStruct11, input_0);
-	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
-	LES_FUNCTION_END();
-
-	const int realParameterDataSize = 3 * sizeof(short) + 2 * sizeof(int) + 5 * sizeof(char);
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_LOG("LES_Test_Delta: skipped : not connected to a server");
+		return;
+	}
+	LES_CoreEngineSetFunctionRPCDelta("LES_Test_DecodeInputVariableSize", true);
+	LES_Test_DeltaCall("first call", "hello", 1, 0);
+	LES_Test_DeltaCall("same size", "jello", 1, 1);
+	LES_Test_DeltaCall("size change", "hello world", 2, 1);
+	/* The server starts a new delta history for a new connection */
+	LES_CoreEngineReconnect();
+	LES_Test_WaitForServerReady("LES_Test_Delta");
+	LES_Test_DeltaCall("reconnect", "hello world", 3, 1);
+	LES_CoreEngineSetFunctionRPCDelta("LES_Test_DecodeInputVariableSize", false);
+	LES_LOG("LES_Test_Delta: success if no error output");
+}
 
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+/* The server decodes the inputs & echoes the outputs with the negotiated encoding : values which need several varint bytes */
+static void LES_Test_NegotiatedCalls(const char* const testName)
+{
+	LES_FunctionRPCHandle rpcHandles[3];
+	unsigned int output_0 = 0xFEDCBA98;
+	unsigned short output_1 = 0x8001;
+	LES_Test_InputOutputMixtureAsync(0xABCD, &output_0, 0xEF, &output_1, rpcHandles[0]);
+	output_0 = 0;
+	output_1 = 0;
+
+	short arrayOutput_0[3] = { -1, 300, -32768 };
+	int arrayOutput_1[3] = { (int)0x80000000, -129, 0x12345 };
+	LES_Test_DecodeOutputArrayReferenceAsync(arrayOutput_0, arrayOutput_1, rpcHandles[1]);
+	memset(arrayOutput_0, 0, sizeof(arrayOutput_0));
+	memset(arrayOutput_1, 0, sizeof(arrayOutput_1));
+
+	/* The server checks the array against the low byte of input_0 */
+	const int numChars = 8192;
+	char* const input_1 = new char[numChars];
+	const int input_0 = 0x12345631;
+	LES_Test_FillLargeInput(input_1, numChars, input_0);
+	LES_Test_LargeInputCopyAsync(input_0, input_1, rpcHandles[2]);
+	delete[] input_1;
+
+	for (int i = 0; i < 3; i++)
+	{
+		LES_int32 result = LES_RETURN_ERROR;
+		const int state = LES_CoreEngineWaitFunctionRPC(rpcHandles[i], 5.0f, &result);
+		if ((state != LES_FUNCTIONRPC_COMPLETE) || (result != LES_RETURN_OK))
+		{
+			LES_FATAL_ERROR("%s call:%d state:%d result:%d", testName, i, state, result);
+		}
+	}
+	if ((output_0 != 0xFEDCBA98) || (output_1 != 0x8001))
+	{
+		LES_FATAL_ERROR("%s pointer outputs 0x%X 0x%X expected 0xFEDCBA98 0x8001", testName, output_0, output_1);
+	}
+	if ((arrayOutput_0[0] != -1) || (arrayOutput_0[1] != 300) || (arrayOutput_0[2] != -32768) ||
+			(arrayOutput_1[0] != (int)0x80000000) || (arrayOutput_1[1] != -129) || (arrayOutput_1[2] != 0x12345))
+	{
+		LES_FATAL_ERROR("%s array outputs %d %d %d 0x%X %d 0x%X", testName, 
+										arrayOutput_0[0], arrayOutput_0[1], arrayOutput_0[2], arrayOutput_1[0], arrayOutput_1[1], arrayOutput_1[2]);
+	}
 }
 
-static void LES_Test_DecodeInputStructStructArrayReference(TestStruct12 input_0)
+static void LES_Test_VarintNegotiated(void)
 {
-	const char* const testFuncName = "LES_Test_DecodeInputStructStructArrayReference";
-	LES_FunctionParameterData* parameterData = LES_NULL;
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_LOG("LES_Test_VarintNegotiated: skipped : not connected to a server");
+		return;
+	}
+	bool nativeEndian;
+	bool varint;
+	bool compression;
+	LES_CoreEngineGetConnectOptions(&nativeEndian, &varint, &compression);
+	LES_CoreEngineSetConnectOptions(nativeEndian, true, compression);
+	LES_CoreEngineReconnect();
+	LES_Test_WaitForServerReady("LES_Test_VarintNegotiated");
+	if (LES_IsParameterDataVarint() == false)
+	{
+		LES_FATAL_ERROR("LES_Test_VarintNegotiated varint wasn't negotiated");
+	}
 
-	LES_FUNCTION_START(LES_Test_DecodeInputStructStructArrayReference, void);
-	LES_FUNCTION_ADD_INPUT(TestStruct12, input_0);
-	LES_FUNCTION_GET_PARAMETER_DATA(parameterData);
-	LES_FUNCTION_END();
+	LES_Test_NegotiatedCalls("LES_Test_VarintNegotiated");
 
-	const int realParameterDataSize = 3 * sizeof(short) +
-																		2 * (3 * sizeof(short)) +
-																		1 * (3 * sizeof(short) + 2 * sizeof(int) + 5 * sizeof(char));
+	/* Later tests use the default encoding */
+	LES_CoreEngineSetConnectOptions(nativeEndian, varint, compression);
+	LES_CoreEngineReconnect();
+	LES_Test_WaitForServerReady("LES_Test_VarintNegotiated");
+	if (LES_IsParameterDataVarint() != varint)
+	{
+		LES_FATAL_ERROR("LES_Test_VarintNegotiated varint:%d after reconnect expected:%d", LES_IsParameterDataVarint(), varint);
+	}
+	LES_LOG("LES_Test_VarintNegotiated: success if no error output");
+}
 
-	LES_Test_GenericDecodeHelper(testFuncName, parameterData, realParameterDataSize);
-	return;
+/* Big endian parameter data is swapped by the SWAP plan ops, native endian data is copied */
+static void LES_Test_NativeEndianNegotiated(void)
+{
+	if (LES_CoreEngineGetState() != LES_STATE_READY)
+	{
+		LES_LOG("LES_Test_NativeEndianNegotiated: skipped : not connected to a server");
+		return;
+	}
+	bool nativeEndian;
+	bool varint;
+	bool compression;
+	LES_CoreEngineGetConnectOptions(&nativeEndian, &varint, &compression);
+	for (int i = 0; i < 2; i++)
+	{
+		const bool offerNativeEndian = (i == 1);
+		LES_CoreEngineSetConnectOptions(offerNativeEndian, varint, compression);
+		LES_CoreEngineReconnect();
+		LES_Test_WaitForServerReady("LES_Test_NativeEndianNegotiated");
+		/* The test server runs on the same machine : it always agrees to native endian */
+		if (LES_IsParameterDataNativeEndian() != offerNativeEndian)
+		{
+			LES_FATAL_ERROR("LES_Test_NativeEndianNegotiated nativeEndian:%d expected:%d", 
+											LES_IsParameterDataNativeEndian(), offerNativeEndian);
+		}
+		LES_Test_NegotiatedCalls(offerNativeEndian ? "LES_Test_NativeEndianNegotiated native" : "LES_Test_NativeEndianNegotiated big endian");
+	}
+	LES_CoreEngineSetConnectOptions(nativeEndian, varint, compression);
+	if (nativeEndian == false)
+	{
+		LES_CoreEngineReconnect();
+		LES_Test_WaitForServerReady("LES_Test_NativeEndianNegotiated");
+	}
+	LES_LOG("LES_Test_NativeEndianNegotiated: success if no error output");
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1267,17 +3153,27 @@ int LES_TestSetup(void)
 	if (s_testPhase == 1)
 	{
 		s_pDecodeLogChannel = LES_Logger::CreateChannel("Decode", "", "decode.txt", LES_LOGGERCHANNEL_FLAGS_FILE_OUTPUT);
+		LES_Test_CompileTimeHash();
+		LES_Test_ParameterDataInPlaceMessage();
+		LES_Test_ParameterPool();
+		LES_Test_ParameterStubs();
+		LES_Test_CompletionQueue();
+		LES_Test_EndianSwapArrays();
+		LES_Test_Compress();
+#if LES_COMPILETIME_HASH
+		LES_Test_TypeTraits();
+#endif // #if LES_COMPILETIME_HASH
 		/* Sample types for development */
 		LES_TEST_ADD_TYPE_POD(unsigned char);
-		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(unsigned short);
-		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(unsigned int);
-		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(unsigned long);
+		LES_TEST_ADD_TYPE_POD_INTEGER(unsigned short);
+		LES_TEST_ADD_TYPE_POD_INTEGER(unsigned int);
+		LES_TEST_ADD_TYPE_POD_INTEGER(unsigned long);
 
 		LES_TEST_ADD_TYPE_POD(char);
-		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(short);
-		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(int);
-		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(long);
-		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(long long int);
+		LES_TEST_ADD_TYPE_POD_INTEGER(short);
+		LES_TEST_ADD_TYPE_POD_INTEGER(int);
+		LES_TEST_ADD_TYPE_POD_INTEGER(long);
+		LES_TEST_ADD_TYPE_POD_INTEGER(long long int);
 
 		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(float);
 		LES_TEST_ADD_TYPE_POD_ENDIANSWAP(double);
@@ -1303,6 +3199,7 @@ int LES_TestSetup(void)
 		LES_TEST_ADD_TYPE_POD_ARRAY(char, 3);
 		LES_TEST_ADD_TYPE_POD_ARRAY(short, 3);
 		LES_TEST_ADD_TYPE_POD_ARRAY(int, 3);
+		LES_TEST_ADD_TYPE_POD_ARRAY(char, 8192);
 
 		LES_TEST_ADD_TYPE_POD_REFERENCE_ARRAY(char, 3, LES_TYPE_INPUT_OUTPUT);
 		LES_TEST_ADD_TYPE_POD_REFERENCE_ARRAY(short, 3, LES_TYPE_INPUT_OUTPUT);
@@ -1442,6 +3339,17 @@ int LES_TestSetup(void)
 
 		LES_TEST_ADD_TYPE_STRUCT(TestStruct12);
 
+		LES_TEST_ADD_TYPE_STRING(LES_String, 16);
+		LES_TEST_ADD_TYPE_DYNAMIC_ARRAY(short, 8);
+		LES_TEST_ADD_TYPE_DYNAMIC_ARRAY(int, 4);
+
+		LES_TEST_STRUCT_START(TestStruct16, 2);
+		LES_TEST_STRUCT_ADD_MEMBER(LES_String, m_name);
+		LES_TEST_STRUCT_ADD_MEMBER(LES_DynamicArray<int>, m_int);
+		LES_TEST_STRUCT_END();
+
+		LES_TEST_ADD_TYPE_STRUCT(TestStruct16);
+
 		/* Sample functions for development */
 		LES_TEST_FUNCTION_START(jakeInit, void, 2, 1);
 		LES_TEST_FUNCTION_ADD_INPUT(int, a);
@@ -1815,6 +3723,25 @@ int LES_TestSetup(void)
 		LES_TEST_FUNCTION_ADD_INPUT(TestStruct12, input_0);
 		LES_TEST_FUNCTION_END();
 
+		LES_TEST_FUNCTION_START(LES_Test_DecodeInputVariableSize, void, 3, 0);
+		LES_TEST_FUNCTION_ADD_INPUT(LES_String, input_0);
+		LES_TEST_FUNCTION_ADD_INPUT(LES_DynamicArray<short>, input_1);
+		LES_TEST_FUNCTION_ADD_INPUT(TestStruct16, input_2);
+		LES_TEST_FUNCTION_END();
+
+		/* Needs the function definitions */
+		LES_Test_ReadPlan();
+		LES_Test_Varint();
+		LES_Test_TrivialStructs();
+		LES_Test_ParameterReferences();
+		LES_Test_ReadTruncated();
+		LES_Test_DecodeVisitor();
+		LES_Test_HashIndex();
+		LES_Test_HashData();
+		LES_Test_DefinitionIndexes();
+		LES_Test_ResolvedTypes();
+		LES_Test_TypeCache();
+		LES_Test_PlanGeneration();
 		return LES_RETURN_OK;
 	}
 	if (s_testPhase == 2)
@@ -2640,6 +4567,80 @@ int LES_TestSetup(void)
 		LES_LOG("sizeof(Jake)=%d",sizeof(Jake));
 		return LES_RETURN_OK;
 	}
+	if (s_testPhase == 65)
+	{
+		LES_LOG("");
+		short jake[3] = { 2731, 2732, 2733 };
+		LES_DynamicArray<short> var_in_1 = { jake, 3 };
+		TestStruct16 var_in_2 = { "bob", { LES_NULL, 0 } };
+		LES_Test_DecodeInputVariableSize("hello", var_in_1, var_in_2);
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 66)
+	{
+		LES_LOG("");
+		LES_LOG("#### Typed call tests ####");
+#if LES_COMPILETIME_HASH
+		LES_Test_Call();
+#endif // #if LES_COMPILETIME_HASH
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 67)
+	{
+		LES_LOG("");
+		LES_LOG("#### Batch tests ####");
+		LES_Test_Batch();
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 68)
+	{
+		LES_LOG("");
+		LES_LOG("#### Delta tests ####");
+		LES_Test_Delta();
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 69)
+	{
+		LES_LOG("");
+		LES_LOG("#### RPC output tests ####");
+		LES_Test_RPCOutputs();
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 70)
+	{
+		LES_LOG("");
+		LES_LOG("#### Async result tests ####");
+		LES_Test_AsyncResult();
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 71)
+	{
+		LES_LOG("");
+		LES_LOG("#### Send segments tests ####");
+		LES_Test_SendSegments();
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 72)
+	{
+		LES_LOG("");
+		LES_LOG("#### Compression tests ####");
+		LES_Test_SendCompression();
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 73)
+	{
+		LES_LOG("");
+		LES_LOG("#### Varint negotiation tests ####");
+		LES_Test_VarintNegotiated();
+		return LES_RETURN_OK;
+	}
+	if (s_testPhase == 74)
+	{
+		LES_LOG("");
+		LES_LOG("#### Native endian negotiation tests ####");
+		LES_Test_NativeEndianNegotiated();
+		return LES_RETURN_OK;
+	}
 	if (s_testPhase > 80)
 	{
 		return LES_RETURN_ERROR;
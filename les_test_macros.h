@@ -77,6 +77,10 @@ bool LES_TestFunctionEnd(LES_FunctionDefinition* const functionDefinitionPtr, LE
 	LES_TEST_ADD_TYPE_EX(TYPE, sizeof(TYPE), LES_TYPE_INPUT|LES_TYPE_POD|LES_TYPE_ENDIANSWAP, TYPE, 0) \
 
 
+#define LES_TEST_ADD_TYPE_POD_INTEGER(TYPE) \
+	LES_TEST_ADD_TYPE_EX(TYPE, sizeof(TYPE), LES_TYPE_INPUT|LES_TYPE_POD|LES_TYPE_ENDIANSWAP|LES_TYPE_INTEGER, TYPE, 0) \
+
+
 #define LES_TEST_ADD_TYPE_POD_POINTER(TYPE, FLAGS) \
 	LES_TEST_ADD_TYPE_EX(TYPE*, sizeof(TYPE*), FLAGS|LES_TYPE_POINTER|LES_TYPE_POD, TYPE, 0) \
 
@@ -113,6 +117,14 @@ bool LES_TestFunctionEnd(LES_FunctionDefinition* const functionDefinitionPtr, LE
 	LES_TEST_ADD_TYPE_EX(TYPE&[NUM_ELEMENTS], sizeof(TYPE*), LES_TYPE_ARRAY|FLAGS|LES_TYPE_REFERENCE|LES_TYPE_STRUCT, TYPE*, NUM_ELEMENTS) \
 
 
+#define LES_TEST_ADD_TYPE_STRING(TYPE, MAX_LENGTH) \
+	LES_TEST_ADD_TYPE_EX(TYPE, sizeof(TYPE), LES_TYPE_INPUT|LES_TYPE_STRING, char, MAX_LENGTH) \
+
+
+#define LES_TEST_ADD_TYPE_DYNAMIC_ARRAY(TYPE, MAX_ELEMENTS) \
+	LES_TEST_ADD_TYPE_EX(LES_DynamicArray<TYPE>, sizeof(LES_DynamicArray<TYPE>), LES_TYPE_INPUT|LES_TYPE_DYNAMIC_ARRAY, TYPE, MAX_ELEMENTS) \
+
+
 
 struct LES_TEST_STRUCT_DATA
 {
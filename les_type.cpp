@@ -5,6 +5,8 @@
 #include "les_stringentry.h"
 #include "les_struct.h"
 #include "les_typedata.h"
+#include "les_hashindex.h"
+#include "les_hashdata.h"
 
 #include <string.h>
 
@@ -16,6 +18,49 @@ static int les_numTypeEntries = 0;
 static const LES_TypeData* les_pTypeData = LES_NULL;
 static int les_typeDataNumTypes = 0;
 
+/* Perfect hash of the definition file type data : NULL if the definition file doesn't have one */
+static const LES_HashTable* les_pTypeDataHashTable = LES_NULL;
+
+/* Type entry IDs by type hash : the internal list and the definition file type data if it isn't perfect hashed */
+static LES_HashIndex les_typeEntryIndex;
+
+/*
+ * The trivial struct flags by type ID : they are derived when the struct definitions are loaded
+ * They aren't kept in the type entries because those can be in the definition file memory
+*/
+static LES_uint32* les_typeTrivialFlagsArray = LES_NULL;
+static int les_typeTrivialFlagsArraySize = 0;
+
+/*
+ * The resolved schema : struct members, function parameters and aliases reference types by string ID
+ * les_typeIDByStringID maps a string ID to its type ID (-1 if the string isn't a type)
+ * les_resolvedTypeArray is indexed by type ID : the root type and the struct definition of the root type
+ * Both are built when the type data is set and kept up to date as types and struct definitions are added
+ * The sizes, alignment and pointers flag are computed the first time they are used : m_resolvedFlags has the valid ones
+ * A struct definition can be added after the types which use it : failures aren't kept and are computed again
+*/
+#define LES_RESOLVED_DATA_STORAGE_SIZE 				(1<<0)
+#define LES_RESOLVED_MIN_DATA_STORAGE_SIZE 		(1<<1)
+#define LES_RESOLVED_ALIGNMENT 								(1<<2)
+#define LES_RESOLVED_CONTAINS_POINTERS 				(1<<3)
+
+struct LES_ResolvedType
+{
+	const LES_TypeEntry* m_rootType;									// NULL until the aliased types are found
+	const LES_StructDefinition* m_structDefinition;		// NULL if the type isn't a struct
+	LES_int32 m_dataStorageSize;
+	LES_int32 m_minDataStorageSize;
+	LES_int32 m_alignment;
+	LES_int32 m_containsPointers;
+	LES_uint32 m_resolvedFlags;
+};
+
+static LES_int32* les_typeIDByStringID = LES_NULL;
+static int les_typeIDByStringIDSize = 0;
+
+static LES_ResolvedType* les_resolvedTypeArray = LES_NULL;
+static int les_resolvedTypeArraySize = 0;
+
 LES_Hash LES_TypeEntry::s_longlongHash = LES_GenerateHashCaseSensitive("long long int");
 LES_Hash LES_TypeEntry::s_intHash = LES_GenerateHashCaseSensitive("int");
 LES_Hash LES_TypeEntry::s_shortHash = LES_GenerateHashCaseSensitive("short");
@@ -29,6 +74,9 @@ LES_Hash LES_TypeEntry::s_floatHash = LES_GenerateHashCaseSensitive("float");
 
 extern int LES_GetStringEntryID(const LES_Hash hash, const char* const str);
 extern int LES_AddStringEntry(const char* const str);
+extern void LES_Struct_SetTrivialFlags(const LES_StructDefinition* const structDefinitionPtr);
+extern int LES_GetNumStringEntries(void);
+extern void LES_Function_BumpDefinitionGeneration(void);
 
 void LES_DebugOutputTypeEntry(LES_LoggerChannel* const pLogChannel, const LES_TypeEntry* const pTypeEntry, const int i);
 
@@ -38,27 +86,18 @@ void LES_DebugOutputTypeEntry(LES_LoggerChannel* const pLogChannel, const LES_Ty
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-static int LES_GetTypeEntrySlow(const LES_Hash hash)
+static int LES_GetTypeEntryID(const LES_Hash hash)
 {
-	if (les_pTypeData)
+	if (les_pTypeDataHashTable)
 	{
-		const int index = les_pTypeData->GetTypeEntrySlow(hash);
-		if (index >= 0)
+		const int index = les_pTypeDataHashTable->Find(hash);
+		if (les_pTypeData->GetTypeEntry(index)->m_hash == hash)
 		{
 			return index;
 		}
 	}
-
-	/* This is horribly slow - need hash lookup table */
-	for (int i = 0; i < les_numTypeEntries; i++)
-	{
-		const LES_TypeEntry* const typeEntryPtr = &les_typeEntryArray[i];
-		if (typeEntryPtr->m_hash == hash)
-		{
-			return (i + les_typeDataNumTypes);
-		}
-	}
-	return -1;
+	int slot;
+	return les_typeEntryIndex.Find(hash, &slot);
 }
 
 static const LES_TypeEntry* LES_GetTypeEntryForID(const int id)
@@ -78,66 +117,104 @@ static const LES_TypeEntry* LES_GetTypeEntryForID(const int id)
 	return pTypeEntry;
 }
 
-/////////////////////////////////////////////////////////////////////////////////////////////////
-//
-// Public External functions
-//
-/////////////////////////////////////////////////////////////////////////////////////////////////
+/* The type ID of a type entry from the type data or the internal list : -1 if it isn't registered */
+static int LES_GetTypeEntryIDForPtr(const LES_TypeEntry* const typeEntryPtr)
+{
+	if (les_typeDataNumTypes > 0)
+	{
+		const LES_TypeEntry* const firstTypeEntryPtr = les_pTypeData->GetTypeEntry(0);
+		if ((typeEntryPtr >= firstTypeEntryPtr) && (typeEntryPtr < firstTypeEntryPtr + les_typeDataNumTypes))
+		{
+			return (int)(typeEntryPtr - firstTypeEntryPtr);
+		}
+	}
+	if ((typeEntryPtr >= les_typeEntryArray) && (typeEntryPtr < les_typeEntryArray + les_numTypeEntries))
+	{
+		return (int)(typeEntryPtr - les_typeEntryArray) + les_typeDataNumTypes;
+	}
+	return -1;
+}
 
-const LES_TypeEntry* LES_GetTypeEntry(const LES_StringEntry* const typeStringEntry)
+static void LES_TypeResetTrivialFlags(const int numTypeIDs)
 {
-	const LES_Hash hash = typeStringEntry->m_hash;
-	const int id = LES_GetTypeEntrySlow(hash);
-	const LES_TypeEntry* const pTypeEntry = LES_GetTypeEntryForID(id);
-	return pTypeEntry;
+	delete[] les_typeTrivialFlagsArray;
+	les_typeTrivialFlagsArraySize = numTypeIDs;
+	les_typeTrivialFlagsArray = new LES_uint32[les_typeTrivialFlagsArraySize];
+	memset(les_typeTrivialFlagsArray, 0, sizeof(LES_uint32) * (size_t)les_typeTrivialFlagsArraySize);
 }
 
-const LES_TypeEntry* LES_TypeEntry::GetRootType(void) const
+static void LES_TypeSetTypeIDForStringID(const int stringID, const int typeID)
 {
-	const LES_TypeEntry* typeEntryPtr = this;
-	unsigned int flags = typeEntryPtr->m_flags;
-	while (flags & LES_TYPE_ALIAS)
+	if (stringID < 0)
 	{
-		const int aliasedTypeID = typeEntryPtr->m_aliasedTypeID;
-#if LES_TYPE_DEBUG
-			LES_LOG("Type 0x%X alias:%d flags:0x%X", typeEntryPtr->m_hash, aliasedTypeID, flags);
-#endif // #if LES_TYPE_DEBUG
-		const LES_StringEntry* const aliasedStringTypeEntry = LES_GetStringEntryForID(aliasedTypeID);
+		return;
+	}
+	if (stringID >= les_typeIDByStringIDSize)
+	{
+		int newSize = (les_typeIDByStringIDSize > 0) ? les_typeIDByStringIDSize : 1024;
+		while (newSize <= stringID)
+		{
+			newSize *= 2;
+		}
+		LES_int32* const newTypeIDByStringID = new LES_int32[newSize];
+		memset(newTypeIDByStringID, 0xFF, sizeof(LES_int32) * (size_t)newSize);
+		if (les_typeIDByStringID)
+		{
+			memcpy(newTypeIDByStringID, les_typeIDByStringID, sizeof(LES_int32) * (size_t)les_typeIDByStringIDSize);
+		}
+		delete[] les_typeIDByStringID;
+		les_typeIDByStringID = newTypeIDByStringID;
+		les_typeIDByStringIDSize = newSize;
+	}
+	les_typeIDByStringID[stringID] = typeID;
+}
+
+/* NULL if an aliased type isn't added yet : GetRootType reports it if it is still missing when used */
+static const LES_TypeEntry* LES_TypeFindRootType(const LES_TypeEntry* const inputTypeEntryPtr)
+{
+	const LES_TypeEntry* typeEntryPtr = inputTypeEntryPtr;
+	while (typeEntryPtr->m_flags & LES_TYPE_ALIAS)
+	{
+		const LES_StringEntry* const aliasedStringTypeEntry = LES_GetStringEntryForID(typeEntryPtr->m_aliasedTypeID);
 		if (aliasedStringTypeEntry == LES_NULL)
 		{
-			LES_FATAL_ERROR("GetRootType aliased type:%d entry can't be found", aliasedTypeID);
 			return LES_NULL;
 		}
-		const LES_TypeEntry* const aliasedTypeEntryPtr = LES_GetTypeEntry(aliasedStringTypeEntry);
-		if (aliasedTypeEntryPtr == LES_NULL)
+		typeEntryPtr = LES_GetTypeEntry(aliasedStringTypeEntry);
+		if (typeEntryPtr == LES_NULL)
 		{
-			LES_FATAL_ERROR("GetRootType aliased type not found aliased type:'%s'", aliasedStringTypeEntry->m_str);
 			return LES_NULL;
 		}
-#if LES_TYPE_DEBUG
-		LES_LOG("GetRootType Alignment Type 0x%X alias:%s", typeEntryPtr->m_hash, aliasedStringTypeEntry->m_str);
-#endif // #if LES_TYPE_DEBUG
-			typeEntryPtr = (const LES_TypeEntry*)aliasedTypeEntryPtr;
-			flags = typeEntryPtr->m_flags;
-#if LES_TYPE_DEBUG
-		LES_LOG("Alias Type 0x%X flags:0x%X", typeEntryPtr->m_hash, flags);
-#endif // #if LES_TYPE_DEBUG
 	}
 	return typeEntryPtr;
 }
 
-int LES_TypeEntry::ComputeDataStorageSize(void) const
+static int LES_TypeGetDataStorageSize(const LES_TypeEntry* const typeEntryPtr, const bool minimum);
+
+/* minimum is the size when every variable sized type is empty : otherwise it is the maximum size */
+static int LES_TypeComputeDataStorageSize(const LES_TypeEntry* const inputTypeEntryPtr, const bool minimum)
 {
-	const LES_TypeEntry* typeEntryPtr = this;
+	const LES_TypeEntry* typeEntryPtr = inputTypeEntryPtr;
 	unsigned int flags = typeEntryPtr->m_flags;
 	const int numElements = typeEntryPtr->m_numElements;
 
+	/* The count is always written : the maximum number of items follow it */
+	int countSize = 0;
+	if (flags & LES_TYPE_VARIABLE_SIZE)
+	{
+		if (minimum)
+		{
+			return LES_TYPE_COUNT_SIZE;
+		}
+		countSize = LES_TYPE_COUNT_SIZE;
+	}
+
 	typeEntryPtr = typeEntryPtr->GetRootType();
 	flags = typeEntryPtr->m_flags;
 
 	if (flags & LES_TYPE_STRUCT)
 	{
-		const LES_StructDefinition* const structDefinition = LES_GetStructDefinition(typeEntryPtr->m_hash);
+		const LES_StructDefinition* const structDefinition = typeEntryPtr->GetStructDefinition();
 		if (structDefinition == LES_NULL)
 		{
 			LES_WARNING("ComputeDataStorageSize type:0x%X is a struct but can't be found", typeEntryPtr->m_hash);
@@ -148,10 +225,8 @@ int LES_TypeEntry::ComputeDataStorageSize(void) const
 		for (int i = 0; i < numMembers; i++)
 		{
 			const LES_StructMember* const structMember = structDefinition->GetMemberByIndex(i);
-			const int memberTypeID = structMember->m_typeID;
-			const LES_StringEntry* const memberTypeStringEntry = LES_GetStringEntryForID(memberTypeID);
-			const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntry(memberTypeStringEntry);
-			const int dataSize = memberTypeEntryPtr->ComputeDataStorageSize();
+			const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntryForStringID(structMember->m_typeID);
+			const int dataSize = LES_TypeGetDataStorageSize(memberTypeEntryPtr, minimum);
 			if (dataSize == -1)
 			{
 				return -1;
@@ -165,22 +240,51 @@ int LES_TypeEntry::ComputeDataStorageSize(void) const
 #endif // #if LES_TYPE_DEBUG
 			totalDataSize *= numElements;
 		}
-		return totalDataSize;
+		return countSize + totalDataSize;
 	}
 	int dataSize = typeEntryPtr->m_dataSize;
 	if (numElements > 1)
 	{
 #if LES_TYPE_DEBUG
-		LES_LOG("POD 0x%X Type:0x%X Size:%d NumELements:%d", m_hash, typeEntryPtr->m_hash, dataSize, numElements);
+		LES_LOG("POD 0x%X Type:0x%X Size:%d NumELements:%d", inputTypeEntryPtr->m_hash, typeEntryPtr->m_hash, dataSize, numElements);
 #endif // #if LES_TYPE_DEBUG
 		dataSize *= numElements;
 	}
+	return countSize + dataSize;
+}
+
+static int LES_TypeGetDataStorageSize(const LES_TypeEntry* const typeEntryPtr, const bool minimum)
+{
+	const LES_uint32 resolvedFlag = minimum ? LES_RESOLVED_MIN_DATA_STORAGE_SIZE : LES_RESOLVED_DATA_STORAGE_SIZE;
+	const int id = LES_GetTypeEntryIDForPtr(typeEntryPtr);
+	if (id < 0)
+	{
+		return LES_TypeComputeDataStorageSize(typeEntryPtr, minimum);
+	}
+	LES_ResolvedType* const pResolvedType = &les_resolvedTypeArray[id];
+	if (pResolvedType->m_resolvedFlags & resolvedFlag)
+	{
+		return minimum ? pResolvedType->m_minDataStorageSize : pResolvedType->m_dataStorageSize;
+	}
+	const int dataSize = LES_TypeComputeDataStorageSize(typeEntryPtr, minimum);
+	if (dataSize >= 0)
+	{
+		if (minimum)
+		{
+			pResolvedType->m_minDataStorageSize = dataSize;
+		}
+		else
+		{
+			pResolvedType->m_dataStorageSize = dataSize;
+		}
+		pResolvedType->m_resolvedFlags |= resolvedFlag;
+	}
 	return dataSize;
 }
 
-int LES_TypeEntry::ComputeAlignment(void) const
+static int LES_TypeComputeAlignment(const LES_TypeEntry* const inputTypeEntryPtr)
 {
-	const LES_TypeEntry* typeEntryPtr = this;
+	const LES_TypeEntry* typeEntryPtr = inputTypeEntryPtr;
 	unsigned int flags = typeEntryPtr->m_flags;
 	if (flags & LES_TYPE_ARRAY)
 	{
@@ -192,7 +296,7 @@ int LES_TypeEntry::ComputeAlignment(void) const
 	{
 		typeEntryPtr = typeEntryPtr->GetRootType();
 		flags = typeEntryPtr->m_flags;
-		const LES_StructDefinition* const structDefinition = LES_GetStructDefinition(typeEntryPtr->m_hash);
+		const LES_StructDefinition* const structDefinition = typeEntryPtr->GetStructDefinition();
 		if (structDefinition == LES_NULL)
 		{
 			LES_FATAL_ERROR("ComputeAlignment type:0x%X is a struct but can't be found", typeEntryPtr->m_hash);
@@ -203,9 +307,7 @@ int LES_TypeEntry::ComputeAlignment(void) const
 		for (int i = 0; i < numMembers; i++)
 		{
 			const LES_StructMember* const structMember = structDefinition->GetMemberByIndex(i);
-			const int memberTypeID = structMember->m_typeID;
-			const LES_StringEntry* const memberTypeStringEntry = LES_GetStringEntryForID(memberTypeID);
-			const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntry(memberTypeStringEntry);
+			const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntryForStringID(structMember->m_typeID);
 			const int alignment = memberTypeEntryPtr->ComputeAlignment();
 			if (alignment > maxAlignment)
 			{
@@ -225,6 +327,201 @@ int LES_TypeEntry::ComputeAlignment(void) const
 	return alignment;
 }
 
+/* 1 if the type or any member of the struct it is, is a pointer or reference : -1 if a struct definition can't be found */
+static int LES_TypeComputeContainsPointers(const LES_TypeEntry* const typeEntryPtr)
+{
+	if (typeEntryPtr->m_flags & (LES_TYPE_POINTER | LES_TYPE_REFERENCE))
+	{
+		return 1;
+	}
+	const LES_TypeEntry* const rootTypeEntryPtr = typeEntryPtr->GetRootType();
+	if (rootTypeEntryPtr == LES_NULL)
+	{
+		return -1;
+	}
+	if ((rootTypeEntryPtr->m_flags & LES_TYPE_STRUCT) == 0)
+	{
+		return 0;
+	}
+	const LES_StructDefinition* const structDefinition = rootTypeEntryPtr->GetStructDefinition();
+	if (structDefinition == LES_NULL)
+	{
+		return -1;
+	}
+	const int numMembers = structDefinition->GetNumMembers();
+	for (int i = 0; i < numMembers; i++)
+	{
+		const LES_StructMember* const structMember = structDefinition->GetMemberByIndex(i);
+		const LES_TypeEntry* const memberTypeEntryPtr = LES_GetTypeEntryForStringID(structMember->m_typeID);
+		if (memberTypeEntryPtr == LES_NULL)
+		{
+			return -1;
+		}
+		const int containsPointers = memberTypeEntryPtr->ContainsPointers();
+		if (containsPointers != 0)
+		{
+			return containsPointers;
+		}
+	}
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+const LES_TypeEntry* LES_GetTypeEntry(const LES_StringEntry* const typeStringEntry)
+{
+	const LES_Hash hash = typeStringEntry->m_hash;
+	const int id = LES_GetTypeEntryID(hash);
+	const LES_TypeEntry* const pTypeEntry = LES_GetTypeEntryForID(id);
+	return pTypeEntry;
+}
+
+LES_uint32 LES_TypeEntry::GetTrivialFlags(void) const
+{
+	const int id = LES_GetTypeEntryIDForPtr(this);
+	if ((id < 0) || (id >= les_typeTrivialFlagsArraySize))
+	{
+		return 0;
+	}
+	return les_typeTrivialFlagsArray[id];
+}
+
+const LES_TypeEntry* LES_GetTypeEntryForStringID(const int typeStringID)
+{
+	if ((typeStringID < 0) || (typeStringID >= les_typeIDByStringIDSize))
+	{
+		return LES_NULL;
+	}
+	return LES_GetTypeEntryForID(les_typeIDByStringID[typeStringID]);
+}
+
+const LES_TypeEntry* LES_TypeEntry::GetRootType(void) const
+{
+	const int id = LES_GetTypeEntryIDForPtr(this);
+	if ((id >= 0) && les_resolvedTypeArray[id].m_rootType)
+	{
+		return les_resolvedTypeArray[id].m_rootType;
+	}
+
+	/* Not resolved when it was added : walk the aliases and keep the result */
+	const LES_TypeEntry* typeEntryPtr = this;
+	unsigned int flags = typeEntryPtr->m_flags;
+	while (flags & LES_TYPE_ALIAS)
+	{
+		const int aliasedTypeID = typeEntryPtr->m_aliasedTypeID;
+#if LES_TYPE_DEBUG
+			LES_LOG("Type 0x%X alias:%d flags:0x%X", typeEntryPtr->m_hash, aliasedTypeID, flags);
+#endif // #if LES_TYPE_DEBUG
+		const LES_StringEntry* const aliasedStringTypeEntry = LES_GetStringEntryForID(aliasedTypeID);
+		if (aliasedStringTypeEntry == LES_NULL)
+		{
+			LES_FATAL_ERROR("GetRootType aliased type:%d entry can't be found", aliasedTypeID);
+			return LES_NULL;
+		}
+		const LES_TypeEntry* const aliasedTypeEntryPtr = LES_GetTypeEntry(aliasedStringTypeEntry);
+		if (aliasedTypeEntryPtr == LES_NULL)
+		{
+			LES_FATAL_ERROR("GetRootType aliased type not found aliased type:'%s'", aliasedStringTypeEntry->m_str);
+			return LES_NULL;
+		}
+#if LES_TYPE_DEBUG
+		LES_LOG("GetRootType Alignment Type 0x%X alias:%s", typeEntryPtr->m_hash, aliasedStringTypeEntry->m_str);
+#endif // #if LES_TYPE_DEBUG
+			typeEntryPtr = (const LES_TypeEntry*)aliasedTypeEntryPtr;
+			flags = typeEntryPtr->m_flags;
+#if LES_TYPE_DEBUG
+		LES_LOG("Alias Type 0x%X flags:0x%X", typeEntryPtr->m_hash, flags);
+#endif // #if LES_TYPE_DEBUG
+	}
+	if (id >= 0)
+	{
+		les_resolvedTypeArray[id].m_rootType = typeEntryPtr;
+	}
+	return typeEntryPtr;
+}
+
+const LES_StructDefinition* LES_TypeEntry::GetStructDefinition(void) const
+{
+	const LES_TypeEntry* const rootTypeEntryPtr = GetRootType();
+	if (rootTypeEntryPtr == LES_NULL)
+	{
+		return LES_NULL;
+	}
+	const int rootID = LES_GetTypeEntryIDForPtr(rootTypeEntryPtr);
+	if ((rootID >= 0) && les_resolvedTypeArray[rootID].m_structDefinition)
+	{
+		return les_resolvedTypeArray[rootID].m_structDefinition;
+	}
+	if ((rootTypeEntryPtr->m_flags & LES_TYPE_STRUCT) == 0)
+	{
+		return LES_NULL;
+	}
+
+	/* The struct definition was added before its type : find it and keep the result */
+	const LES_StructDefinition* const structDefinition = LES_GetStructDefinition(rootTypeEntryPtr->m_hash);
+	if (rootID >= 0)
+	{
+		les_resolvedTypeArray[rootID].m_structDefinition = structDefinition;
+	}
+	return structDefinition;
+}
+
+int LES_TypeEntry::ComputeDataStorageSize(void) const
+{
+	return LES_TypeGetDataStorageSize(this, false);
+}
+
+int LES_TypeEntry::ComputeMinDataStorageSize(void) const
+{
+	return LES_TypeGetDataStorageSize(this, true);
+}
+
+int LES_TypeEntry::ComputeAlignment(void) const
+{
+	const int id = LES_GetTypeEntryIDForPtr(this);
+	if (id < 0)
+	{
+		return LES_TypeComputeAlignment(this);
+	}
+	LES_ResolvedType* const pResolvedType = &les_resolvedTypeArray[id];
+	if (pResolvedType->m_resolvedFlags & LES_RESOLVED_ALIGNMENT)
+	{
+		return pResolvedType->m_alignment;
+	}
+	const int alignment = LES_TypeComputeAlignment(this);
+	if (alignment >= 0)
+	{
+		pResolvedType->m_alignment = alignment;
+		pResolvedType->m_resolvedFlags |= LES_RESOLVED_ALIGNMENT;
+	}
+	return alignment;
+}
+
+int LES_TypeEntry::ContainsPointers(void) const
+{
+	const int id = LES_GetTypeEntryIDForPtr(this);
+	if (id < 0)
+	{
+		return LES_TypeComputeContainsPointers(this);
+	}
+	LES_ResolvedType* const pResolvedType = &les_resolvedTypeArray[id];
+	if (pResolvedType->m_resolvedFlags & LES_RESOLVED_CONTAINS_POINTERS)
+	{
+		return pResolvedType->m_containsPointers;
+	}
+	const int containsPointers = LES_TypeComputeContainsPointers(this);
+	if (containsPointers >= 0)
+	{
+		pResolvedType->m_containsPointers = containsPointers;
+		pResolvedType->m_resolvedFlags |= LES_RESOLVED_CONTAINS_POINTERS;
+	}
+	return containsPointers;
+}
+
 void LES_DebugOutputTypes(LES_LoggerChannel* const pLogChannel)
 {
 	const int numTypes = les_typeDataNumTypes + les_numTypeEntries;
@@ -317,6 +614,33 @@ void LES_Type_DecodeFlags(char* const flagsDecoded, const LES_uint flags)
 		strcat(flagsDecoded, "ENDIANSWAP");
 		needsPipe = true;
 	}
+	if (flags & LES_TYPE_STRING)
+	{
+		if (needsPipe)
+		{
+			strcat(flagsDecoded, "|");
+		}
+		strcat(flagsDecoded, "STRING");
+		needsPipe = true;
+	}
+	if (flags & LES_TYPE_DYNAMIC_ARRAY)
+	{
+		if (needsPipe)
+		{
+			strcat(flagsDecoded, "|");
+		}
+		strcat(flagsDecoded, "DYNAMIC_ARRAY");
+		needsPipe = true;
+	}
+	if (flags & LES_TYPE_INTEGER)
+	{
+		if (needsPipe)
+		{
+			strcat(flagsDecoded, "|");
+		}
+		strcat(flagsDecoded, "INTEGER");
+		needsPipe = true;
+	}
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,19 +653,41 @@ void LES_TypeInit(void)
 {
 	les_typeEntryArray = new LES_TypeEntry[1024];
 	les_numTypeEntries = 0;
+	les_typeEntryIndex.Clear();
+	les_typeEntryIndex.Reserve(1024);
+	LES_TypeResetTrivialFlags(1024);
+
+	les_typeIDByStringID = LES_NULL;
+	les_typeIDByStringIDSize = 0;
+	les_resolvedTypeArraySize = 1024;
+	les_resolvedTypeArray = new LES_ResolvedType[les_resolvedTypeArraySize];
+	memset(les_resolvedTypeArray, 0, sizeof(LES_ResolvedType) * (size_t)les_resolvedTypeArraySize);
 }
 
 void LES_TypeShutdown(void)
 {
 	les_numTypeEntries = 0;
 	delete[] les_typeEntryArray;
+	les_typeEntryIndex.Free();
+	delete[] les_typeTrivialFlagsArray;
+	les_typeTrivialFlagsArray = LES_NULL;
+	les_typeTrivialFlagsArraySize = 0;
+
+	delete[] les_typeIDByStringID;
+	les_typeIDByStringID = LES_NULL;
+	les_typeIDByStringIDSize = 0;
+	delete[] les_resolvedTypeArray;
+	les_resolvedTypeArray = LES_NULL;
+	les_resolvedTypeArraySize = 0;
 }
 
 int LES_AddType(const char* const name, const unsigned int dataSize, const unsigned int inputFlags, 
 								const char* const aliasedName, const int numElements)
 {
 	unsigned int flags = inputFlags;
-	if (numElements >= 1)
+	const bool isVariableSize = flags & LES_TYPE_VARIABLE_SIZE;
+	/* numElements is the maximum count for variable sized types : they aren't arrays */
+	if ((numElements >= 1) && (isVariableSize == false))
 	{
 		if ((flags & LES_TYPE_ARRAY) == 0)
 		{
@@ -368,6 +714,35 @@ int LES_AddType(const char* const name, const unsigned int dataSize, const unsig
 			return LES_RETURN_ERROR;
 		}
 	}
+	if (isVariableSize)
+	{
+		if (numElements <= 0)
+		{
+			LES_WARNING("AddType '%s' NumELements:%d Invalid maximum number of elements must be > 0", name, numElements);
+			return LES_RETURN_ERROR;
+		}
+		const unsigned int invalidFlags = LES_TYPE_OUTPUT|LES_TYPE_POINTER|LES_TYPE_REFERENCE|LES_TYPE_ARRAY;
+		if (((flags & LES_TYPE_VARIABLE_SIZE) == LES_TYPE_VARIABLE_SIZE) || (flags & invalidFlags))
+		{
+			char flagsDecoded[1024];
+			LES_Type_DecodeFlags(flagsDecoded, flags);
+			LES_WARNING("AddType '%s' Flags:0x%X %s variable sized types must be input only and not a pointer, reference or array", 
+									name, flags, flagsDecoded);
+			return LES_RETURN_ERROR;
+		}
+	}
+	if (flags & LES_TYPE_INTEGER)
+	{
+		const bool isEndianSwapPOD = ((flags & (LES_TYPE_POD|LES_TYPE_ENDIANSWAP)) == (LES_TYPE_POD|LES_TYPE_ENDIANSWAP));
+		if ((isEndianSwapPOD == false) || ((dataSize != 2) && (dataSize != 4) && (dataSize != 8)))
+		{
+			char flagsDecoded[1024];
+			LES_Type_DecodeFlags(flagsDecoded, flags);
+			LES_WARNING("AddType '%s' DataSize:%d Flags:0x%X %s integer types must be 2, 4 or 8 byte ENDIANSWAP PODs", 
+									name, dataSize, flags, flagsDecoded);
+			return LES_RETURN_ERROR;
+		}
+	}
 	if (flags & LES_TYPE_ALIAS)
 	{
 		const LES_StringEntry* const aliasedEntryPtr = LES_GetStringEntry(aliasedName);
@@ -378,7 +753,7 @@ int LES_AddType(const char* const name, const unsigned int dataSize, const unsig
 		}
 	}
 
-	int index = LES_GetTypeEntrySlow(hash);
+	int index = LES_GetTypeEntryID(hash);
 	if (index < 0)
 	{
 		if (isArray)
@@ -390,7 +765,7 @@ int LES_AddType(const char* const name, const unsigned int dataSize, const unsig
 										name, hash, numElements);
 				return LES_RETURN_ERROR;
 			}
-			const int aliasedIndex = LES_GetTypeEntrySlow(aliasedHash);
+			const int aliasedIndex = LES_GetTypeEntryID(aliasedHash);
 			if (aliasedIndex == -1)
 			{
 				LES_WARNING("AddType '%s' hash 0x%X can't find its aliased type '%s'", name, hash, aliasedName);
@@ -414,13 +789,45 @@ int LES_AddType(const char* const name, const unsigned int dataSize, const unsig
 			}
 		}
 
+		if (isVariableSize)
+		{
+			// Variable sized types must be aliased to the type of the items
+			if ((flags & LES_TYPE_ALIAS) == 0)
+			{
+				LES_WARNING("AddType '%s' hash 0x%X is variable sized but not aliased, variable sized types must be aliased", name, hash);
+				return LES_RETURN_ERROR;
+			}
+			const int aliasedIndex = LES_GetTypeEntryID(aliasedHash);
+			if (aliasedIndex == -1)
+			{
+				LES_WARNING("AddType '%s' hash 0x%X can't find its aliased type '%s'", name, hash, aliasedName);
+				return LES_RETURN_ERROR;
+			}
+			const LES_TypeEntry* const aliasedTypeEntryPtr = LES_GetTypeEntryForID(aliasedIndex);
+			const unsigned int aliasedFlags = aliasedTypeEntryPtr->m_flags;
+			const unsigned int invalidAliasedFlags = LES_TYPE_POINTER|LES_TYPE_REFERENCE|LES_TYPE_ARRAY|LES_TYPE_VARIABLE_SIZE;
+			if (aliasedFlags & invalidAliasedFlags)
+			{
+				LES_WARNING("AddType '%s' hash 0x%X variable sized types must be aliased to a non-pointer, non-reference, non-array type Alias:'%s' Flags:0x%X", 
+										name, hash, aliasedName, aliasedFlags);
+				return LES_RETURN_ERROR;
+			}
+			// Strings must be aliased to a 1 byte POD
+			if ((flags & LES_TYPE_STRING) && (((aliasedFlags & LES_TYPE_POD) == 0) || (aliasedTypeEntryPtr->m_dataSize != 1)))
+			{
+				LES_WARNING("AddType '%s' hash 0x%X string types must be aliased to a 1 byte POD type Alias:'%s' Flags:0x%X", 
+										name, hash, aliasedName, aliasedFlags);
+				return LES_RETURN_ERROR;
+			}
+		}
+
 		if (les_pTypeData)
 		{
 			LES_ERROR("AddType '%s' hash 0x%X not found in type data definition file", name, hash);
 			return LES_RETURN_ERROR;
 		}
 
-		LES_AddStringEntry(name);
+		const int nameID = LES_AddStringEntry(name);
 		const int aliasedTypeID = LES_GetStringEntryID(aliasedHash, aliasedName);
 #if LES_TYPE_DEBUG
 		LES_LOG("aliasedTypeID:%d name:'%s' aliasedName:'%s'", aliasedTypeID, name, aliasedName);
@@ -429,6 +836,7 @@ int LES_AddType(const char* const name, const unsigned int dataSize, const unsig
 		// Add the new type
 		index = les_numTypeEntries;
 		LES_TypeEntry* const pTypeEntry = &les_typeEntryArray[index];
+		pTypeEntry->m_hash = hash;
 		pTypeEntry->m_dataSize = dataSize;
 		pTypeEntry->m_flags= flags;
 		pTypeEntry->m_aliasedTypeID = aliasedTypeID;
@@ -436,6 +844,19 @@ int LES_AddType(const char* const name, const unsigned int dataSize, const unsig
 
 		index += les_typeDataNumTypes;
 		les_numTypeEntries++;
+		les_typeEntryIndex.Add(hash, index);
+		LES_Function_BumpDefinitionGeneration();
+
+		LES_TypeSetTypeIDForStringID(nameID, index);
+		les_resolvedTypeArray[index].m_rootType = LES_TypeFindRootType(pTypeEntry);
+		les_resolvedTypeArray[index].m_structDefinition = (flags & LES_TYPE_STRUCT) ? LES_GetStructDefinition(hash) : LES_NULL;
+		les_resolvedTypeArray[index].m_resolvedFlags = 0;
+
+		/* The struct definition can be added before its type entry : the trivial flags need the type entry */
+		if (les_resolvedTypeArray[index].m_structDefinition)
+		{
+			LES_Struct_SetTrivialFlags(les_resolvedTypeArray[index].m_structDefinition);
+		}
 	}
 	else
 	{
@@ -504,10 +925,82 @@ void LES_DebugOutputTypeEntry(LES_LoggerChannel* const pLogChannel, const LES_Ty
 											aliasedName, aliasedTypeID, numElements);
 }
 
-void LES_Type_SetTypeDataPtr(const LES_TypeData* const pTypeData)
+void LES_Type_SetTypeDataPtr(const LES_TypeData* const pTypeData, const LES_HashTable* const pHashTable)
 {
 	les_pTypeData = pTypeData;
 	const int numTypes = pTypeData->GetNumTypes();
 	les_typeDataNumTypes = numTypes;
+	les_pTypeDataHashTable = pHashTable;
+	LES_Function_BumpDefinitionGeneration();
+
+	/* The internal type IDs are after the type data */
+	les_typeEntryIndex.Clear();
+	if (pHashTable == LES_NULL)
+	{
+		les_typeEntryIndex.Reserve(numTypes + les_numTypeEntries);
+		for (int i = 0; i < numTypes; i++)
+		{
+			les_typeEntryIndex.Add(pTypeData->GetTypeEntry(i)->m_hash, i);
+		}
+	}
+	for (int i = 0; i < les_numTypeEntries; i++)
+	{
+		les_typeEntryIndex.Add(les_typeEntryArray[i].m_hash, i + numTypes);
+	}
+
+	/* The type IDs have moved : resolve every type reference again */
+	const int numStringEntries = LES_GetNumStringEntries();
+	if (les_typeIDByStringID)
+	{
+		memset(les_typeIDByStringID, 0xFF, sizeof(LES_int32) * (size_t)les_typeIDByStringIDSize);
+	}
+	for (int i = 0; i < numStringEntries; i++)
+	{
+		const int typeID = LES_GetTypeEntryID(LES_GetStringEntryForID(i)->m_hash);
+		if (typeID >= 0)
+		{
+			LES_TypeSetTypeIDForStringID(i, typeID);
+		}
+	}
+
+	const int numTypeIDs = numTypes + les_numTypeEntries;
+	delete[] les_resolvedTypeArray;
+	les_resolvedTypeArraySize = numTypes + 1024;
+	les_resolvedTypeArray = new LES_ResolvedType[les_resolvedTypeArraySize];
+	memset(les_resolvedTypeArray, 0, sizeof(LES_ResolvedType) * (size_t)les_resolvedTypeArraySize);
+	for (int i = 0; i < numTypeIDs; i++)
+	{
+		les_resolvedTypeArray[i].m_rootType = LES_TypeFindRootType(LES_GetTypeEntryForID(i));
+	}
+
+	LES_TypeResetTrivialFlags(numTypes + 1024);
+}
+
+/* Returns 1 if the flags changed : -1 if the type isn't registered */
+int LES_Type_SetTrivialFlags(const LES_TypeEntry* const typeEntryPtr, const LES_uint32 trivialFlags)
+{
+	const int id = LES_GetTypeEntryIDForPtr(typeEntryPtr);
+	if ((id < 0) || (id >= les_typeTrivialFlagsArraySize))
+	{
+		return -1;
+	}
+	if (les_typeTrivialFlagsArray[id] == trivialFlags)
+	{
+		return 0;
+	}
+	les_typeTrivialFlagsArray[id] = trivialFlags;
+	return 1;
+}
+
+/* Struct definitions are resolved to their type when they are added : the struct definition IDs aren't needed */
+void LES_Type_SetStructDefinition(const LES_StructDefinition* const structDefinitionPtr)
+{
+	const LES_StringEntry* const structNameStringEntry = LES_GetStringEntryForID(structDefinitionPtr->GetNameID());
+	const int typeID = structNameStringEntry ? LES_GetTypeEntryID(structNameStringEntry->m_hash) : -1;
+	if (typeID < 0)
+	{
+		return;
+	}
+	les_resolvedTypeArray[typeID].m_structDefinition = structDefinitionPtr;
 }
 
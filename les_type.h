@@ -5,6 +5,7 @@
 #include "les_hash.h"
 
 struct LES_StringEntry;
+class LES_StructDefinition;
 class LES_LoggerChannel;
 
 #define LES_TYPE_INPUT 				(1<< 0)
@@ -18,6 +19,37 @@ class LES_LoggerChannel;
 #define LES_TYPE_ARRAY 				(1 << 7)
 #define LES_TYPE_ENDIANSWAP		(1 << 8)
 
+/*
+ * Variable sized input types : the wire format is a LES_uint32 count followed by count items
+ * STRING is a LES_String (a NUL terminated char*) aliased to char : the terminator isn't sent
+ * DYNAMIC_ARRAY is a LES_DynamicArray<T> (data pointer + count) aliased to T
+ * m_numElements is the maximum count : the parameter data is allocated for the maximum and sent at the real size
+*/
+#define LES_TYPE_STRING					(1 << 11)
+#define LES_TYPE_DYNAMIC_ARRAY	(1 << 12)
+#define LES_TYPE_VARIABLE_SIZE	(LES_TYPE_STRING|LES_TYPE_DYNAMIC_ARRAY)
+
+/* Integer PODs (2, 4 or 8 byte ENDIANSWAP) : written as varints when varint parameter data was negotiated */
+#define LES_TYPE_INTEGER				(1 << 13)
+
+#define LES_TYPE_COUNT_SIZE			(4)
+
+/* 
+ * Trivial struct flags from GetTrivialFlags() : computed when the struct definition is loaded, not part of m_flags
+ * The memory layout is the wire layout so it can be copied as one block
+ * TRIVIAL_NATIVE only when the parameter data is native endian, TRIVIAL also when it is big endian (no endian swapped members)
+*/
+#define LES_TYPE_TRIVIAL_NATIVE	(1 << 0)
+#define LES_TYPE_TRIVIAL				(1 << 1)
+
+typedef const char* LES_String;
+
+template <class T> struct LES_DynamicArray
+{
+	T* m_data;
+	LES_int32 m_numElements;
+};
+
 struct LES_TypeEntry
 {
 	LES_uint32 m_hash;
@@ -28,8 +60,14 @@ struct LES_TypeEntry
 
 public:
 	int ComputeDataStorageSize(void) const;
+	int ComputeMinDataStorageSize(void) const;
 	int ComputeAlignment(void) const;
+	/* 1 if the type or any of its struct members is a pointer or reference : -1 if a struct definition can't be found */
+	int ContainsPointers(void) const;
 	const LES_TypeEntry* GetRootType(void) const;
+	LES_uint32 GetTrivialFlags(void) const;
+	/* The struct definition of the root type : NULL if it isn't a struct */
+	const LES_StructDefinition* GetStructDefinition(void) const;
 
 public:
 	static LES_Hash s_longlongHash;
@@ -45,6 +83,8 @@ public:
 };
 
 const LES_TypeEntry* LES_GetTypeEntry(const LES_StringEntry* const typeStringEntry);
+/* Struct members, function parameters and aliases store the string ID of their type : no hash lookup */
+const LES_TypeEntry* LES_GetTypeEntryForStringID(const int typeStringID);
 void LES_DebugOutputTypes(LES_LoggerChannel* const pLogChannel);
 void LES_Type_DecodeFlags(char* const flagsDecoded, const LES_uint flags);
 
@@ -17,6 +17,14 @@ LES_TYPE_REFERENCE 		= (1 << 5)
 LES_TYPE_ALIAS 				= (1 << 6)
 LES_TYPE_ARRAY 				= (1 << 7)
 LES_TYPE_ENDIANSWAP		= (1 << 8)
+# Variable sized input types : a uint32 count then the items, numElements is the maximum count
+LES_TYPE_STRING				= (1 << 11)
+LES_TYPE_DYNAMIC_ARRAY	= (1 << 12)
+LES_TYPE_VARIABLE_SIZE	= (LES_TYPE_STRING|LES_TYPE_DYNAMIC_ARRAY)
+# Integer PODs (2, 4 or 8 byte ENDIANSWAP) : written as zig-zag LEB128 varints when varint parameter data was negotiated
+LES_TYPE_INTEGER			= (1 << 13)
+
+LES_TYPE_COUNT_SIZE = 4
 
 s_longlongHash = les_hash.LES_GenerateHashCaseSensitive("long long int")
 s_longlongHash = les_hash.LES_GenerateHashCaseSensitive("long long int");
@@ -31,7 +39,7 @@ s_ucharHash = les_hash.LES_GenerateHashCaseSensitive("unsigned char");
 s_floatHash = les_hash.LES_GenerateHashCaseSensitive("float");
 
 def decodeFlags(flags):
-	# flags = INPUT, OUTPUT, POD, STRUCT, POINTER, STRUCT, REFERENCE, ALIAS, ARRAY, ENDIANSWAP delimiter is | e.g. "INPUT|POD"
+	# flags = INPUT, OUTPUT, POD, STRUCT, POINTER, STRUCT, REFERENCE, ALIAS, ARRAY, ENDIANSWAP, STRING, DYNAMIC_ARRAY, INTEGER delimiter is | e.g. "INPUT|POD"
 	flagsArray = []
 	if flags & LES_TYPE_INPUT:
 		flagsArray.append("INPUT")
@@ -51,6 +59,12 @@ def decodeFlags(flags):
 		flagsArray.append("ARRAY")
 	if flags & LES_TYPE_ENDIANSWAP:
 		flagsArray.append("ENDIANSWAP")
+	if flags & LES_TYPE_STRING:
+		flagsArray.append("STRING")
+	if flags & LES_TYPE_DYNAMIC_ARRAY:
+		flagsArray.append("DYNAMIC_ARRAY")
+	if flags & LES_TYPE_INTEGER:
+		flagsArray.append("INTEGER")
 	flagsString = "|".join(flagsArray)
 	return flagsString
 
@@ -157,7 +171,33 @@ class LES_TypeData():
 				les_logger.Error("LES_TypeData::addType '%s' aliasedName:'%s' doesn't exist", name, aliasedName)
 				return -1
 
-		if numElements > 0:
+		if flags & LES_TYPE_INTEGER:
+			isEndianSwapPOD = (flags & (LES_TYPE_POD|LES_TYPE_ENDIANSWAP)) == (LES_TYPE_POD|LES_TYPE_ENDIANSWAP)
+			if (isEndianSwapPOD == False) or (dataSize not in (2, 4, 8)):
+				les_logger.Error("LES_TypeData::addType '%s' integer types must be 2, 4 or 8 byte ENDIANSWAP PODs dataSize:%d flags:'%s'", name, dataSize, decodeFlags(flags))
+				return -1
+
+		if flags & LES_TYPE_VARIABLE_SIZE:
+			if numElements <= 0:
+				les_logger.Error("LES_TypeData::addType '%s' invalid maximum numElements value:%d (must be > 0)", name, numElements)
+				return -1
+			invalidFlags = LES_TYPE_OUTPUT|LES_TYPE_POINTER|LES_TYPE_REFERENCE|LES_TYPE_ARRAY
+			if ((flags & LES_TYPE_VARIABLE_SIZE) == LES_TYPE_VARIABLE_SIZE) or (flags & invalidFlags):
+				les_logger.Error("LES_TypeData::addType '%s' variable sized types must be input only and not a pointer, reference or array flags:'%s'", name, decodeFlags(flags))
+				return -1
+			if flags & LES_TYPE_ALIAS == 0:
+				les_logger.Error("LES_TypeData::addType '%s' is variable sized but not aliased, variable sized types must be aliased", name)
+				return -1
+			typeEntry = self.getTypeData(aliasedName)
+			aliasedFlags = typeEntry.m_flags
+			if aliasedFlags & (LES_TYPE_POINTER|LES_TYPE_REFERENCE|LES_TYPE_ARRAY|LES_TYPE_VARIABLE_SIZE):
+				les_logger.Error("LES_TypeData::addType '%s' variable sized types must be aliased to a non-pointer, non-reference, non-array type Alias:'%s' Flags:0x%X %s", name, aliasedName, aliasedFlags, decodeFlags(aliasedFlags))
+				return -1
+			if (flags & LES_TYPE_STRING) and (((aliasedFlags & LES_TYPE_POD) == 0) or (typeEntry.m_dataSize != 1)):
+				les_logger.Error("LES_TypeData::addType '%s' string types must be aliased to a 1 byte POD type Alias:'%s' Flags:0x%X %s", name, aliasedName, aliasedFlags, decodeFlags(aliasedFlags))
+				return -1
+
+		if numElements > 0 and (flags & LES_TYPE_VARIABLE_SIZE) == 0:
 			if (flags & LES_TYPE_ARRAY) == 0:
 				les_logger.Error("LES_TypeData::addType '%s' numElements > 0 but ARRAY not in flags:'%s'", name, decodeFlags(flags))
 				return -1
@@ -211,6 +251,12 @@ class LES_TypeData():
 			return None
 		return self.__m_typeEntries__[index]
 
+	def getNumTypes(self):
+		return len(self.__m_typeEntries__)
+
+	def getTypeEntryByIndex(self, index):
+		return self.__m_typeEntries__[index]
+
 	def write(self, binFile):
 		# LES_TypeData
 		# {
@@ -274,6 +320,12 @@ class LES_TypeData():
 		#		numElements = 0, fixed can't be specified
 		#		endianSwap = true, fixed can't be specified
 
+		# <LES_TYPE_POD_INTEGER name="int" dataSize="4" />
+		#		flags = INPUT|POD|ENDIANSWAP|INTEGER, fixed can't be specified
+		#		aliasedName = input_name, fixed can't be specified
+		#		numElements = 0, fixed can't be specified
+		#		dataSize must be 2, 4 or 8
+
 		# <LES_TYPE_POD_POINTER name="unsigned char" />
 		#		name = input_name + "*"
 		#		dataSize = 4 by default : this could be set by some global params in the XML in the future
@@ -331,6 +383,19 @@ class LES_TypeData():
 		#		flags = INPUT|OUTPUT|STRUCT|REFERENCE|ARRAY, fixed can't be specified
 		#		aliasedName = input_name+"*"
 
+		# <LES_TYPE_STRING name="LES_String" numElements="64" />
+		#		dataSize = 4 by default : the size of the char pointer
+		#		flags = INPUT|STRING, fixed can't be specified
+		#		aliasedName = "char", fixed can't be specified
+		#		numElements = maximum length of the string (not including the terminator)
+
+		# <LES_TYPE_DYNAMIC_ARRAY name="short" numElements="16" />
+		#		name = "LES_DynamicArray<" + input_name + ">"
+		#		dataSize = 8 by default : the size of the pointer + count struct
+		#		flags = INPUT|DYNAMIC_ARRAY, fixed can't be specified
+		#		aliasedName = input_name, fixed can't be specified
+		#		numElements = maximum number of elements
+
 		typesXML = xml.etree.ElementTree.XML(xmlSource)
 		if typesXML.tag != "LES_TYPES":
 			les_logger.Error("LES_TypeData::parseXML root tag should be LES_TYPES found %d", typesXML.tag)
@@ -350,7 +415,9 @@ class LES_TypeData():
 			endianSwapDataDefault = "false"
 			flagsData = ""
 			nameSuffix = ""
+			namePrefix = ""
 			aliasSuffix = ""
+			aliasedNameFixed = None
 			nameSuffixAddNumElements = False
 
 			if typeXML.tag == "LES_TYPE":
@@ -362,6 +429,8 @@ class LES_TypeData():
 				flagsData = "INPUT|POD"
 			elif typeXML.tag == "LES_TYPE_POD_ENDIANSWAP":
 				flagsData = "INPUT|POD|ENDIANSWAP"
+			elif typeXML.tag == "LES_TYPE_POD_INTEGER":
+				flagsData = "INPUT|POD|ENDIANSWAP|INTEGER"
 			elif typeXML.tag == "LES_TYPE_POD_POINTER":
 				flagsData = "INPUT|OUTPUT|POD|POINTER"
 				nameSuffix = "*"
@@ -412,8 +481,19 @@ class LES_TypeData():
 				nameSuffixAddNumElements = True
 				aliasSuffix = "*"
 				needsNumElements = True
+			elif typeXML.tag == "LES_TYPE_STRING":
+				flagsData = "INPUT|STRING"
+				dataSizeDataDefault = "4"
+				aliasedNameFixed = "char"
+				needsNumElements = True
+			elif typeXML.tag == "LES_TYPE_DYNAMIC_ARRAY":
+				flagsData = "INPUT|DYNAMIC_ARRAY"
+				dataSizeDataDefault = "8"
+				namePrefix = "LES_DynamicArray<"
+				nameSuffix = ">"
+				needsNumElements = True
 			else:
-				les_logger.Error("LES_TypeData::parseXML invalid node tag should be LES_TYPE, LES_TYPE_POD, LES_TYPE_POD_ENDIANSWAP, LES_TYPE_POD_POINTER, LES_TYPE_POD_REFERENCE, LES_TYPE_POD_ARRAY, LES_TYPE_POD_REFERENCE_ARRAY, LES_TYPE_STRUCT, LES_TYPE_STRUCT_POINTER, LES_TYPE_STRUCT_REFERENCE, LES_TYPE_STRUCT_ARRAY, LES_TYPE_STRUCT_REFERNCE_ARRAY found %s", typeXML.tag)
+				les_logger.Error("LES_TypeData::parseXML invalid node tag should be LES_TYPE, LES_TYPE_POD, LES_TYPE_POD_ENDIANSWAP, LES_TYPE_POD_INTEGER, LES_TYPE_POD_POINTER, LES_TYPE_POD_REFERENCE, LES_TYPE_POD_ARRAY, LES_TYPE_POD_REFERENCE_ARRAY, LES_TYPE_STRUCT, LES_TYPE_STRUCT_POINTER, LES_TYPE_STRUCT_REFERENCE, LES_TYPE_STRUCT_ARRAY, LES_TYPE_STRUCT_REFERNCE_ARRAY, LES_TYPE_STRING, LES_TYPE_DYNAMIC_ARRAY found %s", typeXML.tag)
 				numErrors += 1
 				continue
 
@@ -463,6 +543,8 @@ class LES_TypeData():
 					numErrors += 1
 					continue
 				aliasedNameData = nameData + aliasSuffix
+				if aliasedNameFixed != None:
+					aliasedNameData = aliasedNameFixed
 
 			if needsNumElements:
 				numElementsData = typeXML.get("numElements", "0")
@@ -483,7 +565,7 @@ class LES_TypeData():
 				endianSwapData = "false"
 
 			aliasedName = aliasedNameData
-			name = nameData + nameSuffix
+			name = namePrefix + nameData + nameSuffix
 
 			if needsDataSize:
 				try:
@@ -527,7 +609,7 @@ class LES_TypeData():
 				numErrors += 1
 				continue
 
-			# flags = INPUT, OUTPUT, POD, STRUCT, POINTER, STRUCT, REFERENCE, ALIAS, ARRAY, ENDIANSWAP delimiter is | e.g. "INPUT|POD"
+			# flags = INPUT, OUTPUT, POD, STRUCT, POINTER, STRUCT, REFERENCE, ALIAS, ARRAY, ENDIANSWAP, STRING, DYNAMIC_ARRAY, INTEGER delimiter is | e.g. "INPUT|POD"
 			flagsArray = flagsData.split('|')
 			flags = int(0)
 			for flag in flagsArray:
@@ -549,6 +631,12 @@ class LES_TypeData():
 					flags |= LES_TYPE_ARRAY
 				elif flag == "ENDIANSWAP":
 					flags |= LES_TYPE_ENDIANSWAP
+				elif flag == "STRING":
+					flags |= LES_TYPE_STRING
+				elif flag == "DYNAMIC_ARRAY":
+					flags |= LES_TYPE_DYNAMIC_ARRAY
+				elif flag == "INTEGER":
+					flags |= LES_TYPE_INTEGER
 				else:
 					les_logger.Error("LES_TypeData::parseXML '%s' invalid flag:'%s' flags:'%s'", name, flag, flagsData)
 					numErrors += 1
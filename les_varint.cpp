@@ -0,0 +1,90 @@
+#include <string.h>
+
+#include "les_varint.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Internal Static functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static LES_int64 LES_VarintLoadSigned(const char* const pInData, const int numBytes)
+{
+	if (numBytes == 2)
+	{
+		LES_int16 value;
+		memcpy(&value, pInData, sizeof(value));
+		return value;
+	}
+	if (numBytes == 4)
+	{
+		LES_int32 value;
+		memcpy(&value, pInData, sizeof(value));
+		return value;
+	}
+	LES_int64 value;
+	memcpy(&value, pInData, sizeof(value));
+	return value;
+}
+
+/* Returns false if the value doesn't fit in numBytes */
+static bool LES_VarintStoreSigned(char* const pOutData, const int numBytes, const LES_int64 value)
+{
+	if (numBytes == 2)
+	{
+		const LES_int16 truncated = (LES_int16)value;
+		memcpy(pOutData, &truncated, sizeof(truncated));
+		return (truncated == value);
+	}
+	if (numBytes == 4)
+	{
+		const LES_int32 truncated = (LES_int32)value;
+		memcpy(pOutData, &truncated, sizeof(truncated));
+		return (truncated == value);
+	}
+	memcpy(pOutData, &value, sizeof(value));
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Public External functions
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int LES_WriteVarint(char* const pOutData, const char* const pInData, const int numBytes)
+{
+	const LES_int64 value = LES_VarintLoadSigned(pInData, numBytes);
+	LES_uint64 zigZag = ((LES_uint64)value << 1) ^ (LES_uint64)(value >> 63);
+	int numBytesWritten = 0;
+	while (zigZag >= 0x80)
+	{
+		pOutData[numBytesWritten] = (char)((zigZag & 0x7F) | 0x80);
+		numBytesWritten++;
+		zigZag >>= 7;
+	}
+	pOutData[numBytesWritten] = (char)zigZag;
+	numBytesWritten++;
+	return numBytesWritten;
+}
+
+int LES_ReadVarint(char* const pOutData, const int numBytes, const char* const pInData, const int maxNumBytesToRead)
+{
+	const int maxVarintSize = LES_VARINT_MAX_SIZE(numBytes);
+	LES_uint64 zigZag = 0;
+	for (int i = 0; (i < maxNumBytesToRead) && (i < maxVarintSize); i++)
+	{
+		const LES_uint8 byte = (LES_uint8)pInData[i];
+		zigZag |= (LES_uint64)(byte & 0x7F) << (7 * i);
+		if ((byte & 0x80) == 0)
+		{
+			const LES_int64 value = (LES_int64)(zigZag >> 1) ^ -(LES_int64)(zigZag & 1);
+			if (LES_VarintStoreSigned(pOutData, numBytes, value) == false)
+			{
+				return -1;
+			}
+			return i + 1;
+		}
+	}
+	return -1;
+}
@@ -0,0 +1,20 @@
+#ifndef LES_VARINT_HH
+#define LES_VARINT_HH
+
+#include "les_base.h"
+
+/*
+ * Zig-zag LEB128 varints for 2, 4 & 8 byte integers stored in native memory
+ * The value is sign extended to 64-bits and zig-zag encoded (0,-1,1,-2 -> 0,1,2,3) so small negative numbers stay small
+ * then written 7 bits per byte low bits first, the top bit of each byte is set if another byte follows
+ * Unsigned values are encoded as the signed value of the same width : decoding truncates back to the width
+*/
+#define LES_VARINT_MAX_SIZE(NUM_BYTES) ((((NUM_BYTES) * 8) + 1 + 6) / 7)
+
+/* Returns the number of bytes written : at most LES_VARINT_MAX_SIZE(numBytes) */
+int LES_WriteVarint(char* const pOutData, const char* const pInData, const int numBytes);
+
+/* Returns the number of bytes read or -1 if the varint is truncated, too long or doesn't fit in numBytes */
+int LES_ReadVarint(char* const pOutData, const int numBytes, const char* const pInData, const int maxNumBytesToRead);
+
+#endif // #ifndef LES_VARINT_HH